@@ -141,6 +141,15 @@ D3MFOpcPackage::D3MFOpcPackage(IOSystem *pIOHandler, const std::string &rFile) :
     std::vector<std::string> fileList;
     mZipArchive->getFileList(fileList);
 
+    // packages often carry lots of textures, inflate them all at once
+    std::vector<std::string> textureList;
+    for (const std::string &file : fileList) {
+        if (IsEmbeddedTexture(file)) {
+            textureList.push_back(file);
+        }
+    }
+    mZipArchive->prefetch(textureList);
+
     for (auto &file : fileList) {
         if (file == D3MF::XmlTag::ROOT_RELATIONSHIPS_ARCHIVE) {
             if (!mZipArchive->Exists(file.c_str())) {
@@ -42,8 +42,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "D3MFOpcPackage.h"
 #include "3MFXmlTags.h"
 #include "3MFTypes.h"
+#include "Common/ParallelFor.h"
+#include <assimp/fast_atof.h>
 #include <assimp/scene.h>
 
+#include <cstring>
 #include <utility>
 
 namespace Assimp {
@@ -66,30 +69,48 @@ bool validateColorString(const std::string color) {
     return true;
 }
 
-aiFace ReadTriangle(XmlNode &node, int &texId0, int &texId1, int &texId2) {
-    aiFace face;
-
+// Vertices and triangles make up nearly all of a model, so their attributes
+// are scanned in a single pass instead of being looked up one by one.
+void ReadTriangle(const XmlNode &node, aiFace &face, int &pid, bool &hasPid, int (&texId)[3]) {
     face.mNumIndices = 3;
-    face.mIndices = new unsigned int[face.mNumIndices];
-    face.mIndices[0] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v1).as_string()));
-    face.mIndices[1] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v2).as_string()));
-    face.mIndices[2] = static_cast<unsigned int>(std::atoi(node.attribute(XmlTag::v3).as_string()));
-
-    texId0 = texId1 = texId2 = IdNotSet;
-    XmlParser::getIntAttribute(node, XmlTag::p1, texId0);
-    XmlParser::getIntAttribute(node, XmlTag::p2, texId1);
-    XmlParser::getIntAttribute(node, XmlTag::p3, texId2);
+    face.mIndices = new unsigned int[face.mNumIndices]();
+
+    pid = texId[0] = texId[1] = texId[2] = IdNotSet;
+    hasPid = false;
+    for (pugi::xml_attribute attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        const char *name = attr.name();
+        if ((name[0] == 'v' || name[0] == 'p') && name[1] >= '1' && name[1] <= '3' && name[2] == '\0') {
+            const int value = strtol10(attr.value());
+            if (name[0] == 'v') {
+                face.mIndices[name[1] - '1'] = static_cast<unsigned int>(value);
+            } else {
+                texId[name[1] - '1'] = value;
+            }
+        } else if (::strcmp(name, XmlTag::pid) == 0) {
+            pid = strtol10(attr.value());
+            hasPid = true;
+        }
+    }
+}
 
-    return face;
+void ReadVertex(const XmlNode &node, aiVector3D &vertex) {
+    vertex = aiVector3D();
+    for (pugi::xml_attribute attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        const char *name = attr.name();
+        if (name[0] < 'x' || name[0] > 'z' || name[1] != '\0') {
+            continue;
+        }
+        fast_atoreal_move(attr.value(), vertex[name[0] - 'x']);
+    }
 }
 
-aiVector3D ReadVertex(XmlNode &node) {
-    aiVector3D vertex;
-    vertex.x = ai_strtof(node.attribute(XmlTag::x).as_string(), nullptr);
-    vertex.y = ai_strtof(node.attribute(XmlTag::y).as_string(), nullptr);
-    vertex.z = ai_strtof(node.attribute(XmlTag::z).as_string(), nullptr);
+size_t CountChildren(const XmlNode &node, const char *name) {
+    size_t count = 0;
+    for (XmlNode child = node.child(name); child; child = child.next_sibling(name)) {
+        ++count;
+    }
 
-    return vertex;
+    return count;
 }
 
 bool getNodeAttribute(const XmlNode &node, const std::string &attribute, std::string &value) {
@@ -223,15 +244,22 @@ void XmlSerializer::ImportXml(aiScene *scene) {
         return;
     }
 
+    // objects only refer to resources declared before them, so each run of
+    // consecutive objects is converted at once before the next resource is read
+    std::vector<XmlNode> objectNodes;
     XmlNode resNode = node.child(XmlTag::resources);
     for (auto &currentNode : resNode.children()) {
         const std::string currentNodeName = currentNode.name();
+        if (currentNodeName == XmlTag::object) {
+            objectNodes.push_back(currentNode);
+            continue;
+        }
+
+        ReadObjects(objectNodes);
         if (currentNodeName == XmlTag::texture_2d) {
             ReadEmbeddecTexture(currentNode);
         } else if (currentNodeName == XmlTag::texture_group) {
             ReadTextureGroup(currentNode);
-        } else if (currentNodeName == XmlTag::object) {
-            ReadObject(currentNode);
         } else if (currentNodeName == XmlTag::basematerials) {
             ReadBaseMaterials(currentNode);
         } else if (currentNodeName == XmlTag::meta) {
@@ -240,6 +268,7 @@ void XmlSerializer::ImportXml(aiScene *scene) {
             ReadColorGroup(currentNode);
         }
     }
+    ReadObjects(objectNodes);
     StoreMaterialsInScene(scene);
     XmlNode buildNode = node.child(XmlTag::build);
     if (buildNode.empty()) {
@@ -314,11 +343,42 @@ void XmlSerializer::addObjectToNode(aiNode *parent, Object *obj, aiMatrix4x4 nod
     }
 }
 
-void XmlSerializer::ReadObject(XmlNode &node) {
+void XmlSerializer::ReadObjects(std::vector<XmlNode> &nodes) {
+    if (nodes.empty()) {
+        return;
+    }
+
+    // the objects are independent of each other, only the mesh indices
+    // and the dictionary are assigned in document order afterwards
+    std::vector<Object *> objects(nodes.size(), nullptr);
+    try {
+        ParallelFor(nodes.size(), [&](size_t i) {
+            objects[i] = ReadObject(nodes[i]);
+        });
+    } catch (...) {
+        for (Object *obj : objects) {
+            delete obj;
+        }
+        throw;
+    }
+    nodes.clear();
+
+    for (Object *obj : objects) {
+        if (nullptr == obj) {
+            continue;
+        }
+        for (size_t i = 0; i < obj->mMeshes.size(); ++i) {
+            obj->mMeshIndex.push_back(mMeshCount++);
+        }
+        mResourcesDictionnary.insert(std::make_pair(obj->mId, obj));
+    }
+}
+
+Object *XmlSerializer::ReadObject(XmlNode &node) const {
     int id = IdNotSet, pid = IdNotSet, pindex = IdNotSet;
     bool hasId = getNodeAttribute(node, XmlTag::id, id);
     if (!hasId) {
-        return;
+        return nullptr;
     }
 
     bool hasPid = getNodeAttribute(node, XmlTag::pid, pid);
@@ -380,8 +440,6 @@ void XmlSerializer::ReadObject(XmlNode &node) {
             }
 
             obj->mMeshes.push_back(mesh);
-            obj->mMeshIndex.push_back(mMeshCount);
-            mMeshCount++;
         } else if (currentName == D3MF::XmlTag::components) {
             for (XmlNode &currentSubNode : currentNode.children()) {
                 const std::string subNodeName = currentSubNode.name();
@@ -401,10 +459,10 @@ void XmlSerializer::ReadObject(XmlNode &node) {
         }
     }
 
-    mResourcesDictionnary.insert(std::make_pair(id, obj));
+    return obj;
 }
 
-aiMesh *XmlSerializer::ReadMesh(XmlNode &node) {
+aiMesh *XmlSerializer::ReadMesh(XmlNode &node) const {
     if (node.empty()) {
         return nullptr;
     }
@@ -436,111 +494,99 @@ void XmlSerializer::ReadMetadata(XmlNode &node) {
     mMetaData.push_back(entry);
 }
 
-void XmlSerializer::ImportVertices(XmlNode &node, aiMesh *mesh) {
+void XmlSerializer::ImportVertices(XmlNode &node, aiMesh *mesh) const {
     ai_assert(nullptr != mesh);
 
-    std::vector<aiVector3D> vertices;
-    for (XmlNode &currentNode : node.children()) {
-        const std::string currentName = currentNode.name();
-        if (currentName == XmlTag::vertex) {
-            vertices.push_back(ReadVertex(currentNode));
-        }
-    }
-
-    mesh->mNumVertices = static_cast<unsigned int>(vertices.size());
+    mesh->mNumVertices = static_cast<unsigned int>(CountChildren(node, XmlTag::vertex));
     mesh->mVertices = new aiVector3D[mesh->mNumVertices];
-    std::copy(vertices.begin(), vertices.end(), mesh->mVertices);
+    aiVector3D *vertex = mesh->mVertices;
+    for (XmlNode currentNode = node.child(XmlTag::vertex); currentNode; currentNode = currentNode.next_sibling(XmlTag::vertex)) {
+        ReadVertex(currentNode, *vertex++);
+    }
 }
 
-void XmlSerializer::ImportTriangles(XmlNode &node, aiMesh *mesh) {
-    std::vector<aiFace> faces;
-    for (XmlNode &currentNode : node.children()) {
-        const std::string currentName = currentNode.name();
-        if (currentName == XmlTag::triangle) {
-            int pid = IdNotSet;
-            bool hasPid = getNodeAttribute(currentNode, D3MF::XmlTag::pid, pid);
-
-            int pindex[3];
-            aiFace face = ReadTriangle(currentNode, pindex[0], pindex[1], pindex[2]);
-            if (hasPid && (pindex[0] != IdNotSet || pindex[1] != IdNotSet || pindex[2] != IdNotSet)) {
-                auto it = mResourcesDictionnary.find(pid);
-                if (it != mResourcesDictionnary.end()) {
-                    if (it->second->getType() == ResourceType::RT_BaseMaterials) {
-                        BaseMaterials *baseMaterials = static_cast<BaseMaterials *>(it->second);
-
-                        auto update_material = [&](int idx) {
-                            if (pindex[idx] != IdNotSet) {
-                                mesh->mMaterialIndex = baseMaterials->mMaterialIndex[pindex[idx]];
-                            }
-                        };
+void XmlSerializer::ImportTriangles(XmlNode &node, aiMesh *mesh) const {
+    mesh->mNumFaces = static_cast<unsigned int>(CountChildren(node, XmlTag::triangle));
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
 
-                        update_material(0);
-                        update_material(1);
-                        update_material(2);
+    aiFace *nextFace = mesh->mFaces;
+    for (XmlNode currentNode = node.child(XmlTag::triangle); currentNode; currentNode = currentNode.next_sibling(XmlTag::triangle)) {
+        aiFace &face = *nextFace++;
+        int pid = IdNotSet;
+        bool hasPid = false;
+        int pindex[3];
+        ReadTriangle(currentNode, face, pid, hasPid, pindex);
+        if (hasPid && (pindex[0] != IdNotSet || pindex[1] != IdNotSet || pindex[2] != IdNotSet)) {
+            auto it = mResourcesDictionnary.find(pid);
+            if (it != mResourcesDictionnary.end()) {
+                if (it->second->getType() == ResourceType::RT_BaseMaterials) {
+                    BaseMaterials *baseMaterials = static_cast<BaseMaterials *>(it->second);
+
+                    auto update_material = [&](int idx) {
+                        if (pindex[idx] != IdNotSet) {
+                            mesh->mMaterialIndex = baseMaterials->mMaterialIndex[pindex[idx]];
+                        }
+                    };
+
+                    update_material(0);
+                    update_material(1);
+                    update_material(2);
+
+                } else if (it->second->getType() == ResourceType::RT_Texture2DGroup) {
+                    // Load texture coordinates into mesh, when any
+                    Texture2DGroup *group = static_cast<Texture2DGroup *>(it->second); // fix bug
+                    if (mesh->mTextureCoords[0] == nullptr) {
+                        mesh->mNumUVComponents[0] = 2;
+                        for (unsigned int i = 1; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+                            mesh->mNumUVComponents[i] = 0;
+                        }
 
-                    } else if (it->second->getType() == ResourceType::RT_Texture2DGroup) {
-                        // Load texture coordinates into mesh, when any
-                        Texture2DGroup *group = static_cast<Texture2DGroup *>(it->second); // fix bug
-                        if (mesh->mTextureCoords[0] == nullptr) {
-                            mesh->mNumUVComponents[0] = 2;
-                            for (unsigned int i = 1; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                                mesh->mNumUVComponents[i] = 0;
+                        const std::string name = ai_to_string(group->mTexId);
+                        for (size_t i = 0; i < mMaterials.size(); ++i) {
+                            if (name == mMaterials[i]->GetName().C_Str()) {
+                                mesh->mMaterialIndex = static_cast<unsigned int>(i);
                             }
+                        }
+                        mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+                        for (unsigned int vertex_index = 0; vertex_index < mesh->mNumVertices; vertex_index++) {
+                            mesh->mTextureCoords[0][vertex_index].z = IdNotSet;//mark not set
+                        }
+                    }
 
-                            const std::string name = ai_to_string(group->mTexId);
-                            for (size_t i = 0; i < mMaterials.size(); ++i) {
-                                if (name == mMaterials[i]->GetName().C_Str()) {
-                                    mesh->mMaterialIndex = static_cast<unsigned int>(i);
-                                }
-                            }
-                            mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
-                            for (unsigned int vertex_index = 0; vertex_index < mesh->mNumVertices; vertex_index++) {
-                                mesh->mTextureCoords[0][vertex_index].z = IdNotSet;//mark not set
-                            }
+                    auto update_texture = [&](int idx) {
+                        if (pindex[idx] != IdNotSet) {
+                            size_t vertex_index = face.mIndices[idx];
+                            mesh->mTextureCoords[0][vertex_index] =
+                                    aiVector3D(group->mTex2dCoords[pindex[idx]].x, group->mTex2dCoords[pindex[idx]].y, 0.0f);
                         }
+                    };
 
-                        auto update_texture = [&](int idx) {
-                            if (pindex[idx] != IdNotSet) {
-                                size_t vertex_index = face.mIndices[idx];
-                                mesh->mTextureCoords[0][vertex_index] =
-                                        aiVector3D(group->mTex2dCoords[pindex[idx]].x, group->mTex2dCoords[pindex[idx]].y, 0.0f);
-                            }
-                        };
+                    update_texture(0);
+                    update_texture(1);
+                    update_texture(2);
 
-                        update_texture(0);
-                        update_texture(1);
-                        update_texture(2);
+                } else if (it->second->getType() == ResourceType::RT_ColorGroup) {
+                    // Load vertex color into mesh, when any
+                    ColorGroup *group = static_cast<ColorGroup *>(it->second);
+                    if (mesh->mColors[0] == nullptr) {
+                        mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
+                    }
 
-                    } else if (it->second->getType() == ResourceType::RT_ColorGroup) {
-                        // Load vertex color into mesh, when any
-                        ColorGroup *group = static_cast<ColorGroup *>(it->second);
-                        if (mesh->mColors[0] == nullptr) {
-                            mesh->mColors[0] = new aiColor4D[mesh->mNumVertices];
+                    auto update_color = [&](int idx) {
+                        if (pindex[idx] != IdNotSet) {
+                            size_t vertex_index = face.mIndices[idx];
+                            mesh->mColors[0][vertex_index] = group->mColors[pindex[idx]];
                         }
+                    };
 
-                        auto update_color = [&](int idx) {
-                            if (pindex[idx] != IdNotSet) {
-                                size_t vertex_index = face.mIndices[idx];
-                                mesh->mColors[0][vertex_index] = group->mColors[pindex[idx]];
-                            }
-                        };
-
-                        update_color(0);
-                        update_color(1);
-                        update_color(2);
-                    }
+                    update_color(0);
+                    update_color(1);
+                    update_color(2);
                 }
             }
-
-            faces.push_back(face);
         }
     }
-
-    mesh->mNumFaces = static_cast<unsigned int>(faces.size());
-    mesh->mFaces = new aiFace[mesh->mNumFaces];
-    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
-
-    std::copy(faces.begin(), faces.end(), mesh->mFaces);
 }
 
 void XmlSerializer::ReadBaseMaterials(XmlNode &node) {
@@ -67,11 +67,12 @@ public:
 
 private:
     void addObjectToNode(aiNode *parent, Object *obj, aiMatrix4x4 nodeTransform);
-    void ReadObject(XmlNode &node);
-    aiMesh *ReadMesh(XmlNode &node);
+    void ReadObjects(std::vector<XmlNode> &nodes);
+    Object *ReadObject(XmlNode &node) const;
+    aiMesh *ReadMesh(XmlNode &node) const;
     void ReadMetadata(XmlNode &node);
-    void ImportVertices(XmlNode &node, aiMesh *mesh);
-    void ImportTriangles(XmlNode &node, aiMesh *mesh);
+    void ImportVertices(XmlNode &node, aiMesh *mesh) const;
+    void ImportTriangles(XmlNode &node, aiMesh *mesh) const;
     void ReadBaseMaterials(XmlNode &node);
     void ReadEmbeddecTexture(XmlNode &node);
     void StoreEmbeddedTexture(EmbeddedTexture *tex);
@@ -163,6 +163,7 @@ void DNAParser::Parse() {
 
             f.name = names[j];
             f.flags = 0u;
+            f.type_index = static_cast<size_t>(-1);
 
             // pointers always specify the size of the pointee instead of their own.
             // The pointer asterisk remains a property of the lookup name.
@@ -205,6 +206,37 @@ void DNAParser::Parse() {
 
     dna.AddPrimitiveStructures();
     dna.RegisterConverters();
+
+    // resolve the field types and build the field name tables once so
+    // conversion needn't look them up by name
+    for (Structure &s : dna.structures) {
+        s.BuildFieldTable();
+        for (Field &f : s.fields) {
+            std::map<std::string, size_t>::const_iterator it = dna.indices.find(f.type);
+            if (it != dna.indices.end()) {
+                f.type_index = (*it).second;
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Structure::BuildFieldTable() {
+    size_t tableSize = 1;
+    while (tableSize < fields.size() * 2) {
+        tableSize <<= 1;
+    }
+    field_table.assign(tableSize, 0u);
+
+    const size_t mask = tableSize - 1;
+    for (size_t i = 0; i < fields.size(); ++i) {
+        // like `indices`, a later field of the same name replaces the earlier one
+        size_t slot = HashFieldName(fields[i].name.c_str()) & mask;
+        while (field_table[slot] && fields[field_table[slot] - 1].name != fields[i].name) {
+            slot = (slot + 1) & mask;
+        }
+        field_table[slot] = static_cast<uint32_t>(i + 1);
+    }
 }
 
 #if ASSIMP_BUILD_BLENDER_DEBUG_DNA
@@ -294,26 +326,31 @@ void DNA ::AddPrimitiveStructures() {
     indices["int"] = structures.size();
     structures.push_back(Structure());
     structures.back().name = "int";
+    structures.back().primitive = PrimitiveType_Int;
     structures.back().size = 4;
 
     indices["short"] = structures.size();
     structures.push_back(Structure());
     structures.back().name = "short";
+    structures.back().primitive = PrimitiveType_Short;
     structures.back().size = 2;
 
     indices["char"] = structures.size();
     structures.push_back(Structure());
     structures.back().name = "char";
+    structures.back().primitive = PrimitiveType_Char;
     structures.back().size = 1;
 
     indices["float"] = structures.size();
     structures.push_back(Structure());
     structures.back().name = "float";
+    structures.back().primitive = PrimitiveType_Float;
     structures.back().size = 4;
 
     indices["double"] = structures.size();
     structures.push_back(Structure());
     structures.back().name = "double";
+    structures.back().primitive = PrimitiveType_Double;
     structures.back().size = 8;
 
     // no long, seemingly.
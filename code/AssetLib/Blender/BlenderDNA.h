@@ -171,6 +171,19 @@ enum FieldFlags {
     FieldFlag_Array = 0x2
 };
 
+// -------------------------------------------------------------------------------
+/** Primitive types the DNA knows how to convert directly, see
+ *  DNA::AddPrimitiveStructures() */
+// -------------------------------------------------------------------------------
+enum PrimitiveType {
+    PrimitiveType_None,
+    PrimitiveType_Int,
+    PrimitiveType_Short,
+    PrimitiveType_Char,
+    PrimitiveType_Float,
+    PrimitiveType_Double
+};
+
 // -------------------------------------------------------------------------------
 /** Represents a single member of a data structure in a BLEND file */
 // -------------------------------------------------------------------------------
@@ -187,6 +200,10 @@ struct Field {
 
     /** Any of the #FieldFlags enumerated values */
     unsigned int flags;
+
+    /** Index of the structure describing #type in DNA::structures,
+     *  resolved once after parsing. -1 if the type is unknown. */
+    size_t type_index;
 };
 
 // -------------------------------------------------------------------------------
@@ -221,6 +238,8 @@ class Structure {
 
 public:
     Structure() :
+            size(),
+            primitive(PrimitiveType_None),
             cache_idx(static_cast<size_t>(-1)) {
         // empty
     }
@@ -232,6 +251,9 @@ public:
 
     size_t size;
 
+    /** Set for the dummy structures standing in for primitive types */
+    PrimitiveType primitive;
+
     // --------------------------------------------------------
     /** Access a field of the structure by its canonical name. The pointer version
      *  returns nullptr on failure while the reference version raises an import error. */
@@ -242,6 +264,17 @@ public:
     /** Access a field of the structure by its index */
     inline const Field &operator[](const size_t i) const;
 
+    // --------------------------------------------------------
+    /** Access a field by its canonical name through the table built
+     *  by BuildFieldTable(), raises an import error on failure. Used
+     *  by the ReadField family, needs no temporary std::string. */
+    inline const Field &LookupField(const char *name) const;
+
+    // --------------------------------------------------------
+    /** Build the name table used by LookupField(). Called by the
+     *  DNA parser once all fields of the structure are known. */
+    void BuildFieldTable();
+
     // --------------------------------------------------------
     inline bool operator==(const Structure &other) const {
         return name == other.name; // name is meant to be an unique identifier
@@ -392,8 +425,15 @@ private:
         }
     };
 
+    // --------------------------------------------------------
+    static inline uint32_t HashFieldName(const char *name);
+
 private:
     mutable size_t cache_idx;
+
+    // open addressing hash table over the field names, holds
+    // field index + 1 and 0 for empty slots. At most half full.
+    std::vector<uint32_t> field_table;
 };
 
 // --------------------------------------------------------
@@ -472,6 +512,12 @@ public:
     /** Access a structure by its index */
     inline const Structure &operator[](const size_t i) const;
 
+    // --------------------------------------------------------
+    /** Access the structure describing the type of a field. Uses
+     *  the index resolved at parse time and falls back to the
+     *  name lookup (which raises an error) for unknown types. */
+    inline const Structure &GetFieldType(const Field &f) const;
+
 public:
     // --------------------------------------------------------
     /** Add structure definitions for all the primitive types,
@@ -70,6 +70,32 @@ const Field* Structure :: Get (const std::string& ss) const
     return it == indices.end() ? nullptr : &fields[(*it).second];
 }
 
+//--------------------------------------------------------------------------------
+uint32_t Structure :: HashFieldName (const char* name)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (; *name; ++name) {
+        hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+    }
+    return hash;
+}
+
+//--------------------------------------------------------------------------------
+const Field& Structure :: LookupField (const char* name) const
+{
+    if (!field_table.empty()) {
+        const size_t mask = field_table.size() - 1;
+        for (size_t slot = HashFieldName(name) & mask; field_table[slot]; slot = (slot + 1) & mask) {
+            const Field& f = fields[field_table[slot] - 1];
+            if (f.name == name) {
+                return f;
+            }
+        }
+    }
+    throw Error("BlendDNA: Did not find a field named `",name,"` in structure `",this->name,"`");
+}
+
 //--------------------------------------------------------------------------------
 const Field& Structure :: operator [] (const size_t i) const
 {
@@ -100,8 +126,8 @@ void Structure :: ReadFieldArray(T (& out)[M], const char* name, const FileDatab
 {
     const StreamReaderAny::pos old = db.reader->GetCurrentPos();
     try {
-        const Field& f = (*this)[name];
-        const Structure& s = db.dna[f.type];
+        const Field& f = LookupField(name);
+        const Structure& s = db.dna.GetFieldType(f);
 
         // is the input actually an array?
         if (!(f.flags & FieldFlag_Array)) {
@@ -137,8 +163,8 @@ void Structure :: ReadFieldArray2(T (& out)[M][N], const char* name, const FileD
 {
     const StreamReaderAny::pos old = db.reader->GetCurrentPos();
     try {
-        const Field& f = (*this)[name];
-        const Structure& s = db.dna[f.type];
+        const Field& f = LookupField(name);
+        const Structure& s = db.dna.GetFieldType(f);
 
         // is the input actually an array?
         if (!(f.flags & FieldFlag_Array)) {
@@ -185,7 +211,7 @@ bool Structure :: ReadFieldPtr(TOUT<T>& out, const char* name, const FileDatabas
     Pointer ptrval;
     const Field* f;
     try {
-        f = &(*this)[name];
+        f = &LookupField(name);
 
         // sanity check, should never happen if the genblenddna script is right
         if (!(f->flags & FieldFlag_Pointer)) {
@@ -230,7 +256,7 @@ bool Structure :: ReadFieldPtr(TOUT<T> (&out)[N], const char* name,
     Pointer ptrval[N];
     const Field* f;
     try {
-        f = &(*this)[name];
+        f = &LookupField(name);
 
 #ifdef _DEBUG
         // sanity check, should never happen if the genblenddna script is right
@@ -282,9 +308,9 @@ void Structure :: ReadField(T& out, const char* name, const FileDatabase& db) co
 {
     const StreamReaderAny::pos old = db.reader->GetCurrentPos();
     try {
-        const Field& f = (*this)[name];
+        const Field& f = LookupField(name);
         // find the structure definition pertaining to this field
-        const Structure& s = db.dna[f.type];
+        const Structure& s = db.dna.GetFieldType(f);
 
         db.reader->IncPtr(f.offset);
         s.Convert(out,db);
@@ -312,7 +338,7 @@ bool Structure::ReadCustomDataPtr(std::shared_ptr<ElemBase>&out, int cdtype, con
 	Pointer ptrval;
 	const Field* f;
 	try	{
-		f = &(*this)[name];
+		f = &LookupField(name);
 
 		// sanity check, should never happen if the genblenddna script is right
 		if (!(f->flags & FieldFlag_Pointer)) {
@@ -359,7 +385,7 @@ bool Structure::ReadFieldPtrVector(vector<TOUT<T>>&out, const char* name, const
 	Pointer ptrval;
 	const Field* f;
 	try	{
-		f = &(*this)[name];
+		f = &LookupField(name);
 
 		// sanity check, should never happen if the genblenddna script is right
 		if (!(f->flags & FieldFlag_Pointer)) {
@@ -386,7 +412,7 @@ bool Structure::ReadFieldPtrVector(vector<TOUT<T>>&out, const char* name, const
 		// FIXME: basically, this could cause problems with 64 bit pointers on 32 bit systems.
 		// I really ought to improve StreamReader to work with 64 bit indices exclusively.
 
-		const Structure& s = db.dna[f->type];
+		const Structure& s = db.dna.GetFieldType(*f);
 		for (size_t i = 0; i < block->num; ++i)	{
 			TOUT<T> p(new T);
 			s.Convert(*p, db);
@@ -414,7 +440,7 @@ bool Structure :: ResolvePointer(TOUT<T>& out, const Pointer & ptrval, const Fil
     if (!ptrval.val) {
         return false;
     }
-    const Structure& s = db.dna[f.type];
+    const Structure& s = db.dna.GetFieldType(f);
     // find the file block the pointer is pointing to
     const FileBlockHead* block = LocateFileBlockForAddress(ptrval,db);
 
@@ -605,11 +631,14 @@ const FileBlockHead* Structure :: LocateFileBlockForAddress(const Pointer & ptrv
     // We don't need to make this distinction, our algorithm
     // works regardless where the data is stored.
     vector<FileBlockHead>::const_iterator it = std::lower_bound(db.entries.begin(),db.entries.end(),ptrval);
-    if (it == db.entries.end()) {
-        // this is crucial, pointers may not be invalid.
-        // this is either a corrupted file or an attempted attack.
-        throw DeadlyImportError("Failure resolving pointer 0x",
-            std::hex,ptrval.val,", no file block falls into this address range");
+    if (it == db.entries.end() || ptrval < (*it).address) {
+        // no block starts exactly at this address, so the pointer can only
+        // point into the block right before the insertion position.
+        if (it == db.entries.begin()) {
+            throw DeadlyImportError("Failure resolving pointer 0x",
+                std::hex,ptrval.val,", no file block falls into this address range");
+        }
+        --it;
     }
     if (ptrval.val >= (*it).address.val + (*it).size) {
         throw DeadlyImportError("Failure resolving pointer 0x",
@@ -652,22 +681,23 @@ template <> struct static_cast_silent<double> {
 // ------------------------------------------------------------------------------------------------
 template <typename T> inline void ConvertDispatcher(T& out, const Structure& in,const FileDatabase& db)
 {
-    if (in.name == "int") {
+    switch (in.primitive) {
+    case PrimitiveType_Int:
         out = static_cast_silent<T>()(db.reader->GetU4());
-    }
-    else if (in.name == "short") {
+        break;
+    case PrimitiveType_Short:
         out = static_cast_silent<T>()(db.reader->GetU2());
-    }
-    else if (in.name == "char") {
+        break;
+    case PrimitiveType_Char:
         out = static_cast_silent<T>()(db.reader->GetU1());
-    }
-    else if (in.name == "float") {
+        break;
+    case PrimitiveType_Float:
         out = static_cast<T>(db.reader->GetF4());
-    }
-    else if (in.name == "double") {
+        break;
+    case PrimitiveType_Double:
         out = static_cast<T>(db.reader->GetF8());
-    }
-    else {
+        break;
+    default:
         throw DeadlyImportError("Unknown source for conversion to primitive data type: ", in.name);
     }
 }
@@ -682,7 +712,7 @@ template <> inline void Structure :: Convert<int>    (int& dest,const FileDataba
 template<> inline void Structure :: Convert<short>  (short& dest,const FileDatabase& db) const
 {
     // automatic rescaling from short to float and vice versa (seems to be used by normals)
-    if (name == "float") {
+    if (primitive == PrimitiveType_Float) {
         float f = db.reader->GetF4();
         if ( f > 1.0f )
             f = 1.0f;
@@ -690,7 +720,7 @@ template<> inline void Structure :: Convert<short>  (short& dest,const FileDatab
         //db.reader->IncPtr(-4);
         return;
     }
-    else if (name == "double") {
+    else if (primitive == PrimitiveType_Double) {
         dest = static_cast<short>(db.reader->GetF8() * 32767.);
         //db.reader->IncPtr(-8);
         return;
@@ -702,11 +732,11 @@ template<> inline void Structure :: Convert<short>  (short& dest,const FileDatab
 template <> inline void Structure :: Convert<char>   (char& dest,const FileDatabase& db) const
 {
     // automatic rescaling from char to float and vice versa (seems useful for RGB colors)
-    if (name == "float") {
+    if (primitive == PrimitiveType_Float) {
         dest = static_cast<char>(db.reader->GetF4() * 255.f);
         return;
     }
-    else if (name == "double") {
+    else if (primitive == PrimitiveType_Double) {
         dest = static_cast<char>(db.reader->GetF8() * 255.f);
         return;
     }
@@ -717,11 +747,11 @@ template <> inline void Structure :: Convert<char>   (char& dest,const FileDatab
 template <> inline void Structure::Convert<unsigned char>(unsigned char& dest, const FileDatabase& db) const
 {
 	// automatic rescaling from char to float and vice versa (seems useful for RGB colors)
-	if (name == "float") {
+	if (primitive == PrimitiveType_Float) {
 		dest = static_cast<unsigned char>(db.reader->GetF4() * 255.f);
 		return;
 	}
-	else if (name == "double") {
+	else if (primitive == PrimitiveType_Double) {
 		dest = static_cast<unsigned char>(db.reader->GetF8() * 255.f);
 		return;
 	}
@@ -733,12 +763,12 @@ template <> inline void Structure::Convert<unsigned char>(unsigned char& dest, c
 template <> inline void Structure :: Convert<float>  (float& dest,const FileDatabase& db) const
 {
     // automatic rescaling from char to float and vice versa (seems useful for RGB colors)
-    if (name == "char") {
+    if (primitive == PrimitiveType_Char) {
         dest = db.reader->GetI1() / 255.f;
         return;
     }
     // automatic rescaling from short to float and vice versa (used by normals)
-    else if (name == "short") {
+    else if (primitive == PrimitiveType_Short) {
         dest = db.reader->GetI2() / 32767.f;
         return;
     }
@@ -748,11 +778,11 @@ template <> inline void Structure :: Convert<float>  (float& dest,const FileData
 // ------------------------------------------------------------------------------------------------
 template <> inline void Structure :: Convert<double> (double& dest,const FileDatabase& db) const
 {
-    if (name == "char") {
+    if (primitive == PrimitiveType_Char) {
         dest = db.reader->GetI1() / 255.;
         return;
     }
-    else if (name == "short") {
+    else if (primitive == PrimitiveType_Short) {
         dest = db.reader->GetI2() / 32767.;
         return;
     }
@@ -799,6 +829,16 @@ const Structure& DNA :: operator [] (const size_t i) const
     return structures[i];
 }
 
+//--------------------------------------------------------------------------------
+const Structure& DNA :: GetFieldType (const Field& f) const
+{
+    if (f.type_index < structures.size()) {
+        return structures[f.type_index];
+    }
+
+    return (*this)[f.type];
+}
+
 //--------------------------------------------------------------------------------
 template <template <typename> class TOUT> template <typename T> void ObjectCache<TOUT> :: get (
     const Structure& s,
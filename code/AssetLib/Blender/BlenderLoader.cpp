@@ -66,7 +66,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // zlib is needed for compressed blend files
 #ifndef ASSIMP_BUILD_NO_COMPRESSED_BLEND
-#include "Common/Compression.h"
+#include "Common/CompressedIOStream.h"
 #endif
 
 namespace Assimp {
@@ -139,6 +139,25 @@ void BlenderImporter::InternReadFile(const std::string &pFile,
     }
     std::shared_ptr<IOStream> stream = std::move(streamOrError.stream);
 
+#ifndef ASSIMP_BUILD_NO_COMPRESSED_BLEND
+    // StreamReaderAny needs the size up front and copies everything anyway, so
+    // inflate compressed files in a single pass instead of once to measure them
+    // and once more to read them
+    std::vector<char> uncompressed;
+    if (const CompressedIOStream *compressed = dynamic_cast<CompressedIOStream *>(stream.get())) {
+        static constexpr size_t BlockSize = 1024 * 1024;
+        uncompressed.reserve(compressed->SizeHint());
+        size_t read = 0;
+        do {
+            const size_t size = uncompressed.size();
+            uncompressed.resize(size + BlockSize);
+            read = stream->Read(uncompressed.data() + size, 1, BlockSize);
+            uncompressed.resize(size + read);
+        } while (read == BlockSize);
+        stream = std::make_shared<MemoryIOStream>(reinterpret_cast<uint8_t *>(uncompressed.data()), uncompressed.size());
+    }
+#endif
+
     char version[4] = { 0 };
     file.i64bit = (stream->Read(version, 1, 1), version[0] == '-');
     file.little = (stream->Read(version, 1, 1), version[0] == 'v');
@@ -1290,51 +1309,41 @@ aiNode *BlenderImporter::ConvertNode(const Scene &in, const Object *obj, Convers
 BlenderImporter::StreamOrError BlenderImporter::ParseMagicToken(const std::string &pFile, IOSystem *pIOHandler) const {
     std::shared_ptr<IOStream> stream(pIOHandler->Open(pFile, "rb"));
     if (stream == nullptr) {
-        return {{}, {}, "Could not open file for reading"};
+        return {{}, "Could not open file for reading"};
     }
 
     char magic[8] = { 0 };
     stream->Read(magic, 7, 1);
     if (strcmp(magic, Token) == 0) {
-        return {stream, {}, {}};
+        return {stream, {}};
     }
 
     // Check for presence of the gzip header. If yes, assume it is a
     // compressed blend file and try uncompressing it, else fail. This is to
     // avoid uncompressing random files which our loader might end up with.
 #ifdef ASSIMP_BUILD_NO_COMPRESSED_BLEND
-    return {{}, {}, "BLENDER magic bytes are missing, is this file compressed (Assimp was built without decompression support)?"};
+    return {{}, "BLENDER magic bytes are missing, is this file compressed (Assimp was built without decompression support)?"};
 #else
     if (magic[0] != 0x1f || static_cast<uint8_t>(magic[1]) != 0x8b) {
-        return {{}, {}, "BLENDER magic bytes are missing, couldn't find GZIP header either"};
+        return {{}, "BLENDER magic bytes are missing, couldn't find GZIP header either"};
     }
 
     LogDebug("Found no BLENDER magic word but a GZIP header, might be a compressed file");
     if (magic[2] != 8) {
-        return {{}, {}, "Unsupported GZIP compression method"};
+        return {{}, "Unsupported GZIP compression method"};
     }
 
     // http://www.gzip.org/zlib/rfc-gzip.html#header-trailer
+    // decompress on the fly instead of inflating the whole file up front
     stream->Seek(0L, aiOrigin_SET);
-    std::shared_ptr<StreamReaderLE> reader = std::shared_ptr<StreamReaderLE>(new StreamReaderLE(stream));
-
-    size_t total = 0;
-    Compression compression;
-    auto uncompressed = std::make_shared<std::vector<char>>();
-    if (compression.open(Compression::Format::Binary, Compression::FlushMode::NoFlush, 16 + Compression::MaxWBits)) {
-        total = compression.decompress((unsigned char *)reader->GetPtr(), reader->GetRemainingSize(), *uncompressed);
-        compression.close();
-    }
-
-    // replace the input stream with a memory stream
-    stream = std::make_shared<MemoryIOStream>(reinterpret_cast<uint8_t *>(uncompressed->data()), total);
+    stream = std::make_shared<CompressedIOStream>(stream, CompressedIOStream::Container::GZip);
 
     // .. and retry
     stream->Read(magic, 7, 1);
     if (strcmp(magic, Token) == 0) {
-        return {stream, uncompressed, {}};
+        return {stream, {}};
     }
-    return {{}, {}, "Found no BLENDER magic word in decompressed GZIP file"};
+    return {{}, "Found no BLENDER magic word in decompressed GZIP file"};
 #endif
 }
 
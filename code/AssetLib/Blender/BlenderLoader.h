@@ -183,12 +183,11 @@ private:
     // TODO: Move to a std::variant, once c++17 is supported.
     struct StreamOrError {
         std::shared_ptr<IOStream> stream;
-        std::shared_ptr<std::vector<char>> input;
         std::string error;
     };
 
-    // Returns either a stream (and optional input data for the stream) or
-    // an error if it can't parse the magic token.
+    // Returns either a stream (decompressing on the fly for gzipped files)
+    // or an error if it can't parse the magic token.
     StreamOrError ParseMagicToken(
             const std::string &pFile,
             IOSystem *pIOHandler) const;
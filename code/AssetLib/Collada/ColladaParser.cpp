@@ -2242,6 +2242,14 @@ void ColladaParser::ReadMaterialVertexInputBinding(XmlNode &node, Collada::Seman
 
 void ColladaParser::ReadEmbeddedTextures(ZipArchiveIOSystem &zip_archive) {
     // Attempt to load any undefined Collada::Image in ImageLibrary
+    std::vector<std::string> file_list;
+    for (const auto &it : mImageLibrary) {
+        if (it.second.mImageData.empty()) {
+            file_list.push_back(it.second.mFileName);
+        }
+    }
+    zip_archive.prefetch(file_list);
+
     for (auto &it : mImageLibrary) {
         if (Image &image = it.second; image.mImageData.empty()) {
             std::unique_ptr<IOStream> image_file(zip_archive.Open(image.mFileName.c_str()));
@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXParser.h"
 #include "FBXProperties.h"
 #include "FBXUtil.h"
+#include "Common/ParallelFor.h"
 
 #include <assimp/MathFunctions.h>
 #include <assimp/StringComparison.h>
@@ -2708,21 +2709,62 @@ void FBXConverter::ConvertAnimationStack(const AnimationStack &st) {
         stop_time = 9223372036854775807ll - 20000;
     }
 
+    // the curves are resolved lazily, do this up front since the node
+    // animations are generated concurrently
+    std::vector<const NodeMap::value_type *> animated_nodes;
+    animated_nodes.reserve(node_map.size());
+    for (const NodeMap::value_type &kv : node_map) {
+        animated_nodes.push_back(&kv);
+        for (const AnimationCurveNode *node : kv.second) {
+            node->Curves();
+        }
+    }
+
+    struct NodeAnimations {
+        std::vector<aiNodeAnim *> anims;
+        unsigned int chain_bits = 0;
+        double max_time = -1e10;
+        double min_time = 1e10;
+    };
+    std::vector<NodeAnimations> results(animated_nodes.size());
+
+    auto convert = [&](size_t i) {
+        NodeAnimations &result = results[i];
+        result.chain_bits = GenerateNodeAnimations(result.anims,
+                animated_nodes[i]->first,
+                animated_nodes[i]->second,
+                layer_map,
+                start_time, stop_time,
+                result.max_time,
+                result.min_time);
+    };
+
     try {
-        for (const NodeMap::value_type &kv : node_map) {
-            GenerateNodeAnimations(node_anims,
-                    kv.first,
-                    kv.second,
-                    layer_map,
-                    start_time, stop_time,
-                    max_time,
-                    min_time);
+        // the conversion logs warnings, only go parallel if the application asked for it
+        if (doc.Settings().parallelAnimations) {
+            ParallelFor(animated_nodes.size(), convert);
+        } else {
+            for (size_t i = 0; i < animated_nodes.size(); ++i) {
+                convert(i);
+            }
         }
     } catch (std::exception &) {
-        std::for_each(node_anims.begin(), node_anims.end(), Util::delete_fun<aiNodeAnim>());
+        for (NodeAnimations &result : results) {
+            std::for_each(result.anims.begin(), result.anims.end(), Util::delete_fun<aiNodeAnim>());
+        }
         throw;
     }
 
+    for (size_t i = 0; i < results.size(); ++i) {
+        const NodeAnimations &result = results[i];
+        node_anims.insert(node_anims.end(), result.anims.begin(), result.anims.end());
+        if (result.chain_bits) {
+            node_anim_chain_bits[animated_nodes[i]->first] = result.chain_bits;
+        }
+        max_time = std::max(max_time, result.max_time);
+        min_time = std::min(min_time, result.min_time);
+    }
+
     if (node_anims.size() || morphAnimDatas.size()) {
         if (node_anims.size()) {
             anim->mChannels = new aiNodeAnim *[node_anims.size()]();
@@ -2876,7 +2918,7 @@ static void validateAnimCurveNodes(const std::vector<const AnimationCurveNode *>
 #endif // ASSIMP_BUILD_DEBUG
 
 // ------------------------------------------------------------------------------------------------
-void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
+unsigned int FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
         const std::string &fixed_name,
         const std::vector<const AnimationCurveNode *> &curves,
         const LayerMap &layer_map,
@@ -2950,7 +2992,7 @@ void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
 
     if (!has_any) {
         FBXImporter::LogWarn("ignoring node animation, did not find any transformation key frames");
-        return;
+        return 0;
     }
 
     // this needs to play nicely with GenerateTransformationNodeChain() which will
@@ -2971,7 +3013,7 @@ void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
         } else {
             node_anims.push_back(nd);
         }
-        return;
+        return 0;
     }
 
     // otherwise, things get gruesome and we need separate animation channels
@@ -3096,7 +3138,7 @@ void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
         }
     }
 
-    node_anim_chain_bits[fixed_name] = flags;
+    return flags;
 }
 
 bool FBXConverter::IsRedundantAnimationData(const Model &target,
@@ -3494,25 +3536,24 @@ KeyTimeList FBXConverter::GetKeyTimeList(const KeyFrameListList &inputs) {
     // be a good estimate.
     KeyTimeList keys;
 
+    const size_t count = inputs.size();
+    std::vector<const int64_t *> next(count), end(count);
     size_t estimate = 0;
-    for (const KeyFrameList &kfl : inputs) {
-        estimate = std::max(estimate, std::get<0>(kfl)->size());
+    for (size_t i = 0; i < count; ++i) {
+        const KeyTimeList &times = *std::get<0>(inputs[i]);
+        next[i] = times.data();
+        end[i] = times.data() + times.size();
+        estimate = std::max(estimate, times.size());
     }
 
     keys.reserve(estimate);
 
-    std::vector<unsigned int> next_pos;
-    next_pos.resize(inputs.size(), 0);
-
-    const size_t count = inputs.size();
+    // merge the sorted lists, skipping duplicates
     while (true) {
-
         int64_t min_tick = std::numeric_limits<int64_t>::max();
         for (size_t i = 0; i < count; ++i) {
-            const KeyFrameList &kfl = inputs[i];
-
-            if (std::get<0>(kfl)->size() > next_pos[i] && std::get<0>(kfl)->at(next_pos[i]) < min_tick) {
-                min_tick = std::get<0>(kfl)->at(next_pos[i]);
+            if (next[i] != end[i] && *next[i] < min_tick) {
+                min_tick = *next[i];
             }
         }
 
@@ -3522,10 +3563,8 @@ KeyTimeList FBXConverter::GetKeyTimeList(const KeyFrameListList &inputs) {
         keys.push_back(min_tick);
 
         for (size_t i = 0; i < count; ++i) {
-            const KeyFrameList &kfl = inputs[i];
-
-            while (std::get<0>(kfl)->size() > next_pos[i] && std::get<0>(kfl)->at(next_pos[i]) == min_tick) {
-                ++next_pos[i];
+            while (next[i] != end[i] && *next[i] == min_tick) {
+                ++next[i];
             }
         }
     }
@@ -3533,60 +3572,66 @@ KeyTimeList FBXConverter::GetKeyTimeList(const KeyFrameListList &inputs) {
     return keys;
 }
 
-void FBXConverter::InterpolateKeys(aiVectorKey *valOut, const KeyTimeList &keys, const KeyFrameListList &inputs,
+void FBXConverter::ResampleCurves(const KeyTimeList &keys, const KeyFrameListList &inputs,
         const aiVector3D &def_value,
-        double &max_time,
-        double &min_time) {
-    ai_assert(!keys.empty());
-    ai_assert(nullptr != valOut);
-
-    std::vector<unsigned int> next_pos;
-    const size_t count(inputs.size());
-
-    next_pos.resize(inputs.size(), 0);
-
-    for (KeyTimeList::value_type time : keys) {
-        ai_real result[3] = { def_value.x, def_value.y, def_value.z };
+        std::vector<ai_real> (&out)[3]) {
+    const size_t count = keys.size();
+    for (unsigned int c = 0; c < 3; ++c) {
+        out[c].assign(count, def_value[c]);
+    }
 
-        for (size_t i = 0; i < count; ++i) {
-            const KeyFrameList &kfl = inputs[i];
+    std::vector<uint32_t> id0(count), id1(count);
+    for (const KeyFrameList &kfl : inputs) {
+        const KeyTimeList &times = *std::get<0>(kfl);
+        const KeyValueList &values = *std::get<1>(kfl);
+        const size_t ksize = times.size();
+        if (ksize == 0) {
+            continue;
+        }
 
-            const size_t ksize = std::get<0>(kfl)->size();
-            if (ksize == 0) {
-                continue;
+        // advance the cursor of this curve over the merged key times, the
+        // curve's own key times are a subset of them
+        const int64_t *const t = times.data();
+        const float *const v = values.data();
+        size_t next_pos = 0;
+        for (size_t k = 0; k < count; ++k) {
+            if (next_pos < ksize && t[next_pos] == keys[k]) {
+                ++next_pos;
             }
-            if (ksize > next_pos[i] && std::get<0>(kfl)->at(next_pos[i]) == time) {
-                ++next_pos[i];
-            }
-
-            const size_t id0 = next_pos[i] > 0 ? next_pos[i] - 1 : 0;
-            const size_t id1 = next_pos[i] == ksize ? ksize - 1 : next_pos[i];
-
-            // use lerp for interpolation
-            const KeyValueList::value_type valueA = std::get<1>(kfl)->at(id0);
-            const KeyValueList::value_type valueB = std::get<1>(kfl)->at(id1);
-
-            const KeyTimeList::value_type timeA = std::get<0>(kfl)->at(id0);
-            const KeyTimeList::value_type timeB = std::get<0>(kfl)->at(id1);
-
-            const ai_real factor = timeB == timeA ? ai_real(0.) : static_cast<ai_real>((time - timeA)) / (timeB - timeA);
-            const ai_real interpValue = static_cast<ai_real>(valueA + (valueB - valueA) * factor);
-
-            result[std::get<2>(kfl)] = interpValue;
+            id0[k] = static_cast<uint32_t>(next_pos > 0 ? next_pos - 1 : 0);
+            id1[k] = static_cast<uint32_t>(next_pos == ksize ? ksize - 1 : next_pos);
         }
 
-        // magic value to convert fbx times to seconds
-        valOut->mTime = CONVERT_FBX_TIME(time) * anim_fps;
+        // use lerp for interpolation, later curves for the same component take precedence
+        ai_real *const result = out[std::get<2>(kfl)].data();
+        for (size_t k = 0; k < count; ++k) {
+            const KeyTimeList::value_type timeA = t[id0[k]];
+            const KeyTimeList::value_type timeB = t[id1[k]];
+            const ai_real factor = timeB == timeA ? ai_real(0.) : static_cast<ai_real>((keys[k] - timeA)) / (timeB - timeA);
+            result[k] = static_cast<ai_real>(v[id0[k]] + (v[id1[k]] - v[id0[k]]) * factor);
+        }
+    }
+}
 
-        min_time = std::min(min_time, valOut->mTime);
-        max_time = std::max(max_time, valOut->mTime);
+void FBXConverter::InterpolateKeys(aiVectorKey *valOut, const KeyTimeList &keys, const KeyFrameListList &inputs,
+        const aiVector3D &def_value,
+        double &max_time,
+        double &min_time) {
+    ai_assert(!keys.empty());
+    ai_assert(nullptr != valOut);
 
-        valOut->mValue.x = result[0];
-        valOut->mValue.y = result[1];
-        valOut->mValue.z = result[2];
+    std::vector<ai_real> values[3];
+    ResampleCurves(keys, inputs, def_value, values);
 
-        ++valOut;
+    for (size_t i = 0, c = keys.size(); i < c; ++i) {
+        // magic value to convert fbx times to seconds
+        valOut[i].mTime = CONVERT_FBX_TIME(keys[i]) * anim_fps;
+        valOut[i].mValue = aiVector3D(values[0][i], values[1][i], values[2][i]);
     }
+
+    // the key times are sorted
+    min_time = std::min(min_time, valOut[0].mTime);
+    max_time = std::max(max_time, valOut[keys.size() - 1].mTime);
 }
 
 void FBXConverter::InterpolateKeys(aiQuatKey *valOut, const KeyTimeList &keys, const KeyFrameListList &inputs,
@@ -3597,29 +3642,91 @@ void FBXConverter::InterpolateKeys(aiQuatKey *valOut, const KeyTimeList &keys, c
     ai_assert(!keys.empty());
     ai_assert(nullptr != valOut);
 
-    std::unique_ptr<aiVectorKey[]> temp(new aiVectorKey[keys.size()]);
-    InterpolateKeys(temp.get(), keys, inputs, def_value, maxTime, minTime);
-
-    aiMatrix4x4 m;
-
-    aiQuaternion lastq;
+    std::vector<ai_real> values[3];
+    ResampleCurves(keys, inputs, def_value, values);
 
-    for (size_t i = 0, c = keys.size(); i < c; ++i) {
-
-        valOut[i].mTime = temp[i].mTime;
+    const size_t count = keys.size();
+    for (size_t i = 0; i < count; ++i) {
+        valOut[i].mTime = CONVERT_FBX_TIME(keys[i]) * anim_fps;
+    }
+    minTime = std::min(minTime, valOut[0].mTime);
+    maxTime = std::max(maxTime, valOut[count - 1].mTime);
 
-        GetRotationMatrix(order, temp[i].mValue, m);
-        aiQuaternion quat = aiQuaternion(aiMatrix3x3(m));
+    EulerToQuaternions(values[0].data(), values[1].data(), values[2].data(), count, order, valOut);
 
-        // take shortest path by checking the inner product
-        // http://www.3dkingdoms.com/weekly/weekly.php?a=36
+    // take shortest path by checking the inner product
+    // http://www.3dkingdoms.com/weekly/weekly.php?a=36
+    aiQuaternion lastq;
+    for (size_t i = 0; i < count; ++i) {
+        aiQuaternion &quat = valOut[i].mValue;
         if (quat.x * lastq.x + quat.y * lastq.y + quat.z * lastq.z + quat.w * lastq.w < 0) {
             quat.Conjugate();
             quat.w = -quat.w;
         }
         lastq = quat;
+    }
+}
+
+void FBXConverter::EulerToQuaternions(const ai_real *x, const ai_real *y, const ai_real *z, size_t count,
+        Model::RotOrder order, aiQuatKey *out) {
+    if (order == Model::RotOrder_SphericXYZ) {
+        FBXImporter::LogError("Unsupported RotationMode: SphericXYZ");
+        for (size_t i = 0; i < count; ++i) {
+            out[i].mValue = aiQuaternion();
+        }
+        return;
+    }
 
-        valOut[i].mValue = quat;
+    // the axes in the order the rotations are multiplied, see GetRotationMatrix()
+    unsigned int axes[3] = { 2, 1, 0 };
+    switch (order) {
+        case Model::RotOrder_EulerXYZ:
+            break;
+        case Model::RotOrder_EulerXZY:
+            axes[0] = 1, axes[1] = 2, axes[2] = 0;
+            break;
+        case Model::RotOrder_EulerYZX:
+            axes[0] = 0, axes[1] = 2, axes[2] = 1;
+            break;
+        case Model::RotOrder_EulerYXZ:
+            axes[0] = 2, axes[1] = 0, axes[2] = 1;
+            break;
+        case Model::RotOrder_EulerZXY:
+            axes[0] = 1, axes[1] = 0, axes[2] = 2;
+            break;
+        case Model::RotOrder_EulerZYX:
+            axes[0] = 0, axes[1] = 1, axes[2] = 2;
+            break;
+        default:
+            ai_assert(false);
+            break;
+    }
+
+    // sine and cosine of the half angles, per axis
+    const ai_real *const angles[3] = { x, y, z };
+    std::vector<ai_real> half_sin[3], half_cos[3];
+    for (unsigned int a = 0; a < 3; ++a) {
+        half_sin[a].resize(count);
+        half_cos[a].resize(count);
+        const ai_real *const in = angles[a];
+        ai_real *const s = half_sin[a].data();
+        ai_real *const c = half_cos[a].data();
+        for (size_t i = 0; i < count; ++i) {
+            const ai_real half = AI_DEG_TO_RAD(in[i]) * ai_real(0.5);
+            s[i] = std::sin(half);
+            c[i] = std::cos(half);
+        }
+    }
+
+    // compose the rotations about the principal axes
+    for (size_t i = 0; i < count; ++i) {
+        aiQuaternion q;
+        for (const unsigned int a : axes) {
+            aiQuaternion r(half_cos[a][i], 0, 0, 0);
+            (&r.x)[a] = half_sin[a][i];
+            q = q * r;
+        }
+        out[i].mValue = q;
     }
 }
 
@@ -126,6 +126,15 @@ public:
     FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones);
     ~FBXConverter();
 
+    // ------------------------------------------------------------------------------------------------
+    // euler angles in degrees -> rotation matrix
+    ASSIMP_API static void GetRotationMatrix(Model::RotOrder mode, const aiVector3D& rotation, aiMatrix4x4& out);
+
+    // ------------------------------------------------------------------------------------------------
+    // euler xyz -> quat for arrays of angles given in degrees
+    ASSIMP_API static void EulerToQuaternions(const ai_real* x, const ai_real* y, const ai_real* z, size_t count,
+        Model::RotOrder order, aiQuatKey* out);
+
 private:
     // ------------------------------------------------------------------------------------------------
     // find scene root and trigger recursive scene conversion
@@ -167,8 +176,6 @@ private:
     // ------------------------------------------------------------------------------------------------
     aiVector3D TransformationCompDefaultValue(TransformationComp comp);
 
-    // ------------------------------------------------------------------------------------------------
-    void GetRotationMatrix(Model::RotOrder mode, const aiVector3D& rotation, aiMatrix4x4& out);
     // ------------------------------------------------------------------------------------------------
     /**
     *  checks if a node has more than just scaling, rotation and translation components
@@ -315,7 +322,9 @@ private:
         const BlendShapeChannel* bsc, const AnimationCurveNode* node);
 
     // ------------------------------------------------------------------------------------------------
-    void GenerateNodeAnimations(std::vector<aiNodeAnim*>& node_anims,
+    // returns the animated transformation chain components, 0 if a single channel was generated.
+    // Only touches the given outputs, so it can run concurrently for different nodes.
+    unsigned int GenerateNodeAnimations(std::vector<aiNodeAnim*>& node_anims,
         const std::string& fixed_name,
         const std::vector<const AnimationCurveNode*>& curves,
         const LayerMap& layer_map,
@@ -390,6 +399,12 @@ private:
         double& minTime,
         Model::RotOrder order);
 
+    // ------------------------------------------------------------------------------------------------
+    // samples all curves at the given times, one output array per component
+    static void ResampleCurves(const KeyTimeList& keys, const KeyFrameListList& inputs,
+        const aiVector3D& def_value,
+        std::vector<ai_real> (&out)[3]);
+
     // ------------------------------------------------------------------------------------------------
     // euler xyz -> quat
     aiQuaternion EulerToQuaternion(const aiVector3D& rot, Model::RotOrder order);
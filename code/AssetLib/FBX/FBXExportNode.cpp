@@ -163,6 +163,18 @@ void FBX::Node::Dump(
     }
 }
 
+void FBX::Node::CompressArrays(const FBX::ArrayCompression& compression) {
+    if (compression.level <= 0) {
+        return;
+    }
+    for (auto &p : properties) {
+        p.Compress(compression);
+    }
+    for (auto &c : children) {
+        c.CompressArrays(compression);
+    }
+}
+
 
 // public member functions for low-level writing
 
@@ -479,37 +491,55 @@ void FBX::Node::WritePropertyNodeAscii(
 }
 
 // binary property node from vector of doubles
-// TODO: optional zip compression!
 void FBX::Node::WritePropertyNodeBinary(
     const std::string& name,
     const std::vector<double>& v,
-    Assimp::StreamWriterLE& s
+    Assimp::StreamWriterLE& s,
+    const FBX::ArrayCompression& compression
 ){
     FBX::Node node(name);
     node.BeginBinary(s);
     s.PutU1('d');
     s.PutU4(uint32_t(v.size())); // number of elements
-    s.PutU4(0); // no encoding (1 would be zip-compressed)
-    s.PutU4(uint32_t(v.size()) * 8); // data size
-    for (auto it = v.begin(); it != v.end(); ++it) { s.PutF8(*it); }
+    std::vector<char> compressed;
+    if (FBX::FBXExportProperty::CompressArray(
+            reinterpret_cast<const uint8_t*>(v.data()), v.size() * 8, 8,
+            compression, compressed)) {
+        s.PutU4(1); // zip-compressed
+        s.PutU4(uint32_t(compressed.size())); // data size
+        s.PutString(std::string(compressed.begin(), compressed.end()));
+    } else {
+        s.PutU4(0); // no encoding
+        s.PutU4(uint32_t(v.size()) * 8); // data size
+        for (auto it = v.begin(); it != v.end(); ++it) { s.PutF8(*it); }
+    }
     node.EndPropertiesBinary(s, 1);
     node.EndBinary(s, false);
 }
 
 // binary property node from vector of int32_t
-// TODO: optional zip compression!
 void FBX::Node::WritePropertyNodeBinary(
     const std::string& name,
     const std::vector<int32_t>& v,
-    Assimp::StreamWriterLE& s
+    Assimp::StreamWriterLE& s,
+    const FBX::ArrayCompression& compression
 ){
     FBX::Node node(name);
     node.BeginBinary(s);
     s.PutU1('i');
     s.PutU4(uint32_t(v.size())); // number of elements
-    s.PutU4(0); // no encoding (1 would be zip-compressed)
-    s.PutU4(uint32_t(v.size()) * 4); // data size
-    for (auto it = v.begin(); it != v.end(); ++it) { s.PutI4(*it); }
+    std::vector<char> compressed;
+    if (FBX::FBXExportProperty::CompressArray(
+            reinterpret_cast<const uint8_t*>(v.data()), v.size() * 4, 4,
+            compression, compressed)) {
+        s.PutU4(1); // zip-compressed
+        s.PutU4(uint32_t(compressed.size())); // data size
+        s.PutString(std::string(compressed.begin(), compressed.end()));
+    } else {
+        s.PutU4(0); // no encoding
+        s.PutU4(uint32_t(v.size()) * 4); // data size
+        for (auto it = v.begin(); it != v.end(); ++it) { s.PutI4(*it); }
+    }
     node.EndPropertiesBinary(s, 1);
     node.EndBinary(s, false);
 }
@@ -523,10 +553,11 @@ void FBX::Node::WritePropertyNode(
     const std::string& name,
     const std::vector<double>& v,
     Assimp::StreamWriterLE& s,
-    bool binary, int indent
+    bool binary, int indent,
+    const FBX::ArrayCompression& compression
 ){
     if (binary) {
-        FBX::Node::WritePropertyNodeBinary(name, v, s);
+        FBX::Node::WritePropertyNodeBinary(name, v, s, compression);
     } else {
         FBX::Node::WritePropertyNodeAscii(name, v, s, indent);
     }
@@ -539,10 +570,11 @@ void FBX::Node::WritePropertyNode(
     const std::string& name,
     const std::vector<int32_t>& v,
     Assimp::StreamWriterLE& s,
-    bool binary, int indent
+    bool binary, int indent,
+    const FBX::ArrayCompression& compression
 ){
     if (binary) {
-        FBX::Node::WritePropertyNodeBinary(name, v, s);
+        FBX::Node::WritePropertyNodeBinary(name, v, s, compression);
     } else {
         FBX::Node::WritePropertyNodeAscii(name, v, s, indent);
     }
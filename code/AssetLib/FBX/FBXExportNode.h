@@ -151,6 +151,10 @@ public:
             bool binary, int indent);
     void Dump(Assimp::StreamWriterLE &s, bool binary, int indent);
 
+    // compress the array properties of this node and all its children,
+    // affects binary output only.
+    void CompressArrays(const FBX::ArrayCompression& compression);
+
     // these other functions are for writing data piece by piece.
     // they must be used carefully.
     // for usage examples see FBXExporter.cpp.
@@ -176,10 +180,14 @@ public:
         const std::string& name,
         const T value,
         Assimp::StreamWriterLE& s,
-        bool binary, int indent
+        bool binary, int indent,
+        const FBX::ArrayCompression& compression = FBX::ArrayCompression()
     ) {
         FBX::FBXExportProperty p(value);
         FBX::Node node(name, std::move(p));
+        if (binary) {
+            node.CompressArrays(compression);
+        }
         node.Dump(s, binary, indent);
     }
 
@@ -190,7 +198,8 @@ public:
         const std::string& name,
         const std::vector<double>& v,
         Assimp::StreamWriterLE& s,
-        bool binary, int indent
+        bool binary, int indent,
+        const FBX::ArrayCompression& compression = FBX::ArrayCompression()
     );
 
     // convenience function to create and write a property node,
@@ -200,7 +209,8 @@ public:
         const std::string& name,
         const std::vector<int32_t>& v,
         Assimp::StreamWriterLE& s,
-        bool binary, int indent
+        bool binary, int indent,
+        const FBX::ArrayCompression& compression = FBX::ArrayCompression()
     );
 
 private: // internal functions used for writing
@@ -238,12 +248,14 @@ private: // internal functions used for writing
     static void WritePropertyNodeBinary(
         const std::string& name,
         const std::vector<double>& v,
-        Assimp::StreamWriterLE& s
+        Assimp::StreamWriterLE& s,
+        const FBX::ArrayCompression& compression
     );
     static void WritePropertyNodeBinary(
         const std::string& name,
         const std::vector<int32_t>& v,
-        Assimp::StreamWriterLE& s
+        Assimp::StreamWriterLE& s,
+        const FBX::ArrayCompression& compression
     );
 
 private: // data used for binary dumps
@@ -42,9 +42,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_EXPORTER
 
 #include "FBXExportProperty.h"
+#include "Common/Compression.h"
 
 #include <assimp/StreamWriter.h> // StreamWriterLE
 #include <assimp/Exceptional.h> // DeadlyExportError
+#include <assimp/ByteSwapper.h>
 
 #include <string>
 #include <vector>
@@ -180,15 +182,72 @@ size_t FBXExportProperty::size() {
         case 'R':
             return data.size() + 5;
         case 'i':
+        case 'l':
+        case 'f':
         case 'd':
-            return data.size() + 13;
+            return (compressed.empty() ? data.size() : compressed.size()) + 13;
         default:
             throw DeadlyExportError("Requested size on property of unknown type");
     }
 }
 
+void FBXExportProperty::Compress(const ArrayCompression& compression) {
+    compressed.clear();
+    size_t element_size;
+    switch (type) {
+        case 'i':
+        case 'f':
+            element_size = 4;
+            break;
+        case 'l':
+        case 'd':
+            element_size = 8;
+            break;
+        default:
+            return;
+    }
+    CompressArray(data.data(), data.size(), element_size, compression, compressed);
+}
+
+bool FBXExportProperty::CompressArray(
+    const uint8_t* d, size_t size, size_t element_size,
+    const ArrayCompression& compression, std::vector<char>& out
+) {
+    out.clear();
+    if (compression.level <= 0 || size == 0 || size < compression.threshold) {
+        return false;
+    }
+#ifdef AI_BUILD_BIG_ENDIAN
+    // array data is always stored little-endian
+    std::vector<uint8_t> swapped(d, d + size);
+    for (size_t i = 0; i < size; i += element_size) {
+        if (element_size == 8) {
+            ByteSwap::Swap8(swapped.data() + i);
+        } else {
+            ByteSwap::Swap4(swapped.data() + i);
+        }
+    }
+    d = swapped.data();
+#else
+    (void)element_size;
+#endif
+    if (Compression::compress(d, size, compression.level, out) == 0 || out.size() >= size) {
+        out.clear();
+        return false;
+    }
+    return true;
+}
+
 void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
     s.PutU1(type);
+    if (!compressed.empty()) {
+        // all array types share the same layout when compressed
+        s.PutU4(uint32_t(data.size() / (type == 'l' || type == 'd' ? 8 : 4))); // number of elements
+        s.PutU4(1); // zip-compressed
+        s.PutU4(uint32_t(compressed.size())); // data size
+        s.PutString(std::string(compressed.begin(), compressed.end()));
+        return;
+    }
     uint8_t* d = data.data();
     size_t N;
     switch (type) {
@@ -206,8 +265,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'i':
             N = data.size() / 4;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutI4((reinterpret_cast<int32_t*>(d))[i]);
@@ -216,8 +274,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'l':
             N = data.size() / 8;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutI8((reinterpret_cast<int64_t*>(d))[i]);
@@ -226,8 +283,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'f':
             N = data.size() / 4;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutF4((reinterpret_cast<float*>(d))[i]);
@@ -236,8 +292,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'd':
             N = data.size() / 8;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutF8((reinterpret_cast<double*>(d))[i]);
@@ -58,6 +58,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace Assimp {
 namespace FBX {
 
+/** @brief Settings for the zlib compression of array properties
+ *  in binary files, see #AI_CONFIG_EXPORT_FBX_COMPRESSION_LEVEL.
+ */
+struct ArrayCompression {
+    int level = 0; // zlib compression level, 0 disables compression
+    size_t threshold = 0; // smaller arrays (in bytes) are stored as is
+};
+
 /** @brief FBX::Property
  *
  *  Holds a value of any of FBX's recognized types,
@@ -110,6 +118,18 @@ public:
     // the size of this property node in a binary file, in bytes
     size_t size();
 
+    // compress array data for binary output, if it is large enough
+    // and compression actually saves space.
+    void Compress(const ArrayCompression& compression);
+
+    // zlib-compress an array of elements with the given element size,
+    // stored in host byte order. returns false if the array should
+    // rather be stored uncompressed.
+    static bool CompressArray(
+        const uint8_t* d, size_t size, size_t element_size,
+        const ArrayCompression& compression, std::vector<char>& out
+    );
+
     // write this property node as binary data to the given stream
     void DumpBinary(Assimp::StreamWriterLE& s);
     void DumpAscii(Assimp::StreamWriterLE& s, int indent = 0);
@@ -119,6 +139,7 @@ public:
 private:
     char type;
     std::vector<uint8_t> data;
+    std::vector<char> compressed; // binary array data, if compressed
 };
 
 } // Namespace FBX
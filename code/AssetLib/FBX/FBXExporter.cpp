@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/mesh.h>
 
 // Header files, standard library.
+#include <algorithm>
 #include <array>
 #include <ctime> // localtime, tm_*
 #include <map>
@@ -155,10 +156,13 @@ void FBXExporter::ExportBinary (
     // remember that we're exporting in binary mode
     binary = true;
 
-    // we're not currently using these preferences,
-    // but clang will cry about it if we never touch it.
-    // TODO: some of these might be relevant to export
-    (void)mProperties;
+    // large arrays are zlib-compressed, as the FBX SDK does
+    if (mProperties != nullptr) {
+        mArrayCompression.level = mProperties->GetPropertyInteger(
+            AI_CONFIG_EXPORT_FBX_COMPRESSION_LEVEL, AI_FBX_DEFAULT_COMPRESSION_LEVEL);
+        mArrayCompression.threshold = static_cast<size_t>(std::max(0, mProperties->GetPropertyInteger(
+            AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD, AI_FBX_DEFAULT_COMPRESSION_THRESHOLD)));
+    }
 
     // open the indicated file for writing (in binary mode)
     outfile.reset(pIOSystem->Open(pFile,"wb"));
@@ -1268,8 +1272,8 @@ void FBXExporter::WriteObjects () {
         }
 
 
-        FBX::Node::WritePropertyNode("Vertices", flattened_vertices, outstream, binary, indent);
-        FBX::Node::WritePropertyNode("PolygonVertexIndex", polygon_data, outstream, binary, indent);
+        FBX::Node::WritePropertyNode("Vertices", flattened_vertices, outstream, binary, indent, mArrayCompression);
+        FBX::Node::WritePropertyNode("PolygonVertexIndex", polygon_data, outstream, binary, indent, mArrayCompression);
         FBX::Node::WritePropertyNode("GeometryVersion", int32_t(124), outstream, binary, indent);
 
 	if (!normal_data.empty()) {
@@ -1283,7 +1287,7 @@ void FBXExporter::WriteObjects () {
 	    FBX::Node::WritePropertyNode("Name", "", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("ReferenceInformationType", "Direct", outstream, binary, indent);
-	    FBX::Node::WritePropertyNode("Normals", normal_data, outstream, binary, indent);
+	    FBX::Node::WritePropertyNode("Normals", normal_data, outstream, binary, indent, mArrayCompression);
 	    // note: version 102 has a NormalsW also... not sure what it is,
 	    // so stick with version 101 for now.
 	    indent = 2;
@@ -1304,7 +1308,7 @@ void FBXExporter::WriteObjects () {
 	    FBX::Node::WritePropertyNode("Name", (const char *)layerName, outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("ReferenceInformationType", "Direct", outstream, binary, indent);
-	    FBX::Node::WritePropertyNode("Colors", color_data, outstream, binary, indent);
+	    FBX::Node::WritePropertyNode("Colors", color_data, outstream, binary, indent, mArrayCompression);
 	    indent = 2;
 	    vertexcolors.End(outstream, binary, indent, true);
         }
@@ -1320,8 +1324,8 @@ void FBXExporter::WriteObjects () {
           FBX::Node::WritePropertyNode("Name", "", outstream, binary, indent);
           FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
           FBX::Node::WritePropertyNode("ReferenceInformationType", "IndexToDirect", outstream, binary, indent);
-          FBX::Node::WritePropertyNode("UV", uv_data[uvi], outstream, binary, indent);
-          FBX::Node::WritePropertyNode("UVIndex", uv_indices[uvi], outstream, binary, indent);
+          FBX::Node::WritePropertyNode("UV", uv_data[uvi], outstream, binary, indent, mArrayCompression);
+          FBX::Node::WritePropertyNode("UVIndex", uv_indices[uvi], outstream, binary, indent, mArrayCompression);
           indent = 2;
           uv.End(outstream, binary, indent, true);
         }
@@ -1814,16 +1818,19 @@ void FBXExporter::WriteObjects () {
           }
 
           FBX::Node::WritePropertyNode(
-              "Indexes", shape_indices, outstream, binary, indent
+              "Indexes", shape_indices, outstream, binary, indent,
+              mArrayCompression
           );
 
           FBX::Node::WritePropertyNode(
-              "Vertices", pPositionDiff, outstream, binary, indent
+              "Vertices", pPositionDiff, outstream, binary, indent,
+              mArrayCompression
           );
 
           if (pNormalDiff.size()>0) {
             FBX::Node::WritePropertyNode(
-                "Normals", pNormalDiff, outstream, binary, indent
+                "Normals", pNormalDiff, outstream, binary, indent,
+                mArrayCompression
             );
           }
         }
@@ -2111,6 +2118,7 @@ void FBXExporter::WriteObjects () {
             // there's not really any way around this at the moment.
 
             // done
+            sdnode.CompressArrays(mArrayCompression);
             sdnode.Dump(outstream, binary, indent);
 
             // lastly, connect to the parent deformer
@@ -2838,6 +2846,7 @@ void FBXExporter::WriteAnimationCurve(
         "KeyAttrRefCount",
         std::vector<int32_t>{static_cast<int32_t>(times.size())}
     );
+    n.CompressArrays(mArrayCompression);
     n.Dump(outstream, binary, 1);
     this->connections.emplace_back(
         "C", "OP", curve_uid, curvenode_uid, property_link
@@ -85,7 +85,8 @@ namespace Assimp {
     private:
         bool binary; // whether current export is in binary or ascii format
         const aiScene* mScene; // the scene to export
-        const ExportProperties* mProperties; // currently unused
+        const ExportProperties* mProperties; // export settings
+        FBX::ArrayCompression mArrayCompression; // binary array compression
         std::shared_ptr<IOStream> outfile; // file to write to
 
         std::vector<FBX::Node> connections; // connection storage
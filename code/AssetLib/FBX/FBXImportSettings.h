@@ -159,6 +159,9 @@ struct ImportSettings {
 
     // Set to true to ignore the axis configuration in the file
     bool ignoreUpDirection = false;
+
+    // Set to true to convert the animations of different nodes on worker threads
+    bool parallelAnimations = false;
 };
 
 } // namespace FBX
@@ -119,6 +119,7 @@ void FBXImporter::SetupProperties(const Importer *pImp) {
     mSettings.convertToMeters = pImp->GetPropertyBool(AI_CONFIG_FBX_CONVERT_TO_M, false);
     mSettings.ignoreUpDirection = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_IGNORE_UP_DIRECTION, false);
     mSettings.useSkeleton = pImp->GetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, false);
+    mSettings.parallelAnimations = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_PARALLEL_ANIMATIONS, false);
 }
 
 // ------------------------------------------------------------------------------------------------
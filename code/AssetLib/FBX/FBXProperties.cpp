@@ -51,6 +51,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXDocumentUtil.h"
 #include "FBXProperties.h"
 
+#include <mutex>
 #include <utility>
 
 namespace Assimp {
@@ -193,6 +194,7 @@ PropertyTable::~PropertyTable()
 // ------------------------------------------------------------------------------------------------
 const Property* PropertyTable::Get(const std::string& name) const
 {
+    std::unique_lock<std::mutex> lock(propsMutex);
     PropertyMap::const_iterator it = props.find(name);
     if (it == props.end()) {
         // hasn't been parsed yet?
@@ -207,6 +209,7 @@ const Property* PropertyTable::Get(const std::string& name) const
         if (it == props.end()) {
             // check property template
             if(templateProps) {
+                lock.unlock();
                 return templateProps->Get(name);
             }
 
@@ -220,6 +223,7 @@ const Property* PropertyTable::Get(const std::string& name) const
 DirectPropertyMap PropertyTable::GetUnparsedProperties() const
 {
     DirectPropertyMap result;
+    std::lock_guard<std::mutex> lock(propsMutex);
 
     // Loop through all the lazy properties (which is all the properties)
     for(const LazyPropertyMap::value_type& currentElement : lazyProps) {
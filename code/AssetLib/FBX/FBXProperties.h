@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FBXCompileConfig.h"
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace Assimp {
@@ -121,6 +122,8 @@ public:
 private:
     LazyPropertyMap lazyProps;
     mutable PropertyMap props;
+    // guards the lazy parsing into props, the converter reads tables concurrently
+    mutable std::mutex propsMutex;
     const std::shared_ptr<const PropertyTable> templateProps;
     const Element* const element;
 };
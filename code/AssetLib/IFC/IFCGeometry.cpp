@@ -817,7 +817,7 @@ bool ProcessGeometricItem(const Schema_2x3::IfcRepresentationItem& geo,
     aiMesh* const mesh = meshtmp->ToMesh();
     if(mesh) {
         mesh->mMaterialIndex = matid;
-        mesh_indices.insert(static_cast<unsigned int>(conv.meshes.size()));
+        mesh_indices.insert(conv.mesh_base + static_cast<unsigned int>(conv.meshes.size()));
         conv.meshes.push_back(mesh);
         return true;
     }
@@ -846,11 +846,18 @@ bool TryQueryMeshCache(const Schema_2x3::IfcRepresentationItem& item,
         ConversionData& conv) {
     ConversionData::MeshCacheIndex idx(&item, mat_index);
     ConversionData::MeshCache::const_iterator it = conv.cached_meshes.find(idx);
-    if (it != conv.cached_meshes.end()) {
-        std::copy((*it).second.begin(),(*it).second.end(),std::inserter(mesh_indices, mesh_indices.end()));
-        return true;
+    if (it == conv.cached_meshes.end()) {
+        if (!conv.shared) {
+            return false;
+        }
+        // the parent of a parallel conversion task is not modified while the task runs
+        it = conv.shared->cached_meshes.find(idx);
+        if (it == conv.shared->cached_meshes.end()) {
+            return false;
+        }
     }
-    return false;
+    std::copy((*it).second.begin(),(*it).second.end(),std::inserter(mesh_indices, mesh_indices.end()));
+    return true;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -872,6 +879,9 @@ bool ProcessRepresentationItem(const Schema_2x3::IfcRepresentationItem& item,
 
     if (!TryQueryMeshCache(item,mesh_indices,localmatid,conv)) {
         if(ProcessGeometricItem(item,localmatid,mesh_indices,conv)) {
+            if (conv.shared) {
+                conv.mesh_keys.resize(conv.meshes.size(), ConversionData::MeshCacheIndex(&item, localmatid));
+            }
             if(mesh_indices.size()) {
                 PopulateMeshCache(item,mesh_indices,localmatid,conv);
             }
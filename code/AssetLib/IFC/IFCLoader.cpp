@@ -61,6 +61,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "IFCLoader.h"
 
 #include "IFCUtil.h"
+#include "Common/ParallelFor.h"
 
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/importerdesc.h>
@@ -99,6 +100,8 @@ void SetUnits(ConversionData &conv);
 void SetCoordinateSpace(ConversionData &conv);
 void ProcessSpatialStructures(ConversionData &conv);
 void MakeTreeRelative(ConversionData &conv);
+aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el, ConversionData &conv,
+        std::vector<TempOpening> *collect_openings);
 void ConvertUnit(const ::Assimp::STEP::EXPRESS::DataType &dt, ConversionData &conv);
 
 } // namespace
@@ -140,6 +143,7 @@ void IFCImporter::SetupProperties(const Importer *pImp) {
     settings.conicSamplingAngle = std::min(std::max((float)pImp->GetPropertyFloat(AI_CONFIG_IMPORT_IFC_SMOOTHING_ANGLE, AI_IMPORT_IFC_DEFAULT_SMOOTHING_ANGLE), 5.0f), 120.0f);
     settings.cylindricalTessellation = std::min(std::max(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_CYLINDRICAL_TESSELLATION, AI_IMPORT_IFC_DEFAULT_CYLINDRICAL_TESSELLATION), 3), 180);
     settings.skipAnnotations = true;
+    settings.parallelProducts = pImp->GetPropertyBool(AI_CONFIG_IMPORT_IFC_PARALLEL_PRODUCTS, false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -624,6 +628,150 @@ void ProcessMetadata(uint64_t relDefinesByPropertiesID, ConversionData &conv, Me
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void RemapNodeMeshes(aiNode *nd, const std::vector<std::vector<unsigned int>> &remap, unsigned int base, ConversionData &conv) {
+    if (nd->mNumMeshes) {
+        std::set<unsigned int> meshes;
+        for (unsigned int i = 0; i < nd->mNumMeshes; ++i) {
+            const unsigned int idx = nd->mMeshes[i];
+            if (idx < base) {
+                meshes.insert(idx);
+            } else {
+                meshes.insert(remap[idx - base].begin(), remap[idx - base].end());
+            }
+        }
+        delete[] nd->mMeshes;
+        nd->mMeshes = nullptr;
+        nd->mNumMeshes = 0;
+        AssignAddedMeshes(meshes, nd, conv);
+    }
+    for (unsigned int i = 0; i < nd->mNumChildren; ++i) {
+        RemapNodeMeshes(nd->mChildren[i], remap, base, conv);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Moves the meshes and materials of a parallel conversion task into its parent. Anything
+// an earlier task (or the parent itself) has already generated is dropped in favour of the
+// existing copy, so the result only depends on the order in which the tasks are merged.
+void MergeConversionTask(ConversionData &conv, ConversionData &task, aiNode *nd) {
+    ai_assert(task.shared == &conv);
+    ai_assert(task.mesh_keys.size() == task.meshes.size());
+
+    std::vector<const Schema_2x3::IfcSurfaceStyle *> styles(task.materials.size());
+    for (const ConversionData::MaterialCache::value_type &kv : task.cached_materials) {
+        styles[kv.second - task.material_base] = kv.first;
+    }
+
+    std::vector<unsigned int> matmap(task.materials.size());
+    for (size_t a = 0; a < task.materials.size(); ++a) {
+        unsigned int matindex = std::numeric_limits<uint32_t>::max();
+        if (styles[a]) {
+            const ConversionData::MaterialCache::const_iterator it = conv.cached_materials.find(styles[a]);
+            if (it != conv.cached_materials.end()) {
+                matindex = it->second;
+            }
+        } else {
+            // the only materials not bound to a surface style are the default materials
+            aiString name;
+            task.materials[a]->Get(AI_MATKEY_NAME, name);
+            matindex = FindMaterial(name, conv);
+        }
+
+        if (matindex == std::numeric_limits<uint32_t>::max()) {
+            matindex = conv.material_base + static_cast<unsigned int>(conv.materials.size());
+            conv.materials.push_back(task.materials[a]);
+            if (styles[a]) {
+                conv.cached_materials[styles[a]] = matindex;
+            }
+        } else {
+            delete task.materials[a];
+        }
+        task.materials[a] = nullptr;
+        matmap[a] = matindex;
+    }
+    task.materials.clear();
+
+    auto remapMaterial = [&](unsigned int matindex) {
+        return matindex < task.material_base || matindex == std::numeric_limits<uint32_t>::max() ? matindex : matmap[matindex - task.material_base];
+    };
+
+    std::vector<std::vector<unsigned int>> meshmap(task.meshes.size());
+    for (size_t m = 0; m < task.meshes.size(); ++m) {
+        const ConversionData::MeshCacheIndex idx(task.mesh_keys[m].item, remapMaterial(task.mesh_keys[m].matindex));
+        const ConversionData::MeshCache::const_iterator it = conv.cached_meshes.find(idx);
+        if (it != conv.cached_meshes.end()) {
+            meshmap[m].assign(it->second.begin(), it->second.end());
+            delete task.meshes[m];
+        } else {
+            aiMesh *const mesh = task.meshes[m];
+            mesh->mMaterialIndex = remapMaterial(mesh->mMaterialIndex);
+            meshmap[m].push_back(conv.mesh_base + static_cast<unsigned int>(conv.meshes.size()));
+            conv.meshes.push_back(mesh);
+        }
+        task.meshes[m] = nullptr;
+    }
+    task.meshes.clear();
+
+    for (const ConversionData::MeshCache::value_type &kv : task.cached_meshes) {
+        const ConversionData::MeshCacheIndex idx(kv.first.item, remapMaterial(kv.first.matindex));
+        if (conv.cached_meshes.find(idx) != conv.cached_meshes.end()) {
+            continue;
+        }
+        std::set<unsigned int> &indices = conv.cached_meshes[idx];
+        for (const unsigned int i : kv.second) {
+            if (i < task.mesh_base) {
+                indices.insert(i);
+            } else {
+                indices.insert(meshmap[i - task.mesh_base].begin(), meshmap[i - task.mesh_base].end());
+            }
+        }
+    }
+
+    if (nd) {
+        RemapNodeMeshes(nd, meshmap, task.mesh_base, conv);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Converts the products contained in a spatial structure element on worker threads and merges
+// them back in their original order. Each product gets its own ConversionData which can read,
+// but not modify the mesh and material caches of conv.
+void ProcessContainedProductsParallel(aiNode *nd, const Schema_2x3::IfcRelContainedInSpatialStructure &cont, ConversionData &conv,
+        std::vector<aiNode *> &subnodes) {
+    std::vector<const Schema_2x3::IfcProduct *> products;
+    products.reserve(cont.RelatedElements.size());
+    for (const Schema_2x3::IfcProduct &pro : cont.RelatedElements) {
+        // openings are handled by the building elements they belong to, see ProcessSpatialStructure()
+        if (!pro.ToPtr<Schema_2x3::IfcOpeningElement>()) {
+            products.push_back(&pro);
+        }
+    }
+
+    std::vector<std::unique_ptr<ConversionData>> tasks(products.size());
+    std::vector<std::unique_ptr<aiNode>> nodes(products.size());
+    ParallelFor(products.size(), [&](size_t i) {
+        std::unique_ptr<ConversionData> task(new ConversionData(conv.db, conv.proj, conv.out, conv.settings));
+        task->len_scale = conv.len_scale;
+        task->angle_scale = conv.angle_scale;
+        task->wcs = conv.wcs;
+        task->already_processed = conv.already_processed;
+        task->shared = &conv;
+        task->mesh_base = conv.mesh_base + static_cast<unsigned int>(conv.meshes.size());
+        task->material_base = conv.material_base + static_cast<unsigned int>(conv.materials.size());
+
+        nodes[i].reset(ProcessSpatialStructure(nd, *products[i], *task, nullptr));
+        tasks[i] = std::move(task);
+    });
+
+    for (size_t i = 0; i < products.size(); ++i) {
+        MergeConversionTask(conv, *tasks[i], nodes[i].get());
+        if (nodes[i]) {
+            subnodes.push_back(nodes[i].release());
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el, ConversionData &conv,
         std::vector<TempOpening> *collect_openings = nullptr) {
@@ -654,17 +802,12 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
 
     // check for node metadata
     STEP::DB::RefMapRange children = refs.equal_range(el.GetID());
-    if (children.first != refs.end()) {
+    if (children.first != children.second) {
         Metadata properties;
-        if (children.first == children.second) {
-            // handles single property set
-            ProcessMetadata((*children.first).second, conv, properties);
-        } else {
-            // handles multiple property sets (currently all property sets are merged,
-            // which may not be the best solution in the long run)
-            for (STEP::DB::RefMap::const_iterator it = children.first; it != children.second; ++it) {
-                ProcessMetadata((*it).second, conv, properties);
-            }
+        // handles multiple property sets (currently all property sets are merged,
+        // which may not be the best solution in the long run)
+        for (STEP::DB::RefMap::const_iterator it = children.first; it != children.second; ++it) {
+            ProcessMetadata(*it, conv, properties);
         }
 
         if (!properties.empty()) {
@@ -698,16 +841,20 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
             // skip over meshes that have already been processed before. This is strictly necessary
             // because the reverse indices also include references contained in argument lists and
             // therefore every element has a back-reference hold by its parent.
-            if (conv.already_processed.find((*range2.first).second) != conv.already_processed.end()) {
+            if (conv.already_processed.find(*range2.first) != conv.already_processed.end()) {
                 continue;
             }
-            const STEP::LazyObject &obj = conv.db.MustGetObject((*range2.first).second);
+            const STEP::LazyObject &obj = conv.db.MustGetObject(*range2.first);
 
             // handle regularly-contained elements
             if (const Schema_2x3::IfcRelContainedInSpatialStructure *const cont = obj->ToPtr<Schema_2x3::IfcRelContainedInSpatialStructure>()) {
                 if (cont->RelatingStructure->GetID() != el.GetID()) {
                     continue;
                 }
+                if (conv.settings.parallelProducts && !conv.shared) {
+                    ProcessContainedProductsParallel(nd, *cont, conv, subnodes);
+                    continue;
+                }
                 for (const Schema_2x3::IfcProduct &pro : cont->RelatedElements) {
                     if (pro.ToPtr<Schema_2x3::IfcOpeningElement>()) {
                         // IfcOpeningElement is handled below. Sadly we can't use it here as is:
@@ -763,10 +910,10 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
 
         for (; range.first != range.second; ++range.first) {
             // see note in loop above
-            if (conv.already_processed.find((*range.first).second) != conv.already_processed.end()) {
+            if (conv.already_processed.find(*range.first) != conv.already_processed.end()) {
                 continue;
             }
-            if (const Schema_2x3::IfcRelAggregates *const aggr = conv.db.GetObject((*range.first).second)->ToPtr<Schema_2x3::IfcRelAggregates>()) {
+            if (const Schema_2x3::IfcRelAggregates *const aggr = conv.db.GetObject(*range.first)->ToPtr<Schema_2x3::IfcRelAggregates>()) {
                 if (aggr->RelatingObject->GetID() != el.GetID()) {
                     continue;
                 }
@@ -854,7 +1001,7 @@ void ProcessSpatialStructures(ConversionData &conv) {
         const STEP::DB::RefMap &refs = conv.db.GetRefs();
         STEP::DB::RefMapRange ref_range = refs.equal_range(conv.proj.GetID());
         for (; ref_range.first != ref_range.second; ++ref_range.first) {
-            if (const Schema_2x3::IfcRelAggregates *const aggr = conv.db.GetObject((*ref_range.first).second)->ToPtr<Schema_2x3::IfcRelAggregates>()) {
+            if (const Schema_2x3::IfcRelAggregates *const aggr = conv.db.GetObject(*ref_range.first)->ToPtr<Schema_2x3::IfcRelAggregates>()) {
 
                 for (const Schema_2x3::IfcObjectDefinition &def : aggr->RelatedObjects) {
                     // comparing pointer values is not sufficient, we would need to cast them to the same type first
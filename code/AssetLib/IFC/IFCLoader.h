@@ -77,13 +77,14 @@ public:
     // loader settings, publicly accessible via their corresponding AI_CONFIG constants
     struct Settings {
         Settings() :
-                skipSpaceRepresentations(), useCustomTriangulation(), skipAnnotations(), conicSamplingAngle(10.f), cylindricalTessellation(32) {}
+                skipSpaceRepresentations(), useCustomTriangulation(), skipAnnotations(), conicSamplingAngle(10.f), cylindricalTessellation(32), parallelProducts() {}
 
         bool skipSpaceRepresentations;
         bool useCustomTriangulation;
         bool skipAnnotations;
         float conicSamplingAngle;
         int cylindricalTessellation;
+        bool parallelProducts;
     };
 
     IFCImporter() = default;
@@ -126,19 +126,36 @@ static void FillMaterial(aiMaterial* mat,const IFC::Schema_2x3::IfcSurfaceStyle*
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+unsigned int FindMaterial(const aiString& name, const ConversionData& conv) {
+    for( size_t a = 0; a < conv.materials.size(); ++a ) {
+        aiString mname;
+        conv.materials[a]->Get(AI_MATKEY_NAME, mname);
+        if ( name == mname ) {
+            return conv.material_base + ( unsigned int )a;
+        }
+    }
+    return std::numeric_limits<uint32_t>::max();
+}
+
 // ------------------------------------------------------------------------------------------------
 unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionData& conv, bool forceDefaultMat) {
     STEP::DB::RefMapRange range = conv.db.GetRefs().equal_range(id);
     for(;range.first != range.second; ++range.first) {
-        if(const IFC::Schema_2x3::IfcStyledItem* const styled = conv.db.GetObject((*range.first).second)->ToPtr<IFC::Schema_2x3::IfcStyledItem>()) {
+        if(const IFC::Schema_2x3::IfcStyledItem* const styled = conv.db.GetObject(*range.first)->ToPtr<IFC::Schema_2x3::IfcStyledItem>()) {
             for(const IFC::Schema_2x3::IfcPresentationStyleAssignment& as : styled->Styles) {
                 for (const std::shared_ptr<const IFC::Schema_2x3::IfcPresentationStyleSelect> &sel : as.Styles) {
 
                     if( const IFC::Schema_2x3::IfcSurfaceStyle* const surf = sel->ResolveSelectPtr<IFC::Schema_2x3::IfcSurfaceStyle>(conv.db) ) {
                         // try to satisfy from cache
-                        ConversionData::MaterialCache::iterator mit = conv.cached_materials.find(surf);
+                        ConversionData::MaterialCache::const_iterator mit = conv.cached_materials.find(surf);
                         if( mit != conv.cached_materials.end() )
                             return mit->second;
+                        if( conv.shared ) {
+                            mit = conv.shared->cached_materials.find(surf);
+                            if( mit != conv.shared->cached_materials.end() )
+                                return mit->second;
+                        }
 
                         // not found, create new material
                         const std::string side = static_cast<std::string>(surf->Side);
@@ -151,7 +168,7 @@ unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionDat
                         FillMaterial(mat.get(), surf, conv);
 
                         conv.materials.push_back(mat.release());
-                        unsigned int matindex = static_cast<unsigned int>(conv.materials.size() - 1);
+                        unsigned int matindex = conv.material_base + static_cast<unsigned int>(conv.materials.size() - 1);
                         conv.cached_materials[surf] = matindex;
                         return matindex;
                     }
@@ -174,13 +191,16 @@ unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionDat
     name.Set("<IFCDefault>");
 
     // look if there's already a default material with this base color
-    for( size_t a = 0; a < conv.materials.size(); ++a ) {
-        aiString mname;
-        conv.materials[a]->Get(AI_MATKEY_NAME, mname);
-        if ( name == mname ) {
-            return ( unsigned int )a;
+    if ( conv.shared ) {
+        const unsigned int sharedmatid = FindMaterial(name, *conv.shared);
+        if ( sharedmatid != std::numeric_limits<uint32_t>::max() ) {
+            return sharedmatid;
         }
     }
+    const unsigned int defmatid = FindMaterial(name, conv);
+    if ( defmatid != std::numeric_limits<uint32_t>::max() ) {
+        return defmatid;
+    }
 
     // we're here, yet - no default material with suitable color available. Generate one
     std::unique_ptr<aiMaterial> mat(new aiMaterial());
@@ -190,7 +210,7 @@ unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionDat
     mat->AddProperty(&col,1, AI_MATKEY_COLOR_DIFFUSE);
 
     conv.materials.push_back(mat.release());
-    return (unsigned int) conv.materials.size() - 1;
+    return conv.material_base + (unsigned int) conv.materials.size() - 1;
 }
 
 } // ! IFC
@@ -203,6 +203,75 @@ static bool BoundingBoxesOverlapping( const BoundingBox &ibb, const BoundingBox
         ibb.first.y < bb.second.y && ibb.second.y > bb.first.y;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Uniform grid over the [0,1]^2 projection space to look up the contours whose bounding boxes
+// may overlap or touch a given box, so not every pair of openings needs to be tested. Items
+// are the indices of the contours in their ContourVector, queries yield them in ascending order.
+class BoundingBoxIndex {
+public:
+    explicit BoundingBoxIndex(size_t expected_items) {
+        res = static_cast<unsigned int>(std::sqrt(static_cast<double>(expected_items)));
+        res = std::min(std::max(res, 1u), 64u);
+        cells.resize(res * res);
+    }
+
+    void Insert(size_t item, const BoundingBox& bb) {
+        unsigned int x0, y0, x1, y1;
+        GetCells(bb, 0, x0, y0, x1, y1);
+        for (unsigned int y = y0; y <= y1; ++y) {
+            for (unsigned int x = x0; x <= x1; ++x) {
+                cells[y * res + x].push_back(item);
+            }
+        }
+    }
+
+    void Remove(size_t item, const BoundingBox& bb) {
+        unsigned int x0, y0, x1, y1;
+        GetCells(bb, 0, x0, y0, x1, y1);
+        for (unsigned int y = y0; y <= y1; ++y) {
+            for (unsigned int x = x0; x <= x1; ++x) {
+                std::vector<size_t>& cell = cells[y * res + x];
+                cell.erase(std::remove(cell.begin(), cell.end(), item), cell.end());
+            }
+        }
+    }
+
+    // Collect all items whose bounding boxes may overlap or touch bb grown by pad
+    void Query(const BoundingBox& bb, IfcFloat pad, std::vector<size_t>& out) const {
+        out.clear();
+        unsigned int x0, y0, x1, y1;
+        GetCells(bb, pad, x0, y0, x1, y1);
+        for (unsigned int y = y0; y <= y1; ++y) {
+            for (unsigned int x = x0; x <= x1; ++x) {
+                const std::vector<size_t>& cell = cells[y * res + x];
+                out.insert(out.end(), cell.begin(), cell.end());
+            }
+        }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+private:
+    unsigned int ToCell(IfcFloat v) const {
+        const IfcFloat c = std::floor(v * res);
+        if (!(c > 0)) {
+            return 0;
+        }
+        return c < res ? static_cast<unsigned int>(c) : res - 1;
+    }
+
+    void GetCells(const BoundingBox& bb, IfcFloat pad, unsigned int& x0, unsigned int& y0, unsigned int& x1, unsigned int& y1) const {
+        // the mapping is monotonic, so boxes that overlap or merely touch always share a cell
+        x0 = ToCell(bb.first.x - pad);
+        y0 = ToCell(bb.first.y - pad);
+        x1 = std::max(x0, ToCell(bb.second.x + pad));
+        y1 = std::max(y0, ToCell(bb.second.y + pad));
+    }
+
+    unsigned int res;
+    std::vector<std::vector<size_t>> cells;
+};
+
 // ------------------------------------------------------------------------------------------------
 static bool IsDuplicateVertex(const IfcVector2& vv, const std::vector<IfcVector2>& temp_contour) {
     // sanity check for duplicate vertices
@@ -470,6 +539,54 @@ void CleanupWindowContours(ContourVector& contours) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Check whether poly is a non-degenerate, axis-aligned rectangle and get its corners
+bool GetRectangleBounds(const ClipperLib::Path& poly, ClipperLib::IntPoint& pmin, ClipperLib::IntPoint& pmax) {
+    if (poly.size() != 4 || poly[0] == poly[2] || poly[1] == poly[3]) {
+        return false;
+    }
+
+    pmin = pmax = poly[0];
+    for (const ClipperLib::IntPoint& point : poly) {
+        pmin.X = std::min(pmin.X, point.X);
+        pmin.Y = std::min(pmin.Y, point.Y);
+        pmax.X = std::max(pmax.X, point.X);
+        pmax.Y = std::max(pmax.Y, point.Y);
+    }
+    if (pmin.X == pmax.X || pmin.Y == pmax.Y) {
+        return false;
+    }
+
+    for (size_t i = 0; i < 4; ++i) {
+        const ClipperLib::IntPoint& a = poly[i];
+        const ClipperLib::IntPoint& b = poly[(i + 1) % 4];
+        if ((a.X != pmin.X && a.X != pmax.X) || (a.Y != pmin.Y && a.Y != pmax.Y)) {
+            return false;
+        }
+        // every edge must run along exactly one axis
+        if ((a.X == b.X) == (a.Y == b.Y)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Append a polygon starting at its lowest point. polyclipper may start its result polygons at any
+// vertex, so this makes the output independent of whether a polygon went through it or not.
+void AppendNormalizedPolygon(const ClipperLib::Path& poly, std::vector<IfcVector3>& verts, std::vector<unsigned int>& vertcnt) {
+    const size_t start = std::min_element(poly.begin(), poly.end(),
+        [](const ClipperLib::IntPoint& a, const ClipperLib::IntPoint& b) {
+            return a.Y < b.Y || (a.Y == b.Y && a.X < b.X);
+        }) - poly.begin();
+
+    vertcnt.push_back(static_cast<unsigned int>(poly.size()));
+    for (size_t i = 0; i < poly.size(); ++i) {
+        const ClipperLib::IntPoint& point = poly[(start + i) % poly.size()];
+        verts.emplace_back(from_int64(point.X), from_int64(point.Y), 0.0f);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void CleanupOuterContour(const std::vector<IfcVector2>& contour_flat, TempMesh& curmesh) {
     std::vector<IfcVector3> vold;
@@ -494,6 +611,13 @@ void CleanupOuterContour(const std::vector<IfcVector2>& contour_flat, TempMesh&
             std::reverse(clip.begin(), clip.end());
         }
 
+        // Most walls are rectangular in projection space, and so are most of the quads
+        // generated for them. Clipping a rectangle against a rectangle containing it
+        // leaves it unchanged, so we can spare running polyclipper for these. Both paths
+        // emit the polygons with the same orientation and start vertex.
+        ClipperLib::IntPoint clip_min, clip_max, subject_min, subject_max;
+        const bool clip_is_rectangle = GetRectangleBounds(clip, clip_min, clip_max);
+
         // We need to run polyclipper on every single polygon -- we can't run it one all
         // of them at once or it would merge them all together which would undo all
         // previous steps
@@ -513,16 +637,21 @@ void CleanupOuterContour(const std::vector<IfcVector2>& contour_flat, TempMesh&
                     std::reverse(subject.begin(), subject.end());
                 }
 
+                if (clip_is_rectangle && GetRectangleBounds(subject, subject_min, subject_max) &&
+                        subject_min.X >= clip_min.X && subject_min.Y >= clip_min.Y &&
+                        subject_max.X <= clip_max.X && subject_max.Y <= clip_max.Y) {
+                    AppendNormalizedPolygon(subject, vold, iold);
+                    subject.clear();
+                    continue;
+                }
+
                 clipper.AddPath(subject,ClipperLib::ptSubject, true);
                 clipper.AddPath(clip,ClipperLib::ptClip, true);
 
                 clipper.Execute(ClipperLib::ctIntersection,clipped,ClipperLib::pftNonZero,ClipperLib::pftNonZero);
 
                 for(const ClipperLib::Path& ex : clipped) {
-                    iold.push_back(static_cast<unsigned int>(ex.size()));
-                    for(const ClipperLib::IntPoint& point : ex) {
-                        vold.emplace_back(from_int64(point.X), from_int64(point.Y), 0.0f);
-                    }
+                    AppendNormalizedPolygon(ex, vold, iold);
                 }
 
                 subject.clear();
@@ -635,7 +764,8 @@ bool IntersectingLineSegments(const IfcVector2& n0, const IfcVector2& n1,
 }
 
 // ------------------------------------------------------------------------------------------------
-void FindAdjacentContours(ContourVector::iterator current, const ContourVector& contours) {
+void FindAdjacentContours(ContourVector::iterator current, const ContourVector& contours,
+        const BoundingBoxIndex& index, std::vector<size_t>& candidates) {
     const IfcFloat sqlen_epsilon = static_cast<IfcFloat>(Math::getEpsilon<float>());
     const BoundingBox& bb = (*current).bb;
 
@@ -645,7 +775,9 @@ void FindAdjacentContours(ContourVector::iterator current, const ContourVector&
 
     // First step to find possible adjacent contours is to check for adjacent bounding
     // boxes. If the bounding boxes are not adjacent, the contours lines cannot possibly be.
-    for (ContourVector::const_iterator it = contours.begin(), end = contours.end(); it != end; ++it) {
+    index.Query(bb, static_cast<IfcFloat>(Math::getEpsilon<float>()), candidates);
+    for (const size_t candidate : candidates) {
+        const ContourVector::const_iterator it = contours.begin() + candidate;
         if ((*it).IsInvalid()) {
             continue;
         }
@@ -803,6 +935,14 @@ size_t CloseWindows(ContourVector& contours,
     // The code is based on the assumption that this happens symmetrically
     // on both sides of the wall. If it doesn't (which would be a bug anyway)
     // wrong geometry may be generated.
+    BoundingBoxIndex index(contours.size());
+    for (size_t i = 0; i < contours.size(); ++i) {
+        if (!contours[i].IsInvalid()) {
+            index.Insert(i, contours[i].bb);
+        }
+    }
+    std::vector<size_t> candidates;
+
     for (ContourVector::iterator it = contours.begin(), end = contours.end(); it != end; ++it) {
         if ((*it).IsInvalid()) {
             continue;
@@ -826,7 +966,7 @@ size_t CloseWindows(ContourVector& contours,
             // those bordering the outer frame.
             (*it).PrepareSkiplist();
 
-            FindAdjacentContours(it, contours);
+            FindAdjacentContours(it, contours, index, candidates);
             FindBorderContours(it);
 
             // if the window is the result of a finite union or intersection of rectangles,
@@ -1095,8 +1235,11 @@ bool GenerateOpenings(std::vector<TempOpening>& openings,
     // Obtain inverse transform for getting back to world space later on
     const IfcMatrix4 minv = IfcMatrix4(m).Inverse();
 
-    // Compute bounding boxes for all 2D openings in projection space
+    // Compute bounding boxes for all 2D openings in projection space. Contours merged into
+    // others are only flagged invalid here to keep the indices in the spatial index stable.
     ContourVector contours;
+    BoundingBoxIndex index(openings.size());
+    std::vector<size_t> candidates;
 
     std::vector<IfcVector2> temp_contour;
     std::vector<IfcVector2> temp_contour2;
@@ -1232,14 +1375,17 @@ bool GenerateOpenings(std::vector<TempOpening>& openings,
         bool is_rectangle = temp_contour.size() == 4;
 
         // See if this BB intersects or is in close adjacency to any other BB we have so far.
-        for (ContourVector::iterator it = contours.begin(); it != contours.end(); ) {
-            const BoundingBox& ibb = (*it).bb;
+        // The candidates are visited in the order in which the contours were added.
+        index.Query(bb, 0, candidates);
+        for (size_t c = 0; c < candidates.size(); ) {
+            const size_t i = candidates[c];
+            const BoundingBox& ibb = contours[i].bb;
             if (BoundingBoxesOverlapping(ibb, bb)) {
-                if (!(*it).is_rectangular) {
+                if (!contours[i].is_rectangular) {
                     is_rectangle = false;
                 }
 
-                const std::vector<IfcVector2>& other = (*it).contour;
+                const std::vector<IfcVector2>& other = contours[i].contour;
                 ClipperLib::Paths poly;
 
                 // First check whether subtracting the old contour (to which ibb belongs)
@@ -1253,6 +1399,10 @@ bool GenerateOpenings(std::vector<TempOpening>& openings,
                          bb = newbb ;
 
                          ExtractVerticesFromClipper(poly[0], temp_contour, false);
+
+                         // continue with the remaining contours that the new bb may touch
+                         index.Query(bb, 0, candidates);
+                         c = std::lower_bound(candidates.begin(), candidates.end(), i + 1) - candidates.begin();
                          continue;
                     }
                 }
@@ -1278,22 +1428,23 @@ bool GenerateOpenings(std::vector<TempOpening>& openings,
 
                     // Update contour-to-opening tables accordingly
                     if (generate_connection_geometry) {
-                        std::vector<TempOpening*>& t = contours_to_openings[std::distance(contours.begin(),it)];
+                        std::vector<TempOpening*>& t = contours_to_openings[i];
                         joined_openings.insert(joined_openings.end(), t.begin(), t.end());
-
-                        contours_to_openings.erase(contours_to_openings.begin() + std::distance(contours.begin(),it));
+                        t.clear();
                     }
 
-                    contours.erase(it);
+                    index.Remove(i, ibb);
+                    contours[i].FlagInvalid();
 
                     // Restart from scratch because the newly formed BB might now
                     // overlap any other BB which its constituent BBs didn't
                     // previously overlap.
-                    it = contours.begin();
+                    index.Query(bb, 0, candidates);
+                    c = 0;
                     continue;
                 }
             }
-            ++it;
+            ++c;
         }
 
         if(!temp_contour.empty()) {
@@ -1303,10 +1454,30 @@ bool GenerateOpenings(std::vector<TempOpening>& openings,
                         joined_openings.end());
             }
 
+            index.Insert(contours.size(), bb);
             contours.emplace_back(temp_contour, bb, is_rectangle);
         }
     }
 
+    // Drop the contours which have been merged into others
+    size_t kept = 0;
+    for (size_t i = 0; i < contours.size(); ++i) {
+        if (contours[i].IsInvalid()) {
+            continue;
+        }
+        if (kept != i) {
+            std::swap(contours[kept], contours[i]);
+            if (generate_connection_geometry) {
+                contours_to_openings[kept].swap(contours_to_openings[i]);
+            }
+        }
+        ++kept;
+    }
+    contours.erase(contours.begin() + kept, contours.end());
+    if (generate_connection_geometry) {
+        contours_to_openings.resize(kept);
+    }
+
     // Check if we still have any openings left - it may well be that this is
     // not the cause, for example if all the opening candidates don't intersect
     // this surface or point into a direction perpendicular to it.
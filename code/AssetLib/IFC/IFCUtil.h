@@ -178,6 +178,9 @@ struct ConversionData
         , settings(settings)
         , apply_openings()
         , collect_openings()
+        , shared()
+        , mesh_base()
+        , material_base()
     {}
 
     ~ConversionData() {
@@ -221,6 +224,15 @@ struct ConversionData
     std::vector<TempOpening>* collect_openings;
 
     std::set<uint64_t> already_processed;
+
+    // When converting products in parallel, every product gets its own
+    // ConversionData with `shared` pointing to the (then read-only) parent.
+    // Its meshes and materials are numbered after those of the parent
+    // and keep the cache key they were generated for, so they can be
+    // merged back into the parent in a deterministic order.
+    const ConversionData* shared;
+    unsigned int mesh_base, material_base;
+    std::vector<MeshCacheIndex> mesh_keys;
 };
 
 
@@ -276,6 +288,7 @@ bool ProcessCurve(const Schema_2x3::IfcCurve& curve,  TempMesh& meshout, Convers
 
 // IFCMaterial.cpp
 unsigned int ProcessMaterials(uint64_t id, unsigned int prevMatId, ConversionData& conv, bool forceDefaultMat);
+unsigned int FindMaterial(const aiString& name, const ConversionData& conv);
 
 // IFCGeometry.cpp
 IfcMatrix3 DerivePlaneCoordinateSpace(const TempMesh& curmesh, bool& ok, IfcVector3& norOut);
@@ -43,6 +43,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_OBJ_EXPORTER
 
 #include "ObjExporter.h"
+#include "Common/ParallelFor.h"
+#include "Common/TextStreamWriter.h"
 #include <assimp/Exceptional.h>
 #include <assimp/StringComparison.h>
 #include <assimp/version.h>
@@ -50,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exporter.hpp>
 #include <assimp/material.h>
 #include <assimp/scene.h>
+#include <charconv>
 #include <memory>
 
 using namespace Assimp;
@@ -62,24 +65,24 @@ void ExportSceneObj(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene
     // invoke the exporter
     ObjExporter exporter(pFile, pScene, false, props);
 
-    if (exporter.mOutput.fail() || exporter.mOutputMat.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write both the main OBJ file and the material script
+    // Write both the main OBJ file and the material script
     {
         std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
         if (outfile == nullptr) {
             throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
         }
-        outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+        TextStreamWriter out(outfile.get());
+        exporter.WriteGeometryFile(out);
+        out.flush();
     }
     {
         std::unique_ptr<IOStream> outfile (pIOSystem->Open(exporter.GetMaterialLibFileName(),"wt"));
         if (outfile == nullptr) {
             throw DeadlyExportError("could not open output .mtl file: " + std::string(exporter.GetMaterialLibFileName()));
         }
-        outfile->Write( exporter.mOutputMat.str().c_str(), static_cast<size_t>(exporter.mOutputMat.tellp()),1);
+        TextStreamWriter out(outfile.get());
+        exporter.WriteMaterialFile(out);
+        out.flush();
     }
 }
 
@@ -89,20 +92,14 @@ void ExportSceneObjNoMtl(const char* pFile,IOSystem* pIOSystem, const aiScene* p
     // invoke the exporter
     ObjExporter exporter(pFile, pScene, true, props);
 
-    if (exporter.mOutput.fail() || exporter.mOutputMat.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write both the main OBJ file and the material script
-    {
-        std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
-        if (outfile == nullptr) {
-            throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
-        }
-        outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+    // Write the main OBJ file only
+    std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
+    if (outfile == nullptr) {
+        throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
     }
-
-
+    TextStreamWriter out(outfile.get());
+    exporter.WriteGeometryFile(out);
+    out.flush();
 }
 
 } // end of namespace Assimp
@@ -110,9 +107,11 @@ void ExportSceneObjNoMtl(const char* pFile,IOSystem* pIOSystem, const aiScene* p
 static const std::string MaterialExt = ".mtl";
 
 // ------------------------------------------------------------------------------------------------
-ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool noMtl, const ExportProperties* props)
+ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool _noMtl, const ExportProperties* props)
 : filename(_filename)
 , pScene(pScene)
+, noMtl(_noMtl)
+, mergeIdenticalVertices(props == nullptr ? true : props->GetPropertyBool("bJoinIdenticalVertices", true))
 , vn()
 , vt()
 , vp()
@@ -122,20 +121,7 @@ ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool noMt
 , mVpMap()
 , mMeshes()
 , endl("\n") {
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    const std::locale& l = std::locale("C");
-    mOutput.imbue(l);
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
-    mOutputMat.imbue(l);
-    mOutputMat.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
-
-    WriteGeometryFile(
-        noMtl,
-        props == nullptr ? true : props->GetPropertyBool("bJoinIdenticalVertices", true)
-    );
-    if ( !noMtl ) {
-        WriteMaterialFile();
-    }
+    // empty
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -165,7 +151,7 @@ std::string ObjExporter::GetMaterialLibFileName() {
 }
 
 // ------------------------------------------------------------------------------------------------
-void ObjExporter::WriteHeader(std::ostringstream& out) {
+void ObjExporter::WriteHeader(TextStreamWriter& out) {
     out << "# File produced by Open Asset Import Library (http://www.assimp.sf.net)" << endl;
     out << "# (assimp v" << aiGetVersionMajor() << '.' << aiGetVersionMinor() << '.'
         << aiGetVersionRevision() << ")" << endl  << endl;
@@ -193,149 +179,141 @@ std::string ObjExporter::GetMaterialName(unsigned int index) {
 }
 
 // ------------------------------------------------------------------------------------------------
-void ObjExporter::WriteMaterialFile() {
-    WriteHeader(mOutputMat);
+void ObjExporter::WriteMaterialFile(TextStreamWriter& out) {
+    WriteHeader(out);
 
     for(unsigned int i = 0; i < pScene->mNumMaterials; ++i) {
         const aiMaterial* const mat = pScene->mMaterials[i];
 
         int illum = 1;
-        mOutputMat << "newmtl " << GetMaterialName(i)  << endl;
+        out << "newmtl " << GetMaterialName(i)  << endl;
 
         aiColor4D c;
         if(AI_SUCCESS == mat->Get(AI_MATKEY_COLOR_DIFFUSE,c)) {
-            mOutputMat << "Kd " << c.r << " " << c.g << " " << c.b << endl;
+            out << "Kd " << c.r << " " << c.g << " " << c.b << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_COLOR_AMBIENT,c)) {
-            mOutputMat << "Ka " << c.r << " " << c.g << " " << c.b << endl;
+            out << "Ka " << c.r << " " << c.g << " " << c.b << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_COLOR_SPECULAR,c)) {
-            mOutputMat << "Ks " << c.r << " " << c.g << " " << c.b << endl;
+            out << "Ks " << c.r << " " << c.g << " " << c.b << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_COLOR_EMISSIVE,c)) {
-            mOutputMat << "Ke " << c.r << " " << c.g << " " << c.b << endl;
+            out << "Ke " << c.r << " " << c.g << " " << c.b << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_COLOR_TRANSPARENT,c)) {
-            mOutputMat << "Tf " << c.r << " " << c.g << " " << c.b << endl;
+            out << "Tf " << c.r << " " << c.g << " " << c.b << endl;
         }
 
         ai_real o;
         if(AI_SUCCESS == mat->Get(AI_MATKEY_OPACITY,o)) {
-            mOutputMat << "d " << o << endl;
+            out << "d " << o << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_REFRACTI,o)) {
-            mOutputMat << "Ni " << o << endl;
+            out << "Ni " << o << endl;
         }
 
         if(AI_SUCCESS == mat->Get(AI_MATKEY_SHININESS,o) && o) {
-            mOutputMat << "Ns " << o << endl;
+            out << "Ns " << o << endl;
             illum = 2;
         }
 
-        mOutputMat << "illum " << illum << endl;
+        out << "illum " << illum << endl;
 
         aiString s;
         if(AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_DIFFUSE(0),s)) {
-            mOutputMat << "map_Kd " << s.data << endl;
+            out << "map_Kd " << s.data << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_AMBIENT(0),s)) {
-            mOutputMat << "map_Ka " << s.data << endl;
+            out << "map_Ka " << s.data << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_SPECULAR(0),s)) {
-            mOutputMat << "map_Ks " << s.data << endl;
+            out << "map_Ks " << s.data << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_SHININESS(0),s)) {
-            mOutputMat << "map_Ns " << s.data << endl;
+            out << "map_Ns " << s.data << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_OPACITY(0),s)) {
-            mOutputMat << "map_d " << s.data << endl;
+            out << "map_d " << s.data << endl;
         }
         if(AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_HEIGHT(0),s) || AI_SUCCESS == mat->Get(AI_MATKEY_TEXTURE_NORMALS(0),s)) {
             // implementations seem to vary here, so write both variants
-            mOutputMat << "bump " << s.data << endl;
-            mOutputMat << "map_bump " << s.data << endl;
+            out << "bump " << s.data << endl;
+            out << "map_bump " << s.data << endl;
         }
 
-        mOutputMat << endl;
+        out << endl;
     }
 }
 
-void ObjExporter::WriteGeometryFile(bool noMtl, bool merge_identical_vertices) {
-    WriteHeader(mOutput);
+void ObjExporter::WriteGeometryFile(TextStreamWriter& out) {
+    WriteHeader(out);
     if (!noMtl)
-        mOutput << "mtllib "  << GetMaterialLibName() << endl << endl;
+        out << "mtllib "  << GetMaterialLibName() << endl << endl;
 
-    // collect mesh geometry
+    // collect mesh geometry, the meshes are independent of each other until their
+    // data is merged, which happens in mesh order to keep the numbering stable
     aiMatrix4x4 mBase;
-    AddNode(pScene->mRootNode, mBase, merge_identical_vertices);
+    AddNode(pScene->mRootNode, mBase);
+    ParallelFor(mMeshes.size(), [this](size_t i) {
+        CollectMeshData(mMeshes[i]);
+    });
+    for (MeshInstance& m : mMeshes) {
+        MergeMeshData(m);
+    }
+    ParallelFor(mMeshes.size(), [this](size_t i) {
+        WriteFaces(mMeshes[i]);
+    });
 
     // write vertex positions with colors, if any
     mVpMap.getKeys( vp );
     if ( !useVc ) {
-        mOutput << "# " << vp.size() << " vertex positions" << endl;
+        out << "# " << vp.size() << " vertex positions" << endl;
         for ( const vertexData& v : vp ) {
-            mOutput << "v " << v.vp.x << " " << v.vp.y << " " << v.vp.z << endl;
+            out << "v " << v.vp.x << " " << v.vp.y << " " << v.vp.z << endl;
         }
     } else {
-        mOutput << "# " << vp.size() << " vertex positions and colors" << endl;
+        out << "# " << vp.size() << " vertex positions and colors" << endl;
         for ( const vertexData& v : vp ) {
-            mOutput << "v " << v.vp.x << " " << v.vp.y << " " << v.vp.z << " " << v.vc.r << " " << v.vc.g << " " << v.vc.b << endl;
+            out << "v " << v.vp.x << " " << v.vp.y << " " << v.vp.z << " " << v.vc.r << " " << v.vc.g << " " << v.vc.b << endl;
         }
     }
-    mOutput << endl;
+    out << endl;
 
     // write uv coordinates
     mVtMap.getKeys(vt);
-    mOutput << "# " << vt.size() << " UV coordinates" << endl;
+    out << "# " << vt.size() << " UV coordinates" << endl;
     for(const aiVector3D& v : vt) {
-        mOutput << "vt " << v.x << " " << v.y << " " << v.z << endl;
+        out << "vt " << v.x << " " << v.y << " " << v.z << endl;
     }
-    mOutput << endl;
+    out << endl;
 
     // write vertex normals
     mVnMap.getKeys(vn);
-    mOutput << "# " << vn.size() << " vertex normals" << endl;
+    out << "# " << vn.size() << " vertex normals" << endl;
     for(const aiVector3D& v : vn) {
-        mOutput << "vn " << v.x << " " << v.y << " " << v.z << endl;
+        out << "vn " << v.x << " " << v.y << " " << v.z << endl;
     }
-    mOutput << endl;
+    out << endl;
 
     // now write all mesh instances
-    for(const MeshInstance& m : mMeshes) {
-        mOutput << "# Mesh \'" << m.name << "\' with " << m.faces.size() << " faces" << endl;
+    for(MeshInstance& m : mMeshes) {
+        out << "# Mesh \'" << m.name << "\' with " << m.mesh->mNumFaces << " faces" << endl;
         if (!m.name.empty()) {
-            mOutput << "g " << m.name << endl;
+            out << "g " << m.name << endl;
         }
         if ( !noMtl ) {
-            mOutput << "usemtl " << m.matname << endl;
+            out << "usemtl " << m.matname << endl;
         }
 
-        for(const Face& f : m.faces) {
-            mOutput << f.kind << ' ';
-            for(const FaceVertex& fv : f.indices) {
-                mOutput << ' ' << fv.vp;
-
-                if (f.kind != 'p') {
-                    if (fv.vt || f.kind == 'f') {
-                        mOutput << '/';
-                    }
-                    if (fv.vt) {
-                        mOutput << fv.vt;
-                    }
-                    if (f.kind == 'f' && fv.vn) {
-                        mOutput << '/' << fv.vn;
-                    }
-                }
-            }
-
-            mOutput << endl;
-        }
-        mOutput << endl;
+        out << m.faces;
+        std::string().swap(m.faces);
+        out << endl;
     }
 }
 
 // ------------------------------------------------------------------------------------------------
-void ObjExporter::AddMesh(const aiString& name, const aiMesh* m, const aiMatrix4x4& mat, bool merge_identical_vertices) {
+void ObjExporter::AddMesh(const aiString& name, const aiMesh* m, const aiMatrix4x4& mat) {
     mMeshes.emplace_back();
     MeshInstance& mesh = mMeshes.back();
 
@@ -345,56 +323,141 @@ void ObjExporter::AddMesh(const aiString& name, const aiMesh* m, const aiMatrix4
 
     mesh.name = std::string( name.data, name.length );
     mesh.matname = GetMaterialName(m->mMaterialIndex);
+    mesh.mesh = m;
+    mesh.transform = mat;
+}
 
-    mesh.faces.resize(m->mNumFaces);
+// ------------------------------------------------------------------------------------------------
+void ObjExporter::CollectMeshData(MeshInstance& mesh) const {
+    const aiMesh* m = mesh.mesh;
+    const aiMatrix4x4& mat = mesh.transform;
+    const aiMatrix3x3 normalMat(mat);
+
+    size_t numCorners = 0;
+    for (unsigned int i = 0; i < m->mNumFaces; ++i) {
+        numCorners += m->mFaces[i].mNumIndices;
+    }
+    mesh.vpIndices.reserve(numCorners);
+    mesh.vnIndices.resize(numCorners, 0);
+    mesh.vtIndices.resize(numCorners, 0);
 
+    indexMap<aiVector3D, aiVectorKey> vnMap, vtMap;
+    indexMap<vertexData, vertexDataKey> vpMap;
     for(unsigned int i = 0; i < m->mNumFaces; ++i) {
         const aiFace& f = m->mFaces[i];
-
-        Face& face = mesh.faces[i];
-        switch (f.mNumIndices) {
-            case 1:
-                face.kind = 'p';
-                break;
-            case 2:
-                face.kind = 'l';
-                break;
-            default:
-                face.kind = 'f';
-        }
-        face.indices.resize(f.mNumIndices);
-
         for(unsigned int a = 0; a < f.mNumIndices; ++a) {
             const unsigned int idx = f.mIndices[a];
+            const size_t corner = mesh.vpIndices.size();
 
-            const unsigned int fi = merge_identical_vertices ? 0 : idx;
+            const unsigned int fi = mergeIdenticalVertices ? 0 : idx;
             aiVector3D vert = mat * m->mVertices[idx];
 
             if ( nullptr != m->mColors[ 0 ] ) {
                 aiColor4D col4 = m->mColors[ 0 ][ idx ];
-                face.indices[a].vp = mVpMap.getIndex({vert, aiColor3D(col4.r, col4.g, col4.b), fi});
+                mesh.vpIndices.push_back(vpMap.getIndex({vert, aiColor3D(col4.r, col4.g, col4.b), fi}));
             } else {
-                face.indices[a].vp = mVpMap.getIndex({vert, aiColor3D(0,0,0), fi});
+                mesh.vpIndices.push_back(vpMap.getIndex({vert, aiColor3D(0,0,0), fi}));
             }
 
             if (m->mNormals) {
-                aiVector3D norm = aiMatrix3x3(mat) * m->mNormals[idx];
-                face.indices[a].vn = mVnMap.getIndex(norm);
-            } else {
-                face.indices[a].vn = 0;
+                aiVector3D norm = normalMat * m->mNormals[idx];
+                mesh.vnIndices[corner] = vnMap.getIndex(norm);
             }
 
             if ( m->mTextureCoords[ 0 ] ) {
-                face.indices[a].vt = mVtMap.getIndex(m->mTextureCoords[0][idx]);
-            } else {
-                face.indices[a].vt = 0;
+                mesh.vtIndices[corner] = vtMap.getIndex(m->mTextureCoords[0][idx]);
             }
         }
     }
+
+    vpMap.getKeys(mesh.vpKeys);
+    vnMap.getKeys(mesh.vnKeys);
+    vtMap.getKeys(mesh.vtKeys);
+}
+
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+template <class T, class Map>
+void RemapIndices(std::vector<unsigned int>& indices, std::vector<T>& keys, Map& map) {
+    std::vector<unsigned int> remap(keys.size() + 1, 0);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        remap[i + 1] = map.getIndex(keys[i]);
+    }
+    for (unsigned int& index : indices) {
+        index = remap[index];
+    }
+    std::vector<T>().swap(keys);
+}
+
+void AppendIndex(std::string& out, unsigned int value) {
+    char buffer[16];
+    const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+void ObjExporter::MergeMeshData(MeshInstance& mesh) {
+    // translate the mesh local indices to the file wide ones
+    RemapIndices(mesh.vpIndices, mesh.vpKeys, mVpMap);
+    RemapIndices(mesh.vnIndices, mesh.vnKeys, mVnMap);
+    RemapIndices(mesh.vtIndices, mesh.vtKeys, mVtMap);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ObjExporter::WriteFaces(MeshInstance& mesh) {
+    const aiMesh* m = mesh.mesh;
+    std::string& out = mesh.faces;
+    out.reserve(mesh.vpIndices.size() * 12 + m->mNumFaces * 3);
+
+    size_t corner = 0;
+    for(unsigned int i = 0; i < m->mNumFaces; ++i) {
+        const aiFace& f = m->mFaces[i];
+        char kind;
+        switch (f.mNumIndices) {
+            case 1:
+                kind = 'p';
+                break;
+            case 2:
+                kind = 'l';
+                break;
+            default:
+                kind = 'f';
+        }
+
+        out += kind;
+        out += ' ';
+        for(unsigned int a = 0; a < f.mNumIndices; ++a, ++corner) {
+            const unsigned int vt = mesh.vtIndices[corner], vn = mesh.vnIndices[corner];
+            out += ' ';
+            AppendIndex(out, mesh.vpIndices[corner]);
+
+            if (kind != 'p') {
+                if (vt || kind == 'f') {
+                    out += '/';
+                }
+                if (vt) {
+                    AppendIndex(out, vt);
+                }
+                if (kind == 'f' && vn) {
+                    out += '/';
+                    AppendIndex(out, vn);
+                }
+            }
+        }
+
+        out += '\n';
+    }
+
+    std::vector<unsigned int>().swap(mesh.vpIndices);
+    std::vector<unsigned int>().swap(mesh.vnIndices);
+    std::vector<unsigned int>().swap(mesh.vtIndices);
 }
 
 // ------------------------------------------------------------------------------------------------
-void ObjExporter::AddNode(const aiNode* nd, const aiMatrix4x4& mParent, bool merge_identical_vertices) {
+void ObjExporter::AddNode(const aiNode* nd, const aiMatrix4x4& mParent) {
     if (nd == nullptr) {
         return;
     }
@@ -404,14 +467,14 @@ void ObjExporter::AddNode(const aiNode* nd, const aiMatrix4x4& mParent, bool mer
     for(unsigned int i = 0; i < nd->mNumMeshes; ++i) {
         cm = pScene->mMeshes[nd->mMeshes[i]];
         if (nullptr != cm) {
-            AddMesh(cm->mName, pScene->mMeshes[nd->mMeshes[i]], mAbs, merge_identical_vertices);
+            AddMesh(cm->mName, pScene->mMeshes[nd->mMeshes[i]], mAbs);
         } else {
-            AddMesh(nd->mName, pScene->mMeshes[nd->mMeshes[i]], mAbs, merge_identical_vertices);
+            AddMesh(nd->mName, pScene->mMeshes[nd->mMeshes[i]], mAbs);
         }
     }
 
     for(unsigned int i = 0; i < nd->mNumChildren; ++i) {
-        AddNode(nd->mChildren[i], mAbs, merge_identical_vertices);
+        AddNode(nd->mChildren[i], mAbs);
     }
 }
 
@@ -47,9 +47,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_OBJEXPORTER_H_INC
 
 #include <assimp/types.h>
-#include <sstream>
+#include <cstring>
+#include <string>
+#include <type_traits>
 #include <vector>
-#include <map>
 
 #include <assimp/Exporter.hpp>
 
@@ -59,6 +60,8 @@ struct aiMesh;
 
 namespace Assimp {
 
+class TextStreamWriter;
+
 // ------------------------------------------------------------------------------------------------
 /** Helper class to export a given scene to an OBJ file. */
 // ------------------------------------------------------------------------------------------------
@@ -70,118 +73,157 @@ public:
     std::string GetMaterialLibName();
     std::string GetMaterialLibFileName();
 
-    /// public string-streams to write all output into
-    std::ostringstream mOutput, mOutputMat;
+    /// Write the OBJ file
+    void WriteGeometryFile(TextStreamWriter& out);
 
-private:
-    // intermediate data structures
-    struct FaceVertex {
-        FaceVertex()
-        : vp()
-        , vn()
-        , vt() {
-            // empty
-        }
+    /// Write the material script
+    void WriteMaterialFile(TextStreamWriter& out);
 
-        // one-based, 0 means: 'does not exist'
-        unsigned int vp, vn, vt;
-    };
-
-    struct Face {
-        char kind;
-        std::vector<FaceVertex> indices;
+private:
+    struct vertexData {
+        aiVector3D vp;
+        aiColor3D vc; // OBJ does not support 4D color
+        uint32_t index = 0;
     };
 
+    // intermediate data structures
     struct MeshInstance {
         std::string name, matname;
-        std::vector<Face> faces;
+        const aiMesh* mesh = nullptr;
+        aiMatrix4x4 transform;
+
+        // one-based indices per face corner into the unique data of this mesh, 0 means: 'does not exist'
+        std::vector<unsigned int> vpIndices, vnIndices, vtIndices;
+        std::vector<vertexData> vpKeys;
+        std::vector<aiVector3D> vnKeys, vtKeys;
+
+        // the face lines, written once the global indices are known
+        std::string faces;
     };
 
-    void WriteHeader(std::ostringstream& out);
-    void WriteMaterialFile();
-    void WriteGeometryFile(bool noMtl=false, bool merge_identical_vertices = false);
+    void WriteHeader(TextStreamWriter& out);
     std::string GetMaterialName(unsigned int index);
-    void AddMesh(const aiString& name, const aiMesh* m, const aiMatrix4x4& mat, bool merge_identical_vertices);
-    void AddNode(const aiNode* nd, const aiMatrix4x4& mParent, bool merge_identical_vertices);
+    void AddMesh(const aiString& name, const aiMesh* m, const aiMatrix4x4& mat);
+    void AddNode(const aiNode* nd, const aiMatrix4x4& mParent);
+    void CollectMeshData(MeshInstance& mesh) const;
+    void MergeMeshData(MeshInstance& mesh);
+    static void WriteFaces(MeshInstance& mesh);
 
 private:
     std::string filename;
     const aiScene* const pScene;
-
-    struct vertexData {
-        aiVector3D vp;
-        aiColor3D vc; // OBJ does not support 4D color
-        uint32_t index = 0;
-    };
+    const bool noMtl;
+    const bool mergeIdenticalVertices;
 
     std::vector<aiVector3D> vn, vt;
     std::vector<aiColor4D> vc;
     std::vector<vertexData> vp;
     bool useVc;
 
-    struct vertexDataCompare {
-        bool operator() ( const vertexData& a, const vertexData& b ) const {
-            // position
-            if (a.vp.x < b.vp.x) return true;
-            if (a.vp.x > b.vp.x) return false;
-            if (a.vp.y < b.vp.y) return true;
-            if (a.vp.y > b.vp.y) return false;
-            if (a.vp.z < b.vp.z) return true;
-            if (a.vp.z > b.vp.z) return false;
-
-            // color
-            if (a.vc.r < b.vc.r) return true;
-            if (a.vc.r > b.vc.r) return false;
-            if (a.vc.g < b.vc.g) return true;
-            if (a.vc.g > b.vc.g) return false;
-            if (a.vc.b < b.vc.b) return true;
-            if (a.vc.b > b.vc.b) return false;
-            return a.index < b.index;
+    // keys are compared by their bit patterns, except that -0 and 0 are treated as the same value
+    static uint64_t keyBits(ai_real value) {
+        if (value == ai_real(0)) {
+            return 0;
+        }
+        std::conditional<sizeof(ai_real) == 8, uint64_t, uint32_t>::type bits;
+        ::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static uint64_t hashCombine(uint64_t seed, uint64_t value) {
+        seed = (seed ^ value) * 0x9e3779b97f4a7c15ull;
+        return seed ^ (seed >> 29);
+    }
+
+    struct vertexDataKey {
+        static uint64_t hash(const vertexData& v) {
+            uint64_t h = hashCombine(0, keyBits(v.vp.x));
+            h = hashCombine(h, keyBits(v.vp.y));
+            h = hashCombine(h, keyBits(v.vp.z));
+            h = hashCombine(h, keyBits(v.vc.r));
+            h = hashCombine(h, keyBits(v.vc.g));
+            h = hashCombine(h, keyBits(v.vc.b));
+            return hashCombine(h, v.index);
+        }
+
+        static bool equal(const vertexData& a, const vertexData& b) {
+            return keyBits(a.vp.x) == keyBits(b.vp.x) && keyBits(a.vp.y) == keyBits(b.vp.y) &&
+                   keyBits(a.vp.z) == keyBits(b.vp.z) && keyBits(a.vc.r) == keyBits(b.vc.r) &&
+                   keyBits(a.vc.g) == keyBits(b.vc.g) && keyBits(a.vc.b) == keyBits(b.vc.b) &&
+                   a.index == b.index;
         }
     };
 
-    struct aiVectorCompare {
-        bool operator() (const aiVector3D& a, const aiVector3D& b) const {
-            if(a.x < b.x) return true;
-            if(a.x > b.x) return false;
-            if(a.y < b.y) return true;
-            if(a.y > b.y) return false;
-            if(a.z < b.z) return true;
-            return false;
+    struct aiVectorKey {
+        static uint64_t hash(const aiVector3D& v) {
+            uint64_t h = hashCombine(0, keyBits(v.x));
+            h = hashCombine(h, keyBits(v.y));
+            return hashCombine(h, keyBits(v.z));
+        }
+
+        static bool equal(const aiVector3D& a, const aiVector3D& b) {
+            return keyBits(a.x) == keyBits(b.x) && keyBits(a.y) == keyBits(b.y) && keyBits(a.z) == keyBits(b.z);
         }
     };
 
-    template <class T, class Compare = std::less<T>>
+    // Open addressing hash index, hands out one-based indices in the order the keys are first seen.
+    template <class T, class Key>
     class indexMap {
-        int mNextIndex;
-        typedef std::map<T, int, Compare> dataType;
-        dataType vecMap;
-
-    public:
-        indexMap()
-        : mNextIndex(1) {
-            // empty
+        struct Slot {
+            uint32_t index; // one-based, 0 means: 'empty'
+            uint32_t hash;
+        };
+        std::vector<T> mKeys;
+        std::vector<Slot> mSlots;
+
+        void grow() {
+            std::vector<Slot> slots(mSlots.empty() ? 64 : mSlots.size() * 2, Slot{ 0, 0 });
+            const size_t mask = slots.size() - 1;
+            for (const Slot& slot : mSlots) {
+                if (slot.index != 0) {
+                    size_t pos = slot.hash & mask;
+                    while (slots[pos].index != 0) {
+                        pos = (pos + 1) & mask;
+                    }
+                    slots[pos] = slot;
+                }
+            }
+            mSlots.swap(slots);
         }
 
+    public:
         int getIndex(const T& key) {
-            typename dataType::iterator vertIt = vecMap.find(key);
-            // vertex already exists, so reference it
-            if(vertIt != vecMap.end()){
-                return vertIt->second;
+            if ((mKeys.size() + 1) * 4 > mSlots.size() * 3) {
+                grow();
             }
-            return vecMap[key] = mNextIndex++;
-        };
+            const uint64_t h = Key::hash(key);
+            const uint32_t h32 = static_cast<uint32_t>(h ^ (h >> 32));
+            const size_t mask = mSlots.size() - 1;
+            for (size_t pos = h32 & mask;; pos = (pos + 1) & mask) {
+                Slot& slot = mSlots[pos];
+                if (slot.index == 0) {
+                    // new key, append it
+                    mKeys.push_back(key);
+                    slot.index = static_cast<uint32_t>(mKeys.size());
+                    slot.hash = h32;
+                    return static_cast<int>(slot.index);
+                }
+                // key already exists, so reference it
+                if (slot.hash == h32 && Key::equal(mKeys[slot.index - 1], key)) {
+                    return static_cast<int>(slot.index);
+                }
+            }
+        }
 
         void getKeys( std::vector<T>& keys ) {
-            keys.resize(vecMap.size());
-            for(typename dataType::iterator it = vecMap.begin(); it != vecMap.end(); ++it){
-                keys[it->second-1] = it->first;
-            }
-        };
+            keys.swap(mKeys);
+            mKeys.clear();
+            mSlots.clear();
+        }
     };
 
-    indexMap<aiVector3D, aiVectorCompare> mVnMap, mVtMap;
-    indexMap<vertexData, vertexDataCompare> mVpMap;
+    indexMap<aiVector3D, aiVectorKey> mVnMap, mVtMap;
+    indexMap<vertexData, vertexDataKey> mVpMap;
     std::vector<MeshInstance> mMeshes;
 
     // this endl() doesn't flush() the stream
@@ -45,7 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_PLYEXPORTER_H_INC
 #define AI_PLYEXPORTER_H_INC
 
-#include <sstream>
+#include <string>
 
 struct aiScene;
 struct aiNode;
@@ -53,13 +53,15 @@ struct aiMesh;
 
 namespace Assimp {
 
+class TextStreamWriter;
+
 // ------------------------------------------------------------------------------------------------
 /** Helper class to export a given scene to a Stanford Ply file. */
 // ------------------------------------------------------------------------------------------------
 class PlyExporter {
 public:
     /// The class constructor for a specific scene to export
-    PlyExporter(const char* filename, const aiScene* pScene, bool binary = false);
+    PlyExporter(const char* filename, const aiScene* pScene, TextStreamWriter &out, bool binary = false);
     /// The class destructor, empty.
     ~PlyExporter() = default;
 
@@ -67,8 +69,8 @@ public:
     PlyExporter &operator = ( const PlyExporter & ) = delete;
 
 public:
-    /// public string-streams to write all output into:
-    std::ostringstream mOutput;
+    /// The writer all output goes to
+    TextStreamWriter &mOutput;
 
 private:
     void WriteMeshVerts(const aiMesh* m, unsigned int components);
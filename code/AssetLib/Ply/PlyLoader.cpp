@@ -47,10 +47,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers
 #include "PlyLoader.h"
+#include "Common/ChunkedLineParser.h"
 #include <assimp/IOStreamBuffer.h>
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/IOSystem.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 
 namespace Assimp {
@@ -264,215 +268,290 @@ void PLYImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
 static constexpr ai_uint NotSet = 0xFFFFFFFF;
 
+// ------------------------------------------------------------------------------------------------
+// Extract a vertex from a parsed element instance
 void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos) {
     ai_assert(nullptr != pcElement);
     ai_assert(nullptr != instElement);
 
-    ai_uint aiPositions[3] = { NotSet, NotSet, NotSet };
-    PLY::EDataType aiTypes[3] = { EDT_Char, EDT_Char, EDT_Char };
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    PLY::PropertyInstance::ValueUnion values[PLY::DecodePlan::EPC_NumVertexChannels];
+    for (unsigned int c = 0; c < PLY::DecodePlan::EPC_NumVertexChannels; ++c) {
+        if (plan.Has(c)) {
+            values[c] = GetProperty(instElement->alProperties, plan.aiProperty[c]).avList.front();
+        }
+    }
+    StoreVertex(pcElement, values, pos);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Allocate the vertex arrays up front, so vertices can be stored concurrently
+void PLYImporter::PrepareVertices(const PLY::Element *pcElement) {
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    if (0 == plan.iNumChannels || 0 == pcElement->NumOccur) {
+        return;
+    }
 
-    ai_uint aiNormal[3] = { NotSet, NotSet, NotSet };
-    PLY::EDataType aiNormalTypes[3] = { EDT_Char, EDT_Char, EDT_Char };
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
 
-    unsigned int aiColors[4] = { NotSet, NotSet, NotSet, NotSet };
-    PLY::EDataType aiColorsTypes[4] = { EDT_Char, EDT_Char, EDT_Char, EDT_Char };
+    if (nullptr == mGeneratedMesh->mVertices) {
+        mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+        mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
 
-    unsigned int aiTexcoord[2] = { NotSet, NotSet };
-    PLY::EDataType aiTexcoordTypes[2] = { EDT_Char, EDT_Char };
+    const unsigned int numVertices = mGeneratedMesh->mNumVertices;
+    if (nullptr == mGeneratedMesh->mNormals && (plan.Has(DecodePlan::EPC_XNormal) ||
+            plan.Has(DecodePlan::EPC_YNormal) || plan.Has(DecodePlan::EPC_ZNormal))) {
+        mGeneratedMesh->mNormals = new aiVector3D[numVertices];
+    }
 
-    // now check whether which normal components are available
-    unsigned int _a(0), cnt(0);
-    for (std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
-            a != pcElement->alProperties.end(); ++a, ++_a) {
-        if ((*a).bIsList) {
+    if (nullptr == mGeneratedMesh->mColors[0] && (plan.Has(DecodePlan::EPC_Red) || plan.Has(DecodePlan::EPC_Green) ||
+            plan.Has(DecodePlan::EPC_Blue) || plan.Has(DecodePlan::EPC_Alpha))) {
+        mGeneratedMesh->mColors[0] = new aiColor4D[numVertices];
+    }
+
+    if (nullptr == mGeneratedMesh->mTextureCoords[0] && (plan.Has(DecodePlan::EPC_UTextureCoord) ||
+            plan.Has(DecodePlan::EPC_VTextureCoord))) {
+        mGeneratedMesh->mNumUVComponents[0] = 2;
+        mGeneratedMesh->mTextureCoords[0] = new aiVector3D[numVertices];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Parse one ASCII vertex line, following PLY::ElementInstance::ParseInstance
+bool PLYImporter::LoadVertexAscii(const PLY::Element *pcElement, const std::vector<int> &channels,
+        const char *pCur, const char *end, unsigned int pos) {
+    PLY::PropertyInstance::ValueUnion values[PLY::DecodePlan::EPC_NumVertexChannels];
+    PLY::PropertyInstance::ValueUnion v;
+    bool complete = true;
+    for (size_t p = 0; p < pcElement->alProperties.size(); ++p) {
+        const PLY::Property &prop = pcElement->alProperties[p];
+        if (!SkipSpaces(&pCur, end)) {
+            complete = false;
+            v = PLY::PropertyInstance::DefaultValue(prop.eType);
+        } else if (prop.bIsList) {
+            // lists are not mapped to vertex channels, skip the values
+            PLY::PropertyInstance::ParseValue(pCur, prop.eFirstType, &v);
+            const unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(v, prop.eFirstType);
+            for (unsigned int i = 0; i < iNum && SkipSpaces(&pCur, end); ++i) {
+                PLY::PropertyInstance::ParseValue(pCur, prop.eType, &v);
+            }
+            SkipSpacesAndLineEnd(&pCur, end);
             continue;
+        } else {
+            PLY::PropertyInstance::ParseValue(pCur, prop.eType, &v);
+            SkipSpacesAndLineEnd(&pCur, end);
         }
 
-        // Positions
-        if (PLY::EST_XCoord == (*a).Semantic) {
-            ++cnt;
-            aiPositions[0] = _a;
-            aiTypes[0] = (*a).eType;
-        } else if (PLY::EST_YCoord == (*a).Semantic) {
-            ++cnt;
-            aiPositions[1] = _a;
-            aiTypes[1] = (*a).eType;
-        } else if (PLY::EST_ZCoord == (*a).Semantic) {
-            ++cnt;
-            aiPositions[2] = _a;
-            aiTypes[2] = (*a).eType;
-        } else if (PLY::EST_XNormal == (*a).Semantic) {
-            // Normals
-            ++cnt;
-            aiNormal[0] = _a;
-            aiNormalTypes[0] = (*a).eType;
-        } else if (PLY::EST_YNormal == (*a).Semantic) {
-            ++cnt;
-            aiNormal[1] = _a;
-            aiNormalTypes[1] = (*a).eType;
-        } else if (PLY::EST_ZNormal == (*a).Semantic) {
-            ++cnt;
-            aiNormal[2] = _a;
-            aiNormalTypes[2] = (*a).eType;
-        } else if (PLY::EST_Red == (*a).Semantic) {
-            // Colors
-            ++cnt;
-            aiColors[0] = _a;
-            aiColorsTypes[0] = (*a).eType;
-        } else if (PLY::EST_Green == (*a).Semantic) {
-            ++cnt;
-            aiColors[1] = _a;
-            aiColorsTypes[1] = (*a).eType;
-        } else if (PLY::EST_Blue == (*a).Semantic) {
-            ++cnt;
-            aiColors[2] = _a;
-            aiColorsTypes[2] = (*a).eType;
-        } else if (PLY::EST_Alpha == (*a).Semantic) {
-            ++cnt;
-            aiColors[3] = _a;
-            aiColorsTypes[3] = (*a).eType;
-        } else if (PLY::EST_UTextureCoord == (*a).Semantic) {
-            // Texture coordinates
-            ++cnt;
-            aiTexcoord[0] = _a;
-            aiTexcoordTypes[0] = (*a).eType;
-        } else if (PLY::EST_VTextureCoord == (*a).Semantic) {
-            ++cnt;
-            aiTexcoord[1] = _a;
-            aiTexcoordTypes[1] = (*a).eType;
+        if (channels[p] >= 0) {
+            values[channels[p]] = v;
         }
     }
+    StoreVertex(pcElement, values, pos);
+    return complete;
+}
 
-    // check whether we have a valid source for the vertex data
-    if (0 != cnt) {
-        // Position
-        aiVector3D vOut;
-        if (NotSet != aiPositions[0]) {
-            vOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[0]).avList.front(), aiTypes[0]);
-        }
+// ------------------------------------------------------------------------------------------------
+// Parse the vertex lines of an ASCII file in parallel chunks
+void PLYImporter::LoadVerticesAscii(const PLY::Element *pcElement, IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer) {
+    ai_assert(nullptr != pcElement);
 
-        if (NotSet != aiPositions[1]) {
-            vOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[1]).avList.front(), aiTypes[1]);
-        }
+    if (0 == pcElement->NumOccur) {
+        return;
+    }
 
-        if (NotSet != aiPositions[2]) {
-            vOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiPositions[2]).avList.front(), aiTypes[2]);
+    // map the properties to the vertex channels they feed
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    std::vector<int> channels(pcElement->alProperties.size(), -1);
+    for (unsigned int c = 0; c < PLY::DecodePlan::EPC_NumVertexChannels; ++c) {
+        if (plan.Has(c)) {
+            channels[plan.aiProperty[c]] = static_cast<int>(c);
         }
+    }
+    PrepareVertices(pcElement);
 
-        // Normals
-        aiVector3D nOut;
-        bool haveNormal = false;
-        if (NotSet != aiNormal[0]) {
-            nOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[0]).avList.front(), aiNormalTypes[0]);
-            haveNormal = true;
-        }
+    // the lines are parsed on worker threads, so count the broken ones and
+    // log once on this thread instead of calling the logger from the workers
+    std::atomic<size_t> numIncomplete(0);
 
-        if (NotSet != aiNormal[1]) {
-            nOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[1]).avList.front(), aiNormalTypes[1]);
-            haveNormal = true;
-        }
+    // the first line has already been read
+    if (!LoadVertexAscii(pcElement, channels, buffer.data(), buffer.data() + buffer.size(), 0)) {
+        ++numIncomplete;
+    }
 
-        if (NotSet != aiNormal[2]) {
-            nOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiNormal[2]).avList.front(), aiNormalTypes[2]);
-            haveNormal = true;
+    // bound the memory by reading the remaining lines in batches
+    static constexpr size_t BatchSize = 1024 * 1024;
+    std::vector<char> text;
+    std::vector<TextLine> lines;
+    for (unsigned int pos = 1; pos < pcElement->NumOccur;) {
+        const size_t numLines = std::min<size_t>(BatchSize, pcElement->NumOccur - pos);
+        if (0 == streamBuffer.getNextLines(text, numLines)) {
+            break;
         }
+        IndexLines(text.data(), text.data() + text.size(), lines);
+        ParallelForLines(lines, [&](size_t i, const char *begin, const char *end) {
+            if (!LoadVertexAscii(pcElement, channels, begin, end, pos + static_cast<unsigned int>(i))) {
+                ++numIncomplete;
+            }
+        });
+        pos += static_cast<unsigned int>(lines.size());
+    }
+    if (numIncomplete > 0) {
+        ASSIMP_LOG_WARN("Unable to parse property instances of ", numIncomplete.load(), " vertices. "
+                        "Using default values for the missing properties");
+    }
 
-        // Colors
-        aiColor4D cOut;
-        bool haveColor = false;
-        if (NotSet != aiColors[0]) {
-            cOut.r = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[0])
-                                                 .avList.front(),
-                    aiColorsTypes[0]);
-            haveColor = true;
-        }
+    streamBuffer.getNextLine(buffer);
+}
 
-        if (NotSet != aiColors[1]) {
-            cOut.g = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[1])
-                                                 .avList.front(),
-                    aiColorsTypes[1]);
-            haveColor = true;
-        }
+// ------------------------------------------------------------------------------------------------
+// Convert fixed-size binary vertex records straight from the input buffer
+void PLYImporter::LoadVerticesBinary(const PLY::Element *pcElement, IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer, const char *&pCur, unsigned int &bufferSize, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
 
-        if (NotSet != aiColors[2]) {
-            cOut.b = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[2])
-                                                 .avList.front(),
-                    aiColorsTypes[2]);
-            haveColor = true;
-        }
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    const unsigned int recordSize = plan.iRecordSize;
+    ai_assert(0 != recordSize);
 
-        // assume 1.0 for the alpha channel if it is not set
-        if (NotSet == aiColors[3]) {
-            cOut.a = 1.0;
-        } else {
-            cOut.a = NormalizeColorValue(GetProperty(instElement->alProperties,
-                                                 aiColors[3])
-                                                 .avList.front(),
-                    aiColorsTypes[3]);
+    PLY::PropertyInstance::ValueUnion values[PLY::DecodePlan::EPC_NumVertexChannels];
+    for (unsigned int pos = 0; pos < pcElement->NumOccur;) {
+        PLY::PropertyInstance::FetchBinaryData(streamBuffer, buffer, pCur, bufferSize, recordSize);
 
-            haveColor = true;
+        // convert all complete records of the current block at once
+        const unsigned int count = std::min(bufferSize / recordSize, pcElement->NumOccur - pos);
+        for (unsigned int i = 0; i < count; ++i, ++pos, pCur += recordSize) {
+            for (unsigned int c = 0; c < PLY::DecodePlan::EPC_NumVertexChannels; ++c) {
+                if (plan.Has(c)) {
+                    values[c] = PLY::PropertyInstance::DecodeValueBinary(pCur + plan.aiOffset[c], plan.aeType[c], p_bBE);
+                }
+            }
+            StoreVertex(pcElement, values, pos);
         }
+        bufferSize -= count * recordSize;
+    }
+}
 
-        // Texture coordinates
-        aiVector3D tOut;
-        tOut.z = 0;
-        bool haveTextureCoords = false;
-        if (NotSet != aiTexcoord[0]) {
-            tOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiTexcoord[0]).avList.front(), aiTexcoordTypes[0]);
-            haveTextureCoords = true;
-        }
+// ------------------------------------------------------------------------------------------------
+// Store the decoded channels of a vertex in the mesh
+void PLYImporter::StoreVertex(const PLY::Element *pcElement, const PLY::PropertyInstance::ValueUnion *values, unsigned int pos) {
+    const PLY::DecodePlan &plan = pcElement->sPlan;
 
-        if (NotSet != aiTexcoord[1]) {
-            tOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(
-                    GetProperty(instElement->alProperties, aiTexcoord[1]).avList.front(), aiTexcoordTypes[1]);
-            haveTextureCoords = true;
-        }
+    // check whether we have a valid source for the vertex data
+    if (0 == plan.iNumChannels) {
+        return;
+    }
 
-        // create aiMesh if needed
-        if (nullptr == mGeneratedMesh) {
-            mGeneratedMesh = new aiMesh();
-            mGeneratedMesh->mMaterialIndex = 0;
-        }
+    // Position
+    aiVector3D vOut;
+    if (plan.Has(DecodePlan::EPC_XCoord)) {
+        vOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_XCoord], plan.aeType[DecodePlan::EPC_XCoord]);
+    }
 
-        if (nullptr == mGeneratedMesh->mVertices) {
-            mGeneratedMesh->mNumVertices = pcElement->NumOccur;
-            mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
-        }
-        if (pos >= mGeneratedMesh->mNumVertices) {
-            throw DeadlyImportError("Invalid .ply file: Too many vertices");
-        }
+    if (plan.Has(DecodePlan::EPC_YCoord)) {
+        vOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_YCoord], plan.aeType[DecodePlan::EPC_YCoord]);
+    }
 
-        mGeneratedMesh->mVertices[pos] = vOut;
+    if (plan.Has(DecodePlan::EPC_ZCoord)) {
+        vOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_ZCoord], plan.aeType[DecodePlan::EPC_ZCoord]);
+    }
 
-        if (haveNormal) {
-            if (nullptr == mGeneratedMesh->mNormals)
-                mGeneratedMesh->mNormals = new aiVector3D[mGeneratedMesh->mNumVertices];
-            mGeneratedMesh->mNormals[pos] = nOut;
-        }
+    // Normals
+    aiVector3D nOut;
+    bool haveNormal = false;
+    if (plan.Has(DecodePlan::EPC_XNormal)) {
+        nOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_XNormal], plan.aeType[DecodePlan::EPC_XNormal]);
+        haveNormal = true;
+    }
 
-        if (haveColor) {
-            if (nullptr == mGeneratedMesh->mColors[0])
-                mGeneratedMesh->mColors[0] = new aiColor4D[mGeneratedMesh->mNumVertices];
-            mGeneratedMesh->mColors[0][pos] = cOut;
-        }
+    if (plan.Has(DecodePlan::EPC_YNormal)) {
+        nOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_YNormal], plan.aeType[DecodePlan::EPC_YNormal]);
+        haveNormal = true;
+    }
 
-        if (haveTextureCoords) {
-            if (nullptr == mGeneratedMesh->mTextureCoords[0]) {
-                mGeneratedMesh->mNumUVComponents[0] = 2;
-                mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
-            }
-            mGeneratedMesh->mTextureCoords[0][pos] = tOut;
+    if (plan.Has(DecodePlan::EPC_ZNormal)) {
+        nOut.z = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_ZNormal], plan.aeType[DecodePlan::EPC_ZNormal]);
+        haveNormal = true;
+    }
+
+    // Colors
+    aiColor4D cOut;
+    bool haveColor = false;
+    if (plan.Has(DecodePlan::EPC_Red)) {
+        cOut.r = NormalizeColorValue(values[DecodePlan::EPC_Red], plan.aeType[DecodePlan::EPC_Red]);
+        haveColor = true;
+    }
+
+    if (plan.Has(DecodePlan::EPC_Green)) {
+        cOut.g = NormalizeColorValue(values[DecodePlan::EPC_Green], plan.aeType[DecodePlan::EPC_Green]);
+        haveColor = true;
+    }
+
+    if (plan.Has(DecodePlan::EPC_Blue)) {
+        cOut.b = NormalizeColorValue(values[DecodePlan::EPC_Blue], plan.aeType[DecodePlan::EPC_Blue]);
+        haveColor = true;
+    }
+
+    // assume 1.0 for the alpha channel if it is not set
+    if (!plan.Has(DecodePlan::EPC_Alpha)) {
+        cOut.a = 1.0;
+    } else {
+        cOut.a = NormalizeColorValue(values[DecodePlan::EPC_Alpha], plan.aeType[DecodePlan::EPC_Alpha]);
+        haveColor = true;
+    }
+
+    // Texture coordinates
+    aiVector3D tOut;
+    tOut.z = 0;
+    bool haveTextureCoords = false;
+    if (plan.Has(DecodePlan::EPC_UTextureCoord)) {
+        tOut.x = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_UTextureCoord], plan.aeType[DecodePlan::EPC_UTextureCoord]);
+        haveTextureCoords = true;
+    }
+
+    if (plan.Has(DecodePlan::EPC_VTextureCoord)) {
+        tOut.y = PLY::PropertyInstance::ConvertTo<ai_real>(values[DecodePlan::EPC_VTextureCoord], plan.aeType[DecodePlan::EPC_VTextureCoord]);
+        haveTextureCoords = true;
+    }
+
+    // create aiMesh if needed
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
+
+    if (nullptr == mGeneratedMesh->mVertices) {
+        mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+        mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    if (pos >= mGeneratedMesh->mNumVertices) {
+        throw DeadlyImportError("Invalid .ply file: Too many vertices");
+    }
+
+    mGeneratedMesh->mVertices[pos] = vOut;
+
+    if (haveNormal) {
+        if (nullptr == mGeneratedMesh->mNormals)
+            mGeneratedMesh->mNormals = new aiVector3D[mGeneratedMesh->mNumVertices];
+        mGeneratedMesh->mNormals[pos] = nOut;
+    }
+
+    if (haveColor) {
+        if (nullptr == mGeneratedMesh->mColors[0])
+            mGeneratedMesh->mColors[0] = new aiColor4D[mGeneratedMesh->mNumVertices];
+        mGeneratedMesh->mColors[0][pos] = cOut;
+    }
+
+    if (haveTextureCoords) {
+        if (nullptr == mGeneratedMesh->mTextureCoords[0]) {
+            mGeneratedMesh->mNumUVComponents[0] = 2;
+            mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
         }
+        mGeneratedMesh->mTextureCoords[0][pos] = tOut;
     }
 }
 
@@ -504,170 +583,195 @@ ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val,
 }
 
 // ------------------------------------------------------------------------------------------------
-// Try to extract proper faces from the PLY DOM
-void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement,
-        unsigned int pos) {
-    ai_assert(nullptr != pcElement);
-    ai_assert(nullptr != instElement);
-
+// Allocate the face list of the mesh
+bool PLYImporter::PrepareFaces(const PLY::Element *pcElement) {
     if (mGeneratedMesh == nullptr) {
         throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
     }
 
-    bool bOne = false;
+    // check whether we have at least one per-face information set
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    if (!plan.Has(DecodePlan::EPC_VertexIndex) && !plan.Has(DecodePlan::EPC_TextureCoordinates)) {
+        return false;
+    }
 
-    // index of the vertex index list
-    unsigned int iProperty = NotSet;
-    PLY::EDataType eType = EDT_Char;
-    bool bIsTriStrip = false;
+    if (mGeneratedMesh->mFaces == nullptr) {
+        mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+        mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+    } else {
+        if (mGeneratedMesh->mNumFaces < pcElement->NumOccur) {
+            throw DeadlyImportError("Invalid .ply file: Too many faces");
+        }
+    }
+    return true;
+}
 
-    // texture coordinates
-    unsigned int iTextureCoord = NotSet;
-    PLY::EDataType eType3 = EDT_Char;
+// ------------------------------------------------------------------------------------------------
+// Store the per-corner texture coordinates of a face
+void PLYImporter::StoreFaceTexCoords(unsigned int pos, const PLY::PropertyInstance::ValueUnion *values,
+        unsigned int iNum, PLY::EDataType eType) {
+    // should be 6 coords, X Y per corner
+    if ((iNum / 3) != 2) {
+        return;
+    }
 
-    // face = unique number of vertex indices
-    if (PLY::EEST_Face == pcElement->eSemantic) {
-        unsigned int _a = 0;
-        for (std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
-                a != pcElement->alProperties.end(); ++a, ++_a) {
-            if (PLY::EST_VertexIndex == (*a).Semantic) {
-                // must be a dynamic list!
-                if (!(*a).bIsList) {
-                    continue;
-                }
+    const aiFace &face = mGeneratedMesh->mFaces[pos];
+    for (unsigned int a = 0; a < iNum; ++a) {
+        if (a / 2 >= face.mNumIndices) {
+            break;
+        }
+        unsigned int vindex = face.mIndices[a / 2];
+        if (vindex < mGeneratedMesh->mNumVertices) {
+            if (mGeneratedMesh->mTextureCoords[0] == nullptr) {
+                mGeneratedMesh->mNumUVComponents[0] = 2;
+                mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
+            }
 
-                iProperty = _a;
-                bOne = true;
-                eType = (*a).eType;
-            } else if (PLY::EST_TextureCoordinates == (*a).Semantic) {
-                // must be a dynamic list!
-                if (!(*a).bIsList) {
-                    continue;
-                }
-                iTextureCoord = _a;
-                bOne = true;
-                eType3 = (*a).eType;
+            if (a % 2 == 0) {
+                mGeneratedMesh->mTextureCoords[0][vindex].x = PLY::PropertyInstance::ConvertTo<ai_real>(values[a], eType);
+            } else {
+                mGeneratedMesh->mTextureCoords[0][vindex].y = PLY::PropertyInstance::ConvertTo<ai_real>(values[a], eType);
             }
+
+            mGeneratedMesh->mTextureCoords[0][vindex].z = 0;
         }
     }
-    // triangle strip
-    // TODO: triangle strip and material index support???
-    else if (PLY::EEST_TriStrip == pcElement->eSemantic) {
-        unsigned int _a = 0;
-        for (std::vector<PLY::Property>::const_iterator a = pcElement->alProperties.begin();
-                a != pcElement->alProperties.end(); ++a, ++_a) {
-            // must be a dynamic list!
-            if (!(*a).bIsList) {
-                continue;
-            }
-            iProperty = _a;
-            bOne = true;
-            bIsTriStrip = true;
-            eType = (*a).eType;
-            break;
-        }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Try to extract proper faces from the PLY DOM
+void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement,
+        unsigned int pos) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != instElement);
+
+    if (!PrepareFaces(pcElement)) {
+        return;
     }
 
-    // check whether we have at least one per-face information set
-    if (bOne) {
-        if (mGeneratedMesh->mFaces == nullptr) {
-            mGeneratedMesh->mNumFaces = pcElement->NumOccur;
-            mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
-        } else {
-            if (mGeneratedMesh->mNumFaces < pcElement->NumOccur) {
-                throw DeadlyImportError("Invalid .ply file: Too many faces");
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    if (PLY::EEST_TriStrip != pcElement->eSemantic) {
+        // parse the list of vertex indices
+        if (plan.Has(DecodePlan::EPC_VertexIndex)) {
+            const PLY::EDataType eType = plan.aeType[DecodePlan::EPC_VertexIndex];
+            const std::vector<PLY::PropertyInstance::ValueUnion> &avList =
+                    GetProperty(instElement->alProperties, plan.aiProperty[DecodePlan::EPC_VertexIndex]).avList;
+            const unsigned int iNum = (unsigned int)avList.size();
+            mGeneratedMesh->mFaces[pos].mNumIndices = iNum;
+            mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[iNum];
+
+            for (unsigned int a = 0; a < iNum; ++a) {
+                mGeneratedMesh->mFaces[pos].mIndices[a] = PLY::PropertyInstance::ConvertTo<unsigned int>(avList[a], eType);
             }
         }
 
-        if (!bIsTriStrip) {
-            // parse the list of vertex indices
-            if (NotSet != iProperty) {
-                const unsigned int iNum = (unsigned int)GetProperty(instElement->alProperties, iProperty).avList.size();
-                mGeneratedMesh->mFaces[pos].mNumIndices = iNum;
-                mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[iNum];
+        if (plan.Has(DecodePlan::EPC_TextureCoordinates)) {
+            const std::vector<PLY::PropertyInstance::ValueUnion> &avList =
+                    GetProperty(instElement->alProperties, plan.aiProperty[DecodePlan::EPC_TextureCoordinates]).avList;
+            StoreFaceTexCoords(pos, avList.data(), (unsigned int)avList.size(), plan.aeType[DecodePlan::EPC_TextureCoordinates]);
+        }
+    } else { // triangle strips
+        // TODO: triangle strip and material index support???
+        // normally we have only one triangle strip instance where
+        // a value of -1 indicates a restart of the strip
+        const PLY::EDataType eType = plan.aeType[DecodePlan::EPC_VertexIndex];
+        bool flip = false;
+        const std::vector<PLY::PropertyInstance::ValueUnion> &quak =
+                GetProperty(instElement->alProperties, plan.aiProperty[DecodePlan::EPC_VertexIndex]).avList;
+        // pvOut->reserve(pvOut->size() + quak.size() + (quak.size()>>2u)); //Limits memory consumption
+
+        int aiTable[2] = { -1, -1 };
+        for (std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator a = quak.begin(); a != quak.end(); ++a) {
+            const int p = PLY::PropertyInstance::ConvertTo<int>(*a, eType);
+
+            if (-1 == p) {
+                // restart the strip ...
+                aiTable[0] = aiTable[1] = -1;
+                flip = false;
+                continue;
+            }
+            if (-1 == aiTable[0]) {
+                aiTable[0] = p;
+                continue;
+            }
+            if (-1 == aiTable[1]) {
+                aiTable[1] = p;
+                continue;
+            }
 
-                std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p =
-                        GetProperty(instElement->alProperties, iProperty).avList.begin();
+            mGeneratedMesh->mFaces[pos].mNumIndices = 3;
+            mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[3];
+            mGeneratedMesh->mFaces[pos].mIndices[0] = aiTable[0];
+            mGeneratedMesh->mFaces[pos].mIndices[1] = aiTable[1];
+            mGeneratedMesh->mFaces[pos].mIndices[2] = p;
 
-                for (unsigned int a = 0; a < iNum; ++a, ++p) {
-                    mGeneratedMesh->mFaces[pos].mIndices[a] = PLY::PropertyInstance::ConvertTo<unsigned int>(*p, eType);
-                }
+            // every second pass swap the indices.
+            flip = !flip;
+            if (flip) {
+                std::swap(mGeneratedMesh->mFaces[pos].mIndices[0], mGeneratedMesh->mFaces[pos].mIndices[1]);
             }
 
-            if (NotSet != iTextureCoord) {
-                const unsigned int iNum = (unsigned int)GetProperty(instElement->alProperties, iTextureCoord).avList.size();
-
-                // should be 6 coords
-                std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p =
-                        GetProperty(instElement->alProperties, iTextureCoord).avList.begin();
-
-                if ((iNum / 3) == 2) // X Y coord
-                {
-                    for (unsigned int a = 0; a < iNum; ++a, ++p) {
-                        unsigned int vindex = mGeneratedMesh->mFaces[pos].mIndices[a / 2];
-                        if (vindex < mGeneratedMesh->mNumVertices) {
-                            if (mGeneratedMesh->mTextureCoords[0] == nullptr) {
-                                mGeneratedMesh->mNumUVComponents[0] = 2;
-                                mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
-                            }
-
-                            if (a % 2 == 0) {
-                                mGeneratedMesh->mTextureCoords[0][vindex].x = PLY::PropertyInstance::ConvertTo<ai_real>(*p, eType3);
-                            } else {
-                                mGeneratedMesh->mTextureCoords[0][vindex].y = PLY::PropertyInstance::ConvertTo<ai_real>(*p, eType3);
-                            }
-
-                            mGeneratedMesh->mTextureCoords[0][vindex].z = 0;
-                        }
-                    }
-                }
-            }
-        } else { // triangle strips
-            // normally we have only one triangle strip instance where
-            // a value of -1 indicates a restart of the strip
-            bool flip = false;
-            const std::vector<PLY::PropertyInstance::ValueUnion> &quak = GetProperty(instElement->alProperties, iProperty).avList;
-            // pvOut->reserve(pvOut->size() + quak.size() + (quak.size()>>2u)); //Limits memory consumption
-
-            int aiTable[2] = { -1, -1 };
-            for (std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator a = quak.begin(); a != quak.end(); ++a) {
-                const int p = PLY::PropertyInstance::ConvertTo<int>(*a, eType);
-
-                if (-1 == p) {
-                    // restart the strip ...
-                    aiTable[0] = aiTable[1] = -1;
-                    flip = false;
-                    continue;
-                }
-                if (-1 == aiTable[0]) {
-                    aiTable[0] = p;
-                    continue;
-                }
-                if (-1 == aiTable[1]) {
-                    aiTable[1] = p;
-                    continue;
-                }
+            aiTable[0] = aiTable[1];
+            aiTable[1] = p;
+        }
+    }
+}
 
-                if (mGeneratedMesh->mFaces == nullptr) {
-                    mGeneratedMesh->mNumFaces = pcElement->NumOccur;
-                    mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
-                }
+// ------------------------------------------------------------------------------------------------
+// Convert binary face records straight from the input buffer
+void PLYImporter::LoadFacesBinary(const PLY::Element *pcElement, IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer, const char *&pCur, unsigned int &bufferSize, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
 
-                mGeneratedMesh->mFaces[pos].mNumIndices = 3;
-                mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[3];
-                mGeneratedMesh->mFaces[pos].mIndices[0] = aiTable[0];
-                mGeneratedMesh->mFaces[pos].mIndices[1] = aiTable[1];
-                mGeneratedMesh->mFaces[pos].mIndices[2] = p;
+    if (0 == pcElement->NumOccur) {
+        return;
+    }
+    const bool bOne = PrepareFaces(pcElement);
+
+    const PLY::DecodePlan &plan = pcElement->sPlan;
+    const unsigned int iIndexProperty = plan.aiProperty[DecodePlan::EPC_VertexIndex];
+    const unsigned int iTexCoordProperty = plan.aiProperty[DecodePlan::EPC_TextureCoordinates];
+    std::vector<PLY::PropertyInstance::ValueUnion> texCoords;
+    for (unsigned int pos = 0; pos < pcElement->NumOccur; ++pos) {
+        bool haveTexCoords = false;
+        for (unsigned int p = 0; p < static_cast<unsigned int>(pcElement->alProperties.size()); ++p) {
+            const PLY::Property &prop = pcElement->alProperties[p];
+            const unsigned int lsize = PLY::PropertyInstance::GetTypeSize(prop.eType);
+            if (!prop.bIsList) {
+                PLY::PropertyInstance::FetchBinaryData(streamBuffer, buffer, pCur, bufferSize, lsize);
+                pCur += lsize;
+                bufferSize -= lsize;
+                continue;
+            }
 
-                // every second pass swap the indices.
-                flip = !flip;
-                if (flip) {
-                    std::swap(mGeneratedMesh->mFaces[pos].mIndices[0], mGeneratedMesh->mFaces[pos].mIndices[1]);
+            PLY::PropertyInstance::ValueUnion v;
+            PLY::PropertyInstance::ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop.eFirstType, &v, p_bBE);
+            const unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(v, prop.eFirstType);
+            const size_t listSize = static_cast<size_t>(iNum) * lsize;
+            PLY::PropertyInstance::FetchBinaryData(streamBuffer, buffer, pCur, bufferSize, listSize);
+
+            if (bOne && p == iIndexProperty) {
+                aiFace &face = mGeneratedMesh->mFaces[pos];
+                face.mNumIndices = iNum;
+                face.mIndices = new unsigned int[iNum];
+                for (unsigned int a = 0; a < iNum; ++a) {
+                    face.mIndices[a] = PLY::PropertyInstance::ConvertTo<unsigned int>(
+                            PLY::PropertyInstance::DecodeValueBinary(pCur + a * lsize, prop.eType, p_bBE), prop.eType);
                 }
-
-                aiTable[0] = aiTable[1];
-                aiTable[1] = p;
+            } else if (bOne && p == iTexCoordProperty) {
+                // applied after the indices, which may follow in the record
+                texCoords.resize(iNum);
+                for (unsigned int a = 0; a < iNum; ++a) {
+                    texCoords[a] = PLY::PropertyInstance::DecodeValueBinary(pCur + a * lsize, prop.eType, p_bBE);
+                }
+                haveTexCoords = true;
             }
+            pCur += listSize;
+            bufferSize -= static_cast<unsigned int>(listSize);
+        }
+
+        if (haveTexCoords) {
+            StoreFaceTexCoords(pos, texCoords.data(), static_cast<unsigned int>(texCoords.size()), plan.aeType[DecodePlan::EPC_TextureCoordinates]);
         }
     }
 }
@@ -84,6 +84,27 @@ public:
     */
     void LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Parse the ASCII vertex lines of an element in parallel chunks. The
+     *  buffer holds the first line on entry and the line after the
+     *  element on return
+    */
+    void LoadVerticesAscii(const PLY::Element *pcElement, IOStreamBuffer<char> &streamBuffer,
+            std::vector<char> &buffer);
+
+    // -------------------------------------------------------------------
+    /** Convert fixed-size binary vertex records straight from the input
+     *  buffer, using the decode plan of the element
+    */
+    void LoadVerticesBinary(const PLY::Element *pcElement, IOStreamBuffer<char> &streamBuffer,
+            std::vector<char> &buffer, const char *&pCur, unsigned int &bufferSize, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    /** Convert binary face records straight from the input buffer
+    */
+    void LoadFacesBinary(const PLY::Element *pcElement, IOStreamBuffer<char> &streamBuffer,
+            std::vector<char> &buffer, const char *&pCur, unsigned int &bufferSize, bool p_bBE);
+
 protected:
     // -------------------------------------------------------------------
     /** Return importer meta information.
@@ -121,6 +142,36 @@ protected:
             PLY::EDataType eType);
 
 private:
+    // -------------------------------------------------------------------
+    /** Store the decoded vertex channels of a vertex in the mesh
+    */
+    void StoreVertex(const PLY::Element *pcElement, const PLY::PropertyInstance::ValueUnion *values, unsigned int pos);
+
+    // -------------------------------------------------------------------
+    /** Allocate the vertex arrays the decode plan of the element fills
+    */
+    void PrepareVertices(const PLY::Element *pcElement);
+
+    // -------------------------------------------------------------------
+    /** Parse the channels of one ASCII vertex line and store the vertex,
+     *  returns false if properties were missing and set to their defaults.
+     *  Runs on worker threads, so it must not log.
+    */
+    bool LoadVertexAscii(const PLY::Element *pcElement, const std::vector<int> &channels,
+            const char *pCur, const char *end, unsigned int pos);
+
+    // -------------------------------------------------------------------
+    /** Allocate the face list, returns false if the element carries no
+     *  per-face information
+    */
+    bool PrepareFaces(const PLY::Element *pcElement);
+
+    // -------------------------------------------------------------------
+    /** Store the per-corner texture coordinates of a face
+    */
+    void StoreFaceTexCoords(unsigned int pos, const PLY::PropertyInstance::ValueUnion *values,
+            unsigned int iNum, PLY::EDataType eType);
+
     unsigned char *mBuffer;
     PLY::DOM *pcDOM;
     aiMesh *mGeneratedMesh;
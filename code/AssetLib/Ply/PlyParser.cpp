@@ -340,9 +340,76 @@ bool PLY::Element::ParseElement(IOStreamBuffer<char> &streamBuffer, std::vector<
         pOut->alProperties.push_back(prop);
     }
 
+    pOut->sPlan.Compile(pOut->alProperties, pOut->eSemantic);
+
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+PLY::DecodePlan::DecodePlan() AI_NO_EXCEPT :
+        iRecordSize(0),
+        iNumChannels(0) {
+    for (unsigned int i = 0; i < EPC_Count; ++i) {
+        aiProperty[i] = NotSet;
+        aeType[i] = EDT_Char;
+        aiOffset[i] = 0;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void PLY::DecodePlan::Compile(const std::vector<Property> &properties, EElementSemantic eSemantic) {
+    *this = DecodePlan();
+
+    unsigned int offset = 0;
+    bool fixedLayout = true;
+    for (unsigned int i = 0; i < static_cast<unsigned int>(properties.size()); ++i) {
+        const Property &prop = properties[i];
+        int channel = -1;
+        if (prop.bIsList) {
+            fixedLayout = false;
+            if (EEST_Face == eSemantic) {
+                if (EST_VertexIndex == prop.Semantic) {
+                    channel = EPC_VertexIndex;
+                } else if (EST_TextureCoordinates == prop.Semantic) {
+                    channel = EPC_TextureCoordinates;
+                }
+            } else if (EEST_TriStrip == eSemantic && !Has(EPC_VertexIndex)) {
+                // the first list of a triangle strip holds the indices
+                channel = EPC_VertexIndex;
+            }
+        } else {
+            switch (prop.Semantic) {
+            case EST_XCoord: channel = EPC_XCoord; break;
+            case EST_YCoord: channel = EPC_YCoord; break;
+            case EST_ZCoord: channel = EPC_ZCoord; break;
+            case EST_XNormal: channel = EPC_XNormal; break;
+            case EST_YNormal: channel = EPC_YNormal; break;
+            case EST_ZNormal: channel = EPC_ZNormal; break;
+            case EST_Red: channel = EPC_Red; break;
+            case EST_Green: channel = EPC_Green; break;
+            case EST_Blue: channel = EPC_Blue; break;
+            case EST_Alpha: channel = EPC_Alpha; break;
+            case EST_UTextureCoord: channel = EPC_UTextureCoord; break;
+            case EST_VTextureCoord: channel = EPC_VTextureCoord; break;
+            default: break;
+            }
+        }
+
+        if (channel >= 0) {
+            if (!Has(channel)) {
+                ++iNumChannels;
+            }
+            aiProperty[channel] = i;
+            aeType[channel] = prop.eType;
+            aiOffset[channel] = offset;
+        }
+        if (!prop.bIsList) {
+            offset += PropertyInstance::GetTypeSize(prop.eType);
+        }
+    }
+    iRecordSize = fixedLayout ? offset : 0;
+}
+
 bool PLY::DOM::SkipSpaces(std::vector<char> &buffer) {
     const char *pCur = buffer.empty() ? nullptr : (char *)&buffer[0];
     const char *end = pCur + buffer.size();
@@ -588,6 +655,9 @@ bool PLY::ElementInstanceList::ParseInstanceList(
             PLY::DOM::SkipLine(buffer);
             streamBuffer.getNextLine(buffer);
         }
+    } else if (nullptr == p_pcOut && pcElement->eSemantic == EEST_Vertex) {
+        // vertex lines are independent, they are parsed in parallel chunks
+        loader->LoadVerticesAscii(pcElement, streamBuffer, buffer);
     } else {
         const char *pCur = (const char *)&buffer[0];
         const char *end = pCur + buffer.size();
@@ -631,6 +701,19 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
 
+    // vertices and faces are converted straight from the buffer, without
+    // building element instances
+    if (nullptr == p_pcOut) {
+        if (pcElement->eSemantic == EEST_Vertex && pcElement->sPlan.iRecordSize != 0) {
+            loader->LoadVerticesBinary(pcElement, streamBuffer, buffer, pCur, bufferSize, p_bBE);
+            return true;
+        }
+        if (pcElement->eSemantic == EEST_Face) {
+            loader->LoadFacesBinary(pcElement, streamBuffer, buffer, pCur, bufferSize, p_bBE);
+            return true;
+        }
+    }
+
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
@@ -848,45 +931,39 @@ bool PLY::PropertyInstance::ParseValue(const char *&pCur,
 }
 
 // ------------------------------------------------------------------------------------------------
-bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
-        std::vector<char> &buffer,
-        const char *&pCur,
-        unsigned int &bufferSize,
-        PLY::EDataType eType,
-        PLY::PropertyInstance::ValueUnion *out,
-        bool p_bBE) {
-    ai_assert(nullptr != out);
-
-    // calc element size
-    unsigned int lsize = 0;
+unsigned int PLY::PropertyInstance::GetTypeSize(PLY::EDataType eType) {
     switch (eType) {
     case EDT_Char:
     case EDT_UChar:
-        lsize = 1;
-        break;
+        return 1;
 
     case EDT_UShort:
     case EDT_Short:
-        lsize = 2;
-        break;
+        return 2;
 
     case EDT_UInt:
     case EDT_Int:
     case EDT_Float:
-        lsize = 4;
-        break;
+        return 4;
 
     case EDT_Double:
-        lsize = 8;
-        break;
+        return 8;
 
     case EDT_INVALID:
     default:
         break;
     }
+    return 0;
+}
 
-    // read the next file block if needed
-    if (bufferSize < lsize) {
+// ------------------------------------------------------------------------------------------------
+void PLY::PropertyInstance::FetchBinaryData(IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        size_t size) {
+    // read the next file blocks if needed
+    while (bufferSize < size) {
         std::vector<char> nbuffer;
         if (streamBuffer.getNextBlock(nbuffer)) {
             // concat buffer contents
@@ -899,96 +976,117 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
             throw DeadlyImportError("Invalid .ply file: File corrupted");
         }
     }
+}
+
+// ------------------------------------------------------------------------------------------------
+PLY::PropertyInstance::ValueUnion PLY::PropertyInstance::DecodeValueBinary(const char *pCur,
+        PLY::EDataType eType,
+        bool p_bBE) {
+    PLY::PropertyInstance::ValueUnion out;
+    out.iUInt = 0;
 
-    bool ret = true;
     switch (eType) {
     case EDT_UInt: {
         uint32_t t;
         memcpy(&t, pCur, sizeof(uint32_t));
-        pCur += sizeof(uint32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_UShort: {
         uint16_t t;
         memcpy(&t, pCur, sizeof(uint16_t));
-        pCur += sizeof(uint16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_UChar: {
         uint8_t t;
         memcpy(&t, pCur, sizeof(uint8_t));
-        pCur += sizeof(uint8_t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_Int: {
         int32_t t;
         memcpy(&t, pCur, sizeof(int32_t));
-        pCur += sizeof(int32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Short: {
         int16_t t;
         memcpy(&t, pCur, sizeof(int16_t));
-        pCur += sizeof(int16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Char: {
         int8_t t;
         memcpy(&t, pCur, sizeof(int8_t));
-        pCur += sizeof(int8_t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Float: {
         float t;
         memcpy(&t, pCur, sizeof(float));
-        pCur += sizeof(float);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->fFloat = t;
+        out.fFloat = t;
         break;
     }
     case EDT_Double: {
         double t;
         memcpy(&t, pCur, sizeof(double));
-        pCur += sizeof(double);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->fDouble = t;
+        out.fDouble = t;
         break;
     }
     default:
-        ret = false;
+        break;
+    }
+
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        PLY::EDataType eType,
+        PLY::PropertyInstance::ValueUnion *out,
+        bool p_bBE) {
+    ai_assert(nullptr != out);
+
+    if (eType >= EDT_INVALID) {
+        return false;
     }
 
+    const unsigned int lsize = GetTypeSize(eType);
+    FetchBinaryData(streamBuffer, buffer, pCur, bufferSize, lsize);
+
+    *out = DecodeValueBinary(pCur, eType, p_bBE);
+    pCur += lsize;
     bufferSize -= lsize;
 
-    return ret;
+    return true;
 }
 
 } // namespace Assimp
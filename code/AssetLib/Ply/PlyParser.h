@@ -247,6 +247,74 @@ public:
     static ESemantic ParseSemantic(std::vector<char> &buffer);
 };
 
+// ---------------------------------------------------------------------------------
+/** \brief Decode plan of an element, compiled once from the header.
+ *
+ * Stores for every channel the importer consumes the index of the source
+ * property and its data type. For elements without list properties the
+ * byte offset of each channel inside a binary record is stored as well,
+ * so binary records can be converted without building instances.
+ */
+class DecodePlan {
+public:
+    //! The channels the importer extracts from an element
+    enum EChannel {
+        EPC_XCoord = 0x0u,
+        EPC_YCoord,
+        EPC_ZCoord,
+        EPC_XNormal,
+        EPC_YNormal,
+        EPC_ZNormal,
+        EPC_Red,
+        EPC_Green,
+        EPC_Blue,
+        EPC_Alpha,
+        EPC_UTextureCoord,
+        EPC_VTextureCoord,
+
+        //! Number of per-vertex channels, the face channels follow
+        EPC_NumVertexChannels,
+
+        //! vertex index list of a face or triangle strip
+        EPC_VertexIndex = EPC_NumVertexChannels,
+        //! texture coordinate list of a face
+        EPC_TextureCoordinates,
+
+        EPC_Count
+    };
+
+    //! Marks a channel without a source property
+    static constexpr unsigned int NotSet = 0xFFFFFFFF;
+
+    //! Default constructor, no channel is set
+    DecodePlan() AI_NO_EXCEPT;
+
+    //! Index of the source property of each channel
+    unsigned int aiProperty[EPC_Count];
+
+    //! Data type of the source property of each channel
+    EDataType aeType[EPC_Count];
+
+    //! Byte offset of each channel inside a binary record
+    unsigned int aiOffset[EPC_Count];
+
+    //! Size of a binary record, 0 if the element contains lists
+    unsigned int iRecordSize;
+
+    //! Number of channels with a source property
+    unsigned int iNumChannels;
+
+    // -------------------------------------------------------------------
+    //! Returns true if the channel has a source property
+    bool Has(unsigned int channel) const {
+        return NotSet != aiProperty[channel];
+    }
+
+    // -------------------------------------------------------------------
+    //! Compile the plan for the properties of an element
+    void Compile(const std::vector<Property> &properties, EElementSemantic eSemantic);
+};
+
 // ---------------------------------------------------------------------------------
 /** \brief Helper class for an element in a PLY file.
  *
@@ -276,6 +344,8 @@ public:
     //! How many times will the element occur?
     unsigned int NumOccur;
 
+    //! Decode plan compiled from the properties
+    DecodePlan sPlan;
 
     // -------------------------------------------------------------------
     //! Parse an element from a string.
@@ -345,6 +415,19 @@ public:
     static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
 
+    // -------------------------------------------------------------------
+    //! Decode a binary value at the given position, the data must be available
+    static ValueUnion DecodeValueBinary(const char *pCur, EDataType eType, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Make sure at least size bytes of binary data are buffered at pCur
+    static void FetchBinaryData(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, size_t size);
+
+    // -------------------------------------------------------------------
+    //! Get the size of a binary value of the given type
+    static unsigned int GetTypeSize(EDataType eType);
+
     // -------------------------------------------------------------------
     //! Convert a property value to a given type TYPE
     template <typename TYPE>
@@ -47,9 +47,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "STEPFileReader.h"
 #include "STEPFileEncoding.h"
+#include "Common/ParallelFor.h"
 #include <assimp/TinyFormatter.h>
 #include <assimp/fast_atof.h>
+#include <algorithm>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -141,12 +144,12 @@ namespace {
 
 // ------------------------------------------------------------------------------------------------
 // check whether the given line contains an entity definition (i.e. starts with "#<number>=")
-bool IsEntityDef(const std::string& snext)
+bool IsEntityDef(const char* begin, const char* end)
 {
-    if (snext[0] == '#') {
+    if (begin != end && *begin == '#') {
         // it is only a new entity if it has a '=' after the
         // entity ID.
-        for(std::string::const_iterator it = snext.begin()+1; it != snext.end(); ++it) {
+        for(const char* it = begin+1; it != end; ++it) {
             if (*it == '=') {
                 return true;
             }
@@ -158,113 +161,172 @@ bool IsEntityDef(const std::string& snext)
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool IsEndSection(const char* begin, const char* end)
+{
+    static constexpr char ENDSEC_Token[] = "ENDSEC;";
+    return static_cast<size_t>(end - begin) == sizeof(ENDSEC_Token) - 1 && std::equal(begin, end, ENDSEC_Token);
 }
 
+// ------------------------------------------------------------------------------------------------
+// find the end of the line starting at begin
+const char* FindLineEnd(const char* begin, const char* end)
+{
+    for (; begin != end && *begin != '\n' && *begin != '\r'; ++begin);
+    return begin;
+}
 
 // ------------------------------------------------------------------------------------------------
-void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
-    const char* const* types_to_track, size_t len,
-    const char* const* inverse_indices_to_track, size_t len2)
+// skip line terminators and leading blanks to get to the next non-empty line,
+// count the newlines passed on the way.
+const char* SkipToNextLine(const char* begin, const char* end, uint64_t& line)
 {
-    db.SetSchema(scheme);
-    db.SetTypesToTrack(types_to_track,len);
-    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+    for (; begin != end; ++begin) {
+        if (*begin == '\n') {
+            ++line;
+        } else if (*begin != '\r' && *begin != ' ') {
+            break;
+        }
+    }
+    return begin;
+}
 
-    const DB::ObjectMap& map = db.GetObjects();
-    LineSplitter& splitter = db.GetSplitter();
+// an entity record extracted from the DATA section, not yet converted
+struct EntityRecord {
+    uint64_t id;
+    uint64_t line;
+    const char* type;
+    std::unique_ptr<char[]> args;
+};
+
+// the records and diagnostics of one chunk of the DATA section, line
+// numbers are relative to the beginning of the chunk.
+struct ChunkResult {
+    std::vector<EntityRecord> records;
+    std::vector<std::pair<uint64_t, std::string>> warnings;
+    uint64_t lines = 0;
+    bool end_of_section = false;
+};
+
+// below this size the DATA section is scanned on the calling thread
+constexpr size_t MinChunkSize = 1 << 20;
 
-    while (splitter) {
-        bool has_next = false;
-        std::string s = *splitter;
-        if (s == "ENDSEC;") {
+// ------------------------------------------------------------------------------------------------
+// tracks string literals and comments across the lines of the DATA section, so that
+// records are only considered complete outside of them.
+struct RecordLexer {
+    bool in_string = false;
+    bool in_comment = false;
+
+    bool InToken() const {
+        return in_string || in_comment;
+    }
+
+    // consume one line, returns true if it ends with a ';' outside of strings and comments
+    bool ConsumeLine(const char* begin, const char* end) {
+        char last = '\0';
+        for (const char* cur = begin; cur != end; ++cur) {
+            if (in_comment) {
+                if (*cur == '*' && cur + 1 != end && cur[1] == '/') {
+                    in_comment = false;
+                    ++cur;
+                }
+                continue;
+            }
+            if (*cur == '\'') {
+                // an escaped quote toggles twice
+                in_string = !in_string;
+                last = *cur;
+                continue;
+            }
+            if (in_string) {
+                continue;
+            }
+            if (*cur == '/' && cur + 1 != end && cur[1] == '*') {
+                in_comment = true;
+                ++cur;
+                continue;
+            }
+            if (*cur != ' ' && *cur != '\t') {
+                last = *cur;
+            }
+        }
+        return !InToken() && last == ';';
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// extract id, entity class name and argument string of all entities in [begin, end),
+// but don't create the actual objects yet.
+void ScanChunk(const char* begin, const char* end, const EXPRESS::ConversionSchema& scheme, ChunkResult& out)
+{
+    // the entity with all spaces removed, reused for all entities in the chunk
+    std::string s;
+    std::string type;
+
+    uint64_t line = 0;
+    const char* cur = SkipToNextLine(begin, end, line);
+    while (cur != end) {
+        const char* eol = FindLineEnd(cur, end);
+        if (IsEndSection(cur, eol)) {
+            out.end_of_section = true;
             break;
         }
-        s.erase(std::remove(s.begin(), s.end(), ' '), s.end());
 
-        // want one-based line numbers for human readers, so +1
-        const uint64_t line = splitter.get_index()+1;
+        const uint64_t entity_line = line;
+        RecordLexer lexer;
+        lexer.ConsumeLine(cur, eol);
+        s.clear();
+        std::remove_copy(cur, eol, std::back_inserter(s), ' ');
+        cur = SkipToNextLine(eol, end, line);
+
         // LineSplitter already ignores empty lines
-        ai_assert(s.length());
-        if (s[0] != '#') {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'#\'",line));
-            ++splitter;
+        if (s.empty() || s[0] != '#') {
+            out.warnings.emplace_back(entity_line, "expected token \'#\'");
             continue;
         }
-        // ---
-        // extract id, entity class name and argument string,
-        // but don't create the actual object yet.
-        // ---
+
         const std::string::size_type n0 = s.find_first_of('=');
         if (n0 == std::string::npos) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'=\'",line));
-            ++splitter;
+            out.warnings.emplace_back(entity_line, "expected token \'=\'");
             continue;
         }
 
-        const uint64_t id = strtoul10_64(s.substr(1,n0-1).c_str());
+        const uint64_t id = strtoul10_64(s.c_str() + 1);
         if (!id) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected positive, numeric entity id",line));
-            ++splitter;
+            out.warnings.emplace_back(entity_line, "expected positive, numeric entity id");
             continue;
         }
-        std::string::size_type n1 = s.find_first_of('(',n0);
-        if (n1 == std::string::npos) {
-            has_next = true;
-            bool ok = false;
-            for( ++splitter; splitter; ++splitter) {
-                const std::string& snext = *splitter;
-                if (snext.empty()) {
-                    continue;
-                }
 
-                // the next line doesn't start an entity, so maybe it is
-                // just a continuation  for this line, keep going
-                if (!IsEntityDef(snext)) {
-                    s.append(snext);
-                    n1 = s.find_first_of('(',n0);
-                    ok = (n1 != std::string::npos);
-                }
-                else {
+        // the entity may continue on the next lines, keep going until the next entity
+        // starts, lines within strings and comments never start an entity
+        std::string::size_type n1 = s.find_first_of('(', n0);
+        std::string::size_type n2 = s.find_last_of(')');
+        const auto complete = [&]() {
+            return n1 != std::string::npos && !(n2 == std::string::npos || n2 < n1 || n2 == s.length() - 1 || s[n2 + 1] != ';');
+        };
+        if (!complete() || lexer.InToken()) {
+            while (cur != end) {
+                eol = FindLineEnd(cur, end);
+                if (!lexer.InToken() && (IsEntityDef(cur, eol) || IsEndSection(cur, eol))) {
                     break;
                 }
+                lexer.ConsumeLine(cur, eol);
+                std::remove_copy(cur, eol, std::back_inserter(s), ' ');
+                cur = SkipToNextLine(eol, end, line);
             }
-
-            if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \'(\'",line));
+            n1 = s.find_first_of('(', n0);
+            n2 = s.find_last_of(')');
+            if (n1 == std::string::npos) {
+                out.warnings.emplace_back(entity_line, "expected token \'(\'");
                 continue;
             }
-        }
-
-        std::string::size_type n2 = s.find_last_of(')');
-        if (n2 == std::string::npos || n2 < n1 || n2 == s.length() - 1 || s[n2 + 1] != ';') {
-            has_next = true;
-            bool ok = false;
-            for( ++splitter; splitter; ++splitter) {
-                const std::string& snext = *splitter;
-                if (snext.empty()) {
-                    continue;
-                }
-
-                // the next line doesn't start an entity, so maybe it is
-                // just a continuation  for this line, keep going
-                if (!IsEntityDef(snext)) {
-                    s.append(snext);
-                    n2 = s.find_last_of(')');
-                    ok = !(n2 == std::string::npos || n2 < n1 || n2 == s.length() - 1 || s[n2 + 1] != ';');
-                } else {
-                    break;
-                }
-            }
-            if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \')\'",line));
+            if (!complete()) {
+                out.warnings.emplace_back(entity_line, "expected token \')\'");
                 continue;
             }
         }
 
-        if (map.find(id) != map.end()) {
-            ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
-        }
-
         std::string::size_type ns = n0;
         do {
             ++ns;
@@ -273,31 +335,163 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         do {
             --ne;
         } while (IsSpace(s.at(ne)));
-        std::string type = s.substr(ns, ne - ns + 1);
-        type = ai_tolower(type);
+        type.assign(s, ns, ne - ns + 1);
+        std::transform(type.begin(), type.end(), type.begin(), &ai_tolower<char>);
         const char* sz = scheme.GetStaticStringForToken(type);
-        if(sz) {
-            const std::string::size_type szLen = n2-n1+1;
-            char* const copysz = new char[szLen+1];
-            std::copy(s.c_str()+n1,s.c_str()+n2+1,copysz);
+        if (sz) {
+            const std::string::size_type szLen = n2 - n1 + 1;
+            std::unique_ptr<char[]> copysz(new char[szLen + 1]);
+            std::copy(s.c_str() + n1, s.c_str() + n2 + 1, copysz.get());
             copysz[szLen] = '\0';
-            db.InternInsert(new LazyObject(db,id,line,sz,copysz));
+            out.records.push_back(EntityRecord{ id, entity_line, sz, std::move(copysz) });
         }
-        if(!has_next) {
-            ++splitter;
+    }
+
+    // count the remaining lines for the line numbers of the next chunk
+    out.lines = line + static_cast<uint64_t>(std::count(cur, end, '\n'));
+}
+
+}
+
+
+// ------------------------------------------------------------------------------------------------
+std::vector<const char*> STEP::SplitDataSection(const char* begin, const char* end, size_t numChunks)
+{
+    std::vector<const char*> bounds(1, begin);
+    if (numChunks > 1) {
+        // the string and comment state at a position is only known after scanning everything
+        // before it, so this is done serially, the scan is cheap compared to parsing
+        const size_t chunk_size = static_cast<size_t>(end - begin) / numChunks;
+        const char* target = begin + chunk_size;
+        RecordLexer lexer;
+        for (const char* cur = begin; cur != end;) {
+            const char* const eol = FindLineEnd(cur, end);
+            const bool record_end = lexer.ConsumeLine(cur, eol);
+            for (cur = eol; cur != end && (*cur == '\n' || *cur == '\r'); ++cur);
+            if (record_end && cur >= target && cur != end) {
+                bounds.push_back(cur);
+                if (bounds.size() == numChunks) {
+                    break;
+                }
+                target = begin + chunk_size * bounds.size();
+            }
         }
     }
+    bounds.push_back(end);
+    return bounds;
+}
 
+// ------------------------------------------------------------------------------------------------
+void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
+    const char* const* types_to_track, size_t len,
+    const char* const* inverse_indices_to_track, size_t len2)
+{
+    db.SetSchema(scheme);
+    db.SetTypesToTrack(types_to_track,len);
+    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+
+    LineSplitter& splitter = db.GetSplitter();
     if (!splitter) {
         ASSIMP_LOG_WARN("STEP: ignoring unexpected EOF");
+        return;
+    }
+
+    // the whole file is in memory, work on the buffer directly rather than line by line.
+    // The splitter has already consumed the first line of the DATA section, find it
+    // again in the buffer.
+    StreamReaderLE& stream = splitter.get_stream();
+    const char* const buffer = reinterpret_cast<const char*>(stream.GetPtr()) - stream.GetCurrentPos();
+    const char* const end = reinterpret_cast<const char*>(stream.GetPtr()) + stream.GetRemainingSize();
+    const std::string& first = *splitter.operator->();
+    const char* begin = reinterpret_cast<const char*>(stream.GetPtr());
+    for (size_t offset = first.length(); offset <= static_cast<size_t>(begin - buffer); ++offset) {
+        if (std::equal(first.begin(), first.end(), begin - offset)) {
+            begin -= offset;
+            break;
+        }
+    }
+
+    // want one-based line numbers for human readers, so +1
+    const uint64_t first_line = splitter.get_index()+1;
+
+    // split the section into chunks at entity boundaries and scan them in parallel
+    const size_t size = static_cast<size_t>(end - begin);
+    const size_t max_chunks = size < 2 * MinChunkSize ? 1 : std::min<size_t>(size / MinChunkSize, GetNumWorkerThreads() * 4);
+    const std::vector<const char*> bounds = SplitDataSection(begin, end, max_chunks);
+    const size_t num_chunks = bounds.size() - 1;
+
+    std::vector<ChunkResult> chunks(num_chunks);
+    ParallelFor(num_chunks, [&](size_t i) {
+        ScanChunk(bounds[i], bounds[i + 1], scheme, chunks[i]);
+    });
+
+    size_t count = 0;
+    uint64_t max_id = 0;
+    for (const ChunkResult& chunk : chunks) {
+        count += chunk.records.size();
+        for (const EntityRecord& record : chunk.records) {
+            max_id = std::max(max_id, record.id);
+        }
+    }
+    db.InternReserve(count, max_id);
+
+    // create the objects in file order
+    bool end_of_section = false;
+    uint64_t chunk_line = first_line;
+    for (ChunkResult& chunk : chunks) {
+        for (const std::pair<uint64_t, std::string>& warning : chunk.warnings) {
+            ASSIMP_LOG_WARN(AddLineNumber(warning.second, chunk_line + warning.first));
+        }
+        for (EntityRecord& record : chunk.records) {
+            const uint64_t line = chunk_line + record.line;
+            if (db.GetObject(record.id)) {
+                ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",record.id," already exists"),line));
+            }
+            db.InternInsert(new LazyObject(db,record.id,line,record.type,record.args.release()));
+        }
+        if (chunk.end_of_section) {
+            end_of_section = true;
+            break;
+        }
+        chunk_line += chunk.lines;
+    }
+
+    if (!end_of_section) {
+        ASSIMP_LOG_WARN("STEP: ignoring unexpected EOF");
     }
 
+    db.refs.Build();
+
     if ( !DefaultLogger::isNullLogger()){
-        ASSIMP_LOG_DEBUG("STEP: got ",map.size()," object records with ",
+        ASSIMP_LOG_DEBUG("STEP: got ",db.GetObjectCount()," object records with ",
             db.GetRefs().size()," inverse index entries");
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void STEP::DB::RefMap::Build() {
+    // group the references by the referenced object, keep the file order within a group
+    std::stable_sort(pending.begin(), pending.end(),
+            [](const std::pair<uint64_t, uint64_t>& a, const std::pair<uint64_t, uint64_t>& b) {
+                return a.first < b.first;
+            });
+
+    ids.clear();
+    rows.clear();
+    referrers.clear();
+    referrers.reserve(pending.size());
+    for (const std::pair<uint64_t, uint64_t>& ref : pending) {
+        if (ids.empty() || ids.back() != ref.first) {
+            ids.push_back(ref.first);
+            rows.push_back(referrers.size());
+        }
+        referrers.push_back(ref.second);
+    }
+    rows.push_back(referrers.size());
+
+    std::vector<std::pair<uint64_t, uint64_t>>().swap(pending);
+}
+
 // ------------------------------------------------------------------------------------------------
 std::shared_ptr<const EXPRESS::DataType> EXPRESS::DataType::Parse(const char*& inout, const char *end, uint64_t line, const EXPRESS::ConversionSchema* schema /*= nullptr*/)
 {
@@ -487,7 +681,7 @@ STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const char*
 , type(type)
 , db(db)
 , args(args)
-, obj() {
+, obj(nullptr) {
     // find any external references and store them in the database.
     // this helps us emulate STEPs INVERSE fields.
     if (!db.KeepInverseIndicesForType(type)) {
@@ -514,15 +708,21 @@ STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const char*
 // ------------------------------------------------------------------------------------------------
 STEP::LazyObject::~LazyObject() {
     // make sure the right dtor/operator delete get called
-    if (obj) {
-        delete obj;
+    if (Object *const o = obj.load()) {
+        delete o;
     } else {
         delete[] args;
     }
 }
 
 // ------------------------------------------------------------------------------------------------
-void STEP::LazyObject::LazyInit() const {
+STEP::Object *STEP::LazyObject::LazyInit() const {
+    // another thread may have evaluated this object while we were waiting for the lock
+    std::lock_guard<std::mutex> lock(db.GetInitMutex(id));
+    if (Object *const o = obj.load(std::memory_order_relaxed)) {
+        return o;
+    }
+
     const EXPRESS::ConversionSchema& schema = db.GetSchema();
     STEP::ConvertObjectProc proc = schema.GetConverterProc(type);
 
@@ -537,16 +737,19 @@ void STEP::LazyObject::LazyInit() const {
     args = nullptr;
 
     // if the converter fails, it should throw an exception, but it should never return nullptr
+    Object *o = nullptr;
     try {
-        obj = proc(db,*conv_args);
+        o = proc(db,*conv_args);
     }
     catch(const TypeError& t) {
         // augment line and entity information
         throw TypeError(t.what(),id);
     }
     ++db.evaluated_count;
-    ai_assert(obj);
+    ai_assert(o);
 
     // store the original id in the object instance
-    obj->SetID(id);
+    o->SetID(id);
+    obj.store(o, std::memory_order_release);
+    return o;
 }
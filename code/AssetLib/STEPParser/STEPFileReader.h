@@ -44,6 +44,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssetLib/Step/STEPFile.h"
 
+#include <vector>
+
 namespace Assimp {
 namespace STEP {
 
@@ -57,6 +59,12 @@ DB* ReadFileHeader(std::shared_ptr<IOStream> stream);
 ///    conversion functions to interpret the data.
 void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme, const char* const* types_to_track, size_t len, const char* const* inverse_indices_to_track, size_t len2);
 
+/// @brief  Splits the DATA section [begin, end) into at most numChunks pieces
+///   which can be scanned independently. A piece only ends behind a ';' which
+///   terminates a line outside of string literals and comments.
+/// @return The boundaries of the pieces, starting with begin and ending with end.
+ASSIMP_API std::vector<const char*> SplitDataSection(const char* begin, const char* end, size_t numChunks);
+
 /// @brief  Helper to read a file.
 template <size_t N, size_t N2>
 inline void ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme, const char* const (&arr)[N], const char* const (&arr2)[N2]) {
@@ -46,7 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_STLEXPORTER_H_INC
 #define AI_STLEXPORTER_H_INC
 
-#include <sstream>
+#include <string>
 
 struct aiScene;
 struct aiNode;
@@ -54,16 +54,18 @@ struct aiMesh;
 
 namespace Assimp {
 
+class TextStreamWriter;
+
 // ------------------------------------------------------------------------------------------------
 /** Helper class to export a given scene to a STL file. */
 // ------------------------------------------------------------------------------------------------
 class STLExporter {
 public:
     /// Constructor for a specific scene to export
-    STLExporter(const char *filename, const aiScene *pScene, bool exportPOintClouds, bool binary = false);
+    STLExporter(const char *filename, const aiScene *pScene, TextStreamWriter &out, bool exportPOintClouds, bool binary = false);
 
-    /// public string-streams to write all output into
-    std::ostringstream mOutput;
+    /// The writer all output goes to
+    TextStreamWriter &mOutput;
 
 private:
     void WritePointCloud(const std::string &name, const aiScene *pScene);
@@ -42,11 +42,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef INCLUDED_AI_STEPFILE_H
 #define INCLUDED_AI_STEPFILE_H
 
+#include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include "AssetLib/FBX/FBXDocument.h" //ObjectMap::value_type
@@ -512,19 +516,21 @@ public:
     ~LazyObject();
 
     Object &operator*() {
-        if (!obj) {
-            LazyInit();
-            ai_assert(obj);
+        Object *o = obj.load(std::memory_order_acquire);
+        if (!o) {
+            o = LazyInit();
+            ai_assert(o);
         }
-        return *obj;
+        return *o;
     }
 
     const Object &operator*() const {
-        if (!obj) {
-            LazyInit();
-            ai_assert(obj);
+        const Object *o = obj.load(std::memory_order_acquire);
+        if (!o) {
+            o = LazyInit();
+            ai_assert(o);
         }
-        return *obj;
+        return *o;
     }
 
     template <typename T>
@@ -568,14 +574,16 @@ public:
     }
 
 private:
-    void LazyInit() const;
+    Object *LazyInit() const;
 
 private:
     mutable uint64_t id;
     const char *const type;
     DB &db;
     mutable const char *args;
-    mutable Object *obj;
+
+    // objects may be evaluated from several threads at once, see DB::GetInitMutex()
+    mutable std::atomic<Object *> obj;
 };
 
 template <typename T>
@@ -752,12 +760,12 @@ class DB {
     friend class LazyObject;
 
 public:
-    // objects indexed by ID - this can grow pretty large (i.e some hundred million
-    // entries), so use raw pointers to avoid *any* overhead.
-    typedef std::map<uint64_t, const LazyObject *> ObjectMap;
+    // all objects in the order they appear in the file - this can grow pretty large
+    // (i.e some hundred million entries), so use raw pointers to avoid *any* overhead.
+    typedef std::vector<const LazyObject *> ObjectList;
 
     // objects indexed by their declarative type, but only for those that we truly want
-    typedef std::set<const LazyObject *> ObjectSet;
+    typedef std::vector<const LazyObject *> ObjectSet;
     typedef std::map<std::string, ObjectSet> ObjectMapByType;
 
     // list of types for which to keep inverse indices for all references
@@ -767,17 +775,54 @@ public:
 
     // references - for each object id the ids of all objects which reference it
     // this is used to simulate STEP inverse indices for selected types.
-    typedef std::step_unordered_multimap<uint64_t, uint64_t> RefMap;
+    // The referencing ids are kept in one array, grouped by the referenced id
+    // in ascending order, so a lookup is a binary search over the referenced ids.
+    class RefMap {
+        friend class DB;
+        friend void ReadFile(DB &db, const EXPRESS::ConversionSchema &scheme,
+                const char *const *types_to_track, size_t len,
+                const char *const *inverse_indices_to_track, size_t len2);
+
+    public:
+        typedef const uint64_t *const_iterator;
+
+        // the ids of all objects referencing the given object, in file order
+        std::pair<const_iterator, const_iterator> equal_range(uint64_t id) const {
+            const std::vector<uint64_t>::const_iterator it = std::lower_bound(ids.begin(), ids.end(), id);
+            if (it == ids.end() || *it != id) {
+                return std::make_pair(const_iterator(), const_iterator());
+            }
+            const size_t row = static_cast<size_t>(it - ids.begin());
+            return std::make_pair(referrers.data() + rows[row], referrers.data() + rows[row + 1]);
+        }
+
+        size_t size() const {
+            return referrers.size();
+        }
+
+    private:
+        void Insert(uint64_t who, uint64_t by_whom) {
+            pending.emplace_back(who, by_whom);
+        }
+
+        void Build();
+
+    private:
+        std::vector<std::pair<uint64_t, uint64_t>> pending;
+        std::vector<uint64_t> ids;
+        std::vector<size_t> rows;
+        std::vector<uint64_t> referrers;
+    };
     typedef std::pair<RefMap::const_iterator, RefMap::const_iterator> RefMapRange;
 
 private:
     DB(const std::shared_ptr<StreamReaderLE> &reader) :
-            reader(reader), splitter(*reader, true, true), evaluated_count(), schema(nullptr) {}
+            reader(reader), splitter(*reader, true, true), evaluated_count(0), schema(nullptr) {}
 
 public:
     ~DB() {
-        for (ObjectMap::value_type &o : objects) {
-            delete o.second;
+        for (const LazyObject *o : objects) {
+            delete o;
         }
     }
 
@@ -797,7 +842,7 @@ public:
         return *schema;
     }
 
-    const ObjectMap &GetObjects() const {
+    const ObjectList &GetObjects() const {
         return objects;
     }
 
@@ -815,8 +860,14 @@ public:
 
     // get the yet unevaluated object record with a given id
     const LazyObject *GetObject(uint64_t id) const {
-        const ObjectMap::const_iterator it = objects.find(id);
-        if (it != objects.end()) {
+        if (id < objects_byid.size()) {
+            return objects_byid[id];
+        }
+        if (objects_sparse.empty()) {
+            return nullptr;
+        }
+        const std::unordered_map<uint64_t, const LazyObject *>::const_iterator it = objects_sparse.find(id);
+        if (it != objects_sparse.end()) {
             return (*it).second;
         }
         return nullptr;
@@ -826,7 +877,7 @@ public:
     const LazyObject *GetObject(const std::string &type) const {
         const ObjectMapByType::const_iterator it = objects_bytype.find(type);
         if (it != objects_bytype.end() && (*it).second.size()) {
-            return *(*it).second.begin();
+            return (*it).second.front();
         }
         return nullptr;
     }
@@ -852,8 +903,8 @@ public:
 
     // evaluate *all* entities in the file. this is a power test for the loader
     void EvaluateAll() {
-        for (ObjectMap::value_type &e : objects) {
-            **e.second;
+        for (const LazyObject *o : objects) {
+            **o;
         }
         ai_assert(evaluated_count == objects.size());
     }
@@ -868,12 +919,32 @@ private:
         return splitter;
     }
 
+    // STEP ids are usually dense, in this case objects are looked up
+    // in a table indexed by id rather than in a hash map.
+    void InternReserve(size_t count, uint64_t max_id) {
+        objects.reserve(objects.size() + count);
+        if (objects.empty() && max_id <= count * 4 + 1024) {
+            objects_byid.assign(static_cast<size_t>(max_id) + 1, nullptr);
+        } else {
+            objects_sparse.reserve(objects_sparse.size() + count);
+        }
+    }
+
     void InternInsert(const LazyObject *lz) {
-        objects[lz->GetID()] = lz;
+        objects.push_back(lz);
 
-        const ObjectMapByType::iterator it = objects_bytype.find(lz->type);
-        if (it != objects_bytype.end()) {
-            (*it).second.insert(lz);
+        const uint64_t id = lz->GetID();
+        if (id < objects_byid.size()) {
+            objects_byid[id] = lz;
+        } else {
+            objects_sparse[id] = lz;
+        }
+
+        for (const std::pair<const char *, ObjectSet *> &tracked : types_tracked) {
+            if (tracked.first == lz->type) {
+                tracked.second->push_back(lz);
+                break;
+            }
         }
     }
 
@@ -883,7 +954,13 @@ private:
 
     void SetTypesToTrack(const char *const *types, size_t N) {
         for (size_t i = 0; i < N; ++i) {
-            objects_bytype[types[i]] = ObjectSet();
+            ObjectSet &set = objects_bytype[types[i]];
+
+            // the type names of the objects are the static strings of the schema,
+            // so they can be compared by address
+            if (const char *const sz = schema->GetStaticStringForToken(types[i])) {
+                types_tracked.emplace_back(sz, &set);
+            }
         }
     }
 
@@ -900,19 +977,30 @@ private:
     }
 
     void MarkRef(uint64_t who, uint64_t by_whom) {
-        refs.insert(std::make_pair(who, by_whom));
+        refs.Insert(who, by_whom);
+    }
+
+    std::mutex &GetInitMutex(uint64_t id) const {
+        return init_mutexes[id % NumInitMutexes];
     }
 
 private:
     HeaderInfo header;
-    ObjectMap objects;
+    ObjectList objects;
+    std::vector<const LazyObject *> objects_byid;
+    std::unordered_map<uint64_t, const LazyObject *> objects_sparse;
     ObjectMapByType objects_bytype;
+    std::vector<std::pair<const char *, ObjectSet *>> types_tracked;
     RefMap refs;
     InverseWhitelist inv_whitelist;
     std::shared_ptr<StreamReaderLE> reader;
     LineSplitter splitter;
-    uint64_t evaluated_count;
+    std::atomic<uint64_t> evaluated_count;
     const EXPRESS::ConversionSchema *schema;
+
+    // striped locks serializing the evaluation of lazy objects
+    enum { NumInitMutexes = 64 };
+    mutable std::mutex init_mutexes[NumInitMutexes];
 };
 
 #ifdef _MSC_VER
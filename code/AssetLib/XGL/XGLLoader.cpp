@@ -44,7 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_XGL_IMPORTER
 
 #include "XGLLoader.h"
-#include "Common/Compression.h"
+#include "Common/CompressedIOStream.h"
 
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
@@ -95,10 +95,6 @@ const aiImporterDesc *XGLImporter::GetInfo() const {
 // ------------------------------------------------------------------------------------------------
 void XGLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSystem *pIOHandler) {
     clear();
-#ifndef ASSIMP_BUILD_NO_COMPRESSED_XGL
-	std::vector<char> uncompressed;
-#endif
-
 	m_scene = pScene;
 	std::shared_ptr<IOStream> stream(pIOHandler->Open(pFile, "rb"));
 
@@ -112,24 +108,17 @@ void XGLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 #ifdef ASSIMP_BUILD_NO_COMPRESSED_XGL
 		ThrowException("Cannot read ZGL file since Assimp was built without compression support");
 #else
-		std::unique_ptr<StreamReaderLE> raw_reader(new StreamReaderLE(stream));
-
-        Compression compression;
-        size_t total = 0l;
-        if (compression.open(Compression::Format::Binary, Compression::FlushMode::NoFlush, -Compression::MaxWBits)) {
-            // skip two extra bytes, zgl files do carry a crc16 upfront (I think)
-            raw_reader->IncPtr(2);
-            total = compression.decompress((unsigned char *)raw_reader->GetPtr(), raw_reader->GetRemainingSize(), uncompressed);
-            compression.close();
-        }
-		// replace the input stream with a memory stream
-        stream = std::make_shared<MemoryIOStream>(reinterpret_cast<uint8_t *>(uncompressed.data()), total);
+		// skip two extra bytes, zgl files do carry a crc16 upfront (I think)
+		stream->Seek(2, aiOrigin_SET);
+		// and decompress on the fly while the XML is read
+		stream = std::make_shared<CompressedIOStream>(stream, CompressedIOStream::Container::Raw);
 #endif
 	}
 
-	// parse the XML file
+	// parse the XML file, the size of a compressed stream is only known once it
+	// has been decompressed completely, so read it to its end instead of asking
     mXmlParser = new XmlParser;
-    if (!mXmlParser->parse(stream.get())) {
+    if (!mXmlParser->parseUntilEnd(stream.get())) {
         throw DeadlyImportError("XML parse error while loading XGL file ", pFile);
 	}
 
@@ -564,6 +564,7 @@ struct Accessor : public Object {
     AttribType::Value type; //!< Specifies if the attribute is a scalar, vector, or matrix. (required)
     std::vector<double> max; //!< Maximum value of each component in this attribute.
     std::vector<double> min; //!< Minimum value of each component in this attribute.
+    bool normalized = false; //!< Whether integer values are normalized to [0,1] resp. [-1,1].
     std::unique_ptr<Sparse> sparse;
     std::unique_ptr<Buffer> decodedBuffer; // Packed decoded data, returned instead of original bufferView if present
 
@@ -1150,6 +1151,7 @@ public:
         bool KHR_draco_mesh_compression;
         bool FB_ngon_encoding;
         bool KHR_texture_basisu;
+        bool KHR_mesh_quantization;
 
         Extensions() :
                 KHR_materials_pbrSpecularGlossiness(false),
@@ -1166,7 +1168,8 @@ public:
                 KHR_materials_anisotropy(false),
                 KHR_draco_mesh_compression(false),
                 FB_ngon_encoding(false),
-                KHR_texture_basisu(false) {
+                KHR_texture_basisu(false),
+                KHR_mesh_quantization(false) {
             // empty
         }
     } extensionsUsed;
@@ -1175,8 +1178,9 @@ public:
     struct RequiredExtensions {
         bool KHR_draco_mesh_compression;
         bool KHR_texture_basisu;
+        bool KHR_mesh_quantization;
 
-        RequiredExtensions() : KHR_draco_mesh_compression(false), KHR_texture_basisu(false) {
+        RequiredExtensions() : KHR_draco_mesh_compression(false), KHR_texture_basisu(false), KHR_mesh_quantization(false) {
             // empty
         }
     } extensionsRequired;
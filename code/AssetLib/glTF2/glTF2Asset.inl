@@ -1066,7 +1066,8 @@ inline void Accessor::WriteData(size_t _count, const void *src_buffer, size_t sr
     uint8_t *buffer_ptr = bufferView->buffer->GetPointer();
     size_t offset = byteOffset + bufferView->byteOffset;
 
-    size_t dst_stride = GetNumComponents() * GetBytesPerComponent();
+    // padded views define their own stride
+    const size_t dst_stride = bufferView->byteStride ? bufferView->byteStride : GetNumComponents() * GetBytesPerComponent();
 
     const uint8_t *src = reinterpret_cast<const uint8_t *>(src_buffer);
     uint8_t *dst = reinterpret_cast<uint8_t *>(buffer_ptr + offset);
@@ -115,8 +115,13 @@ namespace glTF2 {
         obj.AddMember("componentType", int(a.componentType), w.mAl);
         obj.AddMember("count", (unsigned int)a.count, w.mAl);
         obj.AddMember("type", StringRef(AttribType::ToString(a.type)), w.mAl);
+        if (a.normalized) {
+            obj.AddMember("normalized", true, w.mAl);
+        }
         Value vTmpMax, vTmpMin;
-        if (a.componentType == ComponentType_FLOAT) {
+        if (a.normalized) {
+            // bounds are optional for normalized attributes, skip them instead of converting
+        } else if (a.componentType == ComponentType_FLOAT) {
             obj.AddMember("max", MakeValue(vTmpMax, a.max, w.mAl), w.mAl);
             obj.AddMember("min", MakeValue(vTmpMin, a.min, w.mAl), w.mAl);
         } else {
@@ -1049,16 +1054,25 @@ namespace glTF2 {
             if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
                 exts.PushBack(StringRef("KHR_texture_basisu"), mAl);
             }
+
+            if (this->mAsset.extensionsUsed.KHR_mesh_quantization) {
+                exts.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+            }
         }
 
         if (!exts.Empty())
             mDoc.AddMember("extensionsUsed", exts, mAl);
 
-        //basisu extensionRequired
+        //basisu and quantization extensionRequired
         Value extsReq;
         extsReq.SetArray();
         if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
             extsReq.PushBack(StringRef("KHR_texture_basisu"), mAl);
+        }
+        if (this->mAsset.extensionsRequired.KHR_mesh_quantization) {
+            extsReq.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+        }
+        if (!extsReq.Empty()) {
             mDoc.AddMember("extensionsRequired", extsReq, mAl);
         }
     }
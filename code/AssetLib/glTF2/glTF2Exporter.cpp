@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AssetLib/glTF2/glTF2Exporter.h"
 #include "AssetLib/glTF2/glTF2AssetWriter.h"
 #include "PostProcessing/SplitLargeMeshes.h"
+#include "Common/VertexQuantization.h"
 
 #include <assimp/ByteSwapper.h>
 #include <assimp/Exceptional.h>
@@ -111,6 +112,7 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
 
     ExportMeshes();
     MergeMeshes();
+    InsertDequantizationNodes();
 
     ExportScene();
 
@@ -393,7 +395,8 @@ inline Ref<Accessor> ExportDataSparse(Asset &a, std::string &meshName, Ref<Buffe
     return acc;
 }
 inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &buffer,
-        size_t count, void *data, AttribType::Value typeIn, AttribType::Value typeOut, ComponentType compType, BufferViewTarget target = BufferViewTarget_NONE) {
+        size_t count, void *data, AttribType::Value typeIn, AttribType::Value typeOut, ComponentType compType, BufferViewTarget target = BufferViewTarget_NONE,
+        bool normalized = false) {
     if (!count || !data) {
         return Ref<Accessor>();
     }
@@ -402,11 +405,18 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     unsigned int numCompsOut = AttribType::GetNumComponents(typeOut);
     unsigned int bytesPerComp = ComponentTypeSize(compType);
 
+    // vertex attributes must be aligned to 4 bytes, pad smaller elements
+    size_t elementSize = numCompsOut * bytesPerComp;
+    size_t stride = 0;
+    if (target == BufferViewTarget_ARRAY_BUFFER && elementSize % 4 != 0) {
+        stride = (elementSize + 3) & ~size_t(3);
+    }
+
     size_t offset = buffer->byteLength;
     // make sure offset is correctly byte-aligned, as required by spec
     size_t padding = offset % bytesPerComp;
     offset += padding;
-    size_t length = count * numCompsOut * bytesPerComp;
+    size_t length = count * (stride ? stride : elementSize);
     buffer->Grow(length + padding);
 
     // bufferView
@@ -414,7 +424,7 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     bv->buffer = buffer;
     bv->byteOffset = offset;
     bv->byteLength = length; //! The target that the WebGL buffer should be bound to.
-    bv->byteStride = 0;
+    bv->byteStride = stride;
     bv->target = target;
 
     // accessor
@@ -424,6 +434,7 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     acc->componentType = compType;
     acc->count = count;
     acc->type = typeOut;
+    acc->normalized = normalized;
 
     // calculate min and max values
     SetAccessorRange(compType, acc, data, count, numCompsIn, numCompsOut);
@@ -1167,6 +1178,18 @@ void ExportSkin(Asset &mAsset, const aiMesh *aimesh, Ref<Mesh> &meshRef, Ref<Buf
     delete[] vertexJointData;
 }
 
+// Stores for each mesh the highest number of meshes of the nodes referencing it
+static void CollectMeshesPerNode(const aiNode *node, std::vector<unsigned int> &meshesPerNode) {
+    for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+        if (node->mMeshes[i] < meshesPerNode.size()) {
+            meshesPerNode[node->mMeshes[i]] = std::max(meshesPerNode[node->mMeshes[i]], node->mNumMeshes);
+        }
+    }
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        CollectMeshesPerNode(node->mChildren[i], meshesPerNode);
+    }
+}
+
 void glTF2Exporter::ExportMeshes() {
     typedef decltype(aiFace::mNumIndices) IndicesType;
 
@@ -1199,6 +1222,13 @@ void glTF2Exporter::ExportMeshes() {
     }
     //----------------------------------------
 
+    // Quantized positions need a dequantization transform on their node, so they are only
+    // used for meshes which are not merged with others, not skinned and not morphed
+    std::vector<unsigned int> meshesPerNode(mScene->mNumMeshes, 0);
+    if (mScene->mRootNode) {
+        CollectMeshesPerNode(mScene->mRootNode, meshesPerNode);
+    }
+
     for (unsigned int idx_mesh = 0; idx_mesh < mScene->mNumMeshes; ++idx_mesh) {
         const aiMesh *aim = mScene->mMeshes[idx_mesh];
         if (aim->mNumFaces == 0) {
@@ -1217,29 +1247,77 @@ void glTF2Exporter::ExportMeshes() {
         p.material = mAsset->materials.Get(aim->mMaterialIndex);
         p.ngonEncoded = (aim->mPrimitiveTypes & aiPrimitiveType_NGONEncodingFlag) != 0;
 
+        // KHR_mesh_quantization: use the data of the QuantizeVertices step if it is up to date
+        const aiQuantizedVertices *quantized = Quantization::HasCurrentQuantizedVertices(*aim) ? aim->mQuantizedVertices : nullptr;
+
         /******************* Vertices ********************/
-        Ref<Accessor> v = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mVertices, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        Ref<Accessor> v;
+        if (nullptr != quantized && !aim->HasBones() && aim->mNumAnimMeshes == 0 && meshesPerNode[idx_mesh] == 1) {
+            v = ExportData(*mAsset, meshId, b, aim->mNumVertices, quantized->mPositions, AttribType::VEC4,
+                    AttribType::VEC3, ComponentType_UNSIGNED_SHORT, BufferViewTarget_ARRAY_BUFFER);
+
+            aiMatrix4x4 scaling, translation;
+            aiMatrix4x4::Scaling(aiVector3D(quantized->mPositionScale), scaling);
+            aiMatrix4x4::Translation(quantized->mPositionOffset, translation);
+            mDequantizationTransforms[meshId] = translation * scaling;
+            mAsset->extensionsUsed.KHR_mesh_quantization = true;
+            mAsset->extensionsRequired.KHR_mesh_quantization = true;
+        } else {
+            v = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mVertices, AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        }
         if (v) {
             p.attributes.position.push_back(v);
         }
 
         /******************** Normals ********************/
-        // Normalize all normals as the validator can emit a warning otherwise
-        if (nullptr != aim->mNormals) {
-            for (auto i = 0u; i < aim->mNumVertices; ++i) {
-                aim->mNormals[i].NormalizeSafe();
+        Ref<Accessor> n;
+        if (nullptr != quantized && nullptr != quantized->mNormals) {
+            // glTF has no octahedron encoding, expand to normalized bytes
+            std::vector<int8_t> normals(aim->mNumVertices * 4, 0);
+            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                const aiVector3D normal = Quantization::DecodeOctahedron(Quantization::DecodeSNorm(quantized->mNormals[i * 2], 16),
+                        Quantization::DecodeSNorm(quantized->mNormals[i * 2 + 1], 16));
+                normals[i * 4] = static_cast<int8_t>(Quantization::EncodeSNorm(static_cast<float>(normal.x), 8));
+                normals[i * 4 + 1] = static_cast<int8_t>(Quantization::EncodeSNorm(static_cast<float>(normal.y), 8));
+                normals[i * 4 + 2] = static_cast<int8_t>(Quantization::EncodeSNorm(static_cast<float>(normal.z), 8));
+            }
+            n = ExportData(*mAsset, meshId, b, aim->mNumVertices, &normals[0], AttribType::VEC4,
+                    AttribType::VEC3, ComponentType_BYTE, BufferViewTarget_ARRAY_BUFFER, true);
+            mAsset->extensionsUsed.KHR_mesh_quantization = true;
+            mAsset->extensionsRequired.KHR_mesh_quantization = true;
+        } else {
+            // Normalize all normals as the validator can emit a warning otherwise
+            if (nullptr != aim->mNormals) {
+                for (auto i = 0u; i < aim->mNumVertices; ++i) {
+                    aim->mNormals[i].NormalizeSafe();
+                }
             }
-        }
 
-        Ref<Accessor> n = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mNormals, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            n = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mNormals, AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        }
         if (n) {
             p.attributes.normal.push_back(n);
         }
 
         /******************** Tangents ********************/
-        if (nullptr != aim->mTangents && nullptr != aim->mBitangents) {
+        if (nullptr != quantized && nullptr != quantized->mTangents && nullptr != quantized->mNormals) {
+            std::vector<int8_t> tangents(aim->mNumVertices * 4);
+            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                const aiVector3D tangent = Quantization::DecodeOctahedron(Quantization::DecodeSNorm(quantized->mTangents[i * 4], 16),
+                        Quantization::DecodeSNorm(quantized->mTangents[i * 4 + 1], 16));
+                tangents[i * 4] = static_cast<int8_t>(Quantization::EncodeSNorm(static_cast<float>(tangent.x), 8));
+                tangents[i * 4 + 1] = static_cast<int8_t>(Quantization::EncodeSNorm(static_cast<float>(tangent.y), 8));
+                tangents[i * 4 + 2] = static_cast<int8_t>(Quantization::EncodeSNorm(static_cast<float>(tangent.z), 8));
+                tangents[i * 4 + 3] = quantized->mTangents[i * 4 + 2] < 0 ? -127 : 127;
+            }
+            Ref<Accessor> t = ExportData(*mAsset, meshId, b, aim->mNumVertices, &tangents[0], AttribType::VEC4,
+                    AttribType::VEC4, ComponentType_BYTE, BufferViewTarget_ARRAY_BUFFER, true);
+            if (t) {
+                p.attributes.tangent.push_back(t);
+            }
+        } else if (nullptr != aim->mTangents && nullptr != aim->mBitangents) {
           // Find the handedness by calculating the bitangent without the handedness factor,
           // the use a dot product to find out if the original bitangent was inverted (multiplied
           // by a factor of -1.0) or not (multiplied by 1.0)
@@ -1270,6 +1348,27 @@ void glTF2Exporter::ExportMeshes() {
                 continue;
             }
 
+            // glTF has no half floats, but flipped coordinates in [0,1] fit normalized shorts
+            if (nullptr != quantized && nullptr != quantized->mTextureCoords[i] && aim->mNumUVComponents[i] == 2) {
+                std::vector<uint16_t> texcoords(aim->mNumVertices * 2);
+                bool inRange = true;
+                for (unsigned int j = 0; j < aim->mNumVertices && inRange; ++j) {
+                    const float s = Quantization::DecodeHalf(quantized->mTextureCoords[i][j * 2]);
+                    const float t = 1.f - Quantization::DecodeHalf(quantized->mTextureCoords[i][j * 2 + 1]);
+                    inRange = s >= 0.f && s <= 1.f && t >= 0.f && t <= 1.f;
+                    texcoords[j * 2] = static_cast<uint16_t>(Quantization::EncodeUNorm(s, 16));
+                    texcoords[j * 2 + 1] = static_cast<uint16_t>(Quantization::EncodeUNorm(t, 16));
+                }
+                if (inRange) {
+                    Ref<Accessor> tc = ExportData(*mAsset, meshId, b, aim->mNumVertices, &texcoords[0],
+                            AttribType::VEC2, AttribType::VEC2, ComponentType_UNSIGNED_SHORT, BufferViewTarget_ARRAY_BUFFER, true);
+                    if (tc) {
+                        p.attributes.texcoord.push_back(tc);
+                    }
+                    continue;
+                }
+            }
+
             // Flip UV y coords
             if (aim->mNumUVComponents[i] > 1) {
                 for (unsigned int j = 0; j < aim->mNumVertices; ++j) {
@@ -1290,8 +1389,14 @@ void glTF2Exporter::ExportMeshes() {
 
         /*************** Vertex colors ****************/
         for (unsigned int indexColorChannel = 0; indexColorChannel < aim->GetNumColorChannels(); ++indexColorChannel) {
-            Ref<Accessor> c = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mColors[indexColorChannel],
-                    AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            Ref<Accessor> c;
+            if (nullptr != quantized && nullptr != quantized->mColors[indexColorChannel]) {
+                c = ExportData(*mAsset, meshId, b, aim->mNumVertices, quantized->mColors[indexColorChannel],
+                        AttribType::VEC4, AttribType::VEC4, ComponentType_UNSIGNED_BYTE, BufferViewTarget_ARRAY_BUFFER, true);
+            } else {
+                c = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mColors[indexColorChannel],
+                        AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            }
             if (c) {
                 p.attributes.color.push_back(c);
             }
@@ -1504,6 +1609,33 @@ void glTF2Exporter::MergeMeshes() {
     }
 }
 
+// Moves meshes with quantized positions into a child node which holds the dequantization transform
+void glTF2Exporter::InsertDequantizationNodes() {
+    if (mDequantizationTransforms.empty()) {
+        return;
+    }
+
+    const unsigned int numNodes = mAsset->nodes.Size();
+    for (unsigned int n = 0; n < numNodes; ++n) {
+        Ref<Node> node = mAsset->nodes.Get(n);
+        if (node->meshes.size() != 1) {
+            continue;
+        }
+        auto it = mDequantizationTransforms.find(node->meshes[0]->id);
+        if (it == mDequantizationTransforms.end()) {
+            continue;
+        }
+
+        Ref<Node> child = mAsset->nodes.Create(mAsset->FindUniqueID(node->name, "dequantize"));
+        child->name = child->id;
+        child->parent = node;
+        child->matrix.isPresent = true;
+        CopyValue(it->second, child->matrix.value);
+        child->meshes.swap(node->meshes);
+        node->children.emplace_back(child);
+    }
+}
+
 /*
  * Export the root node of the node hierarchy.
  * Calls ExportNode for all children.
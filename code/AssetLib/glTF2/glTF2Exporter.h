@@ -132,6 +132,7 @@ protected:
     void ExportMaterials();
     void ExportMeshes();
     void MergeMeshes();
+    void InsertDequantizationNodes();
     unsigned int ExportNodeHierarchy(const aiNode *n);
     unsigned int ExportNode(const aiNode *node, glTFCommon::Ref<glTF2::Node> &parent);
     void ExportScene();
@@ -145,6 +146,7 @@ private:
     std::map<std::string, unsigned int> mTexturesByPath;
     std::shared_ptr<glTF2::Asset> mAsset;
     std::vector<unsigned char> mBodyData;
+    std::map<std::string, aiMatrix4x4> mDequantizationTransforms;
     ai_real configEpsilon;
 };
 
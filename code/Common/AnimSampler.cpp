@@ -0,0 +1,284 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file  AnimSampler.cpp
+ *  @brief Implementation of the animation sampler
+ */
+
+#include <assimp/AnimSampler.h>
+#include <assimp/ai_assert.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Number of keys to step over before falling back to a binary search
+constexpr unsigned int MaxLinearSteps = 4;
+
+// ------------------------------------------------------------------------------------------------
+// Finds the last key at or before the given time, starting at the cached cursor
+template <typename KeyType>
+unsigned int Seek(const KeyType *keys, unsigned int numKeys, double time, unsigned int &cursor) {
+    const auto before = [](double t, const KeyType &key) { return t < key.mTime; };
+
+    unsigned int i = std::min(cursor, numKeys - 1);
+    if (keys[i].mTime <= time) {
+        for (unsigned int n = 0; n < MaxLinearSteps && i + 1 < numKeys && keys[i + 1].mTime <= time; ++n) {
+            ++i;
+        }
+        if (i + 1 < numKeys && keys[i + 1].mTime <= time) {
+            i = static_cast<unsigned int>(std::upper_bound(keys + i + 1, keys + numKeys, time, before) - keys) - 1;
+        }
+    } else {
+        i = static_cast<unsigned int>(std::upper_bound(keys, keys + i, time, before) - keys);
+        i = i > 0 ? i - 1 : 0;
+    }
+    cursor = i;
+    return i;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Selects the two values to interpolate for a track and returns the interpolation factor
+template <typename KeyType, typename ValueType>
+ai_real Gather(const KeyType *keys, unsigned int numKeys, double time, const aiNodeAnim *channel,
+        bool extrapolate, const ValueType &def, unsigned int &cursor, ValueType &a, ValueType &b) {
+    if (numKeys < 2) {
+        a = b = numKeys ? keys[0].mValue : def;
+        return ai_real(0.0);
+    }
+
+    const double first = keys[0].mTime, last = keys[numKeys - 1].mTime;
+    if (time < first || time > last) {
+        const aiAnimBehaviour behaviour = time < first ? channel->mPreState : channel->mPostState;
+        if (behaviour == aiAnimBehaviour_REPEAT && last > first) {
+            time = first + std::fmod(time - first, last - first);
+            if (time < first) {
+                time += last - first;
+            }
+        } else if (behaviour == aiAnimBehaviour_LINEAR && extrapolate) {
+            const KeyType &ka = time < first ? keys[0] : keys[numKeys - 2];
+            const KeyType &kb = time < first ? keys[1] : keys[numKeys - 1];
+            a = ka.mValue;
+            b = kb.mValue;
+            return kb.mTime > ka.mTime ? static_cast<ai_real>((time - ka.mTime) / (kb.mTime - ka.mTime)) : ai_real(0.0);
+        } else {
+            a = b = time < first ? keys[0].mValue : keys[numKeys - 1].mValue;
+            return ai_real(0.0);
+        }
+    }
+
+    const unsigned int i = Seek(keys, numKeys, time, cursor);
+    const KeyType &ka = keys[i];
+    if (i + 1 == numKeys || ka.mInterpolation == aiAnimInterpolation_Step) {
+        a = b = ka.mValue;
+        return ai_real(0.0);
+    }
+    const KeyType &kb = keys[i + 1];
+    a = ka.mValue;
+    b = kb.mValue;
+    return kb.mTime > ka.mTime ? static_cast<ai_real>((time - ka.mTime) / (kb.mTime - ka.mTime)) : ai_real(0.0);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Appends a node and all of its children, parents first
+void AddNodes(const aiNode *node, int parent, std::vector<const aiNode *> &nodes, std::vector<int> &parents) {
+    const int index = static_cast<int>(nodes.size());
+    nodes.push_back(node);
+    parents.push_back(parent);
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        AddNodes(node->mChildren[i], index, nodes, parents);
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+AnimSampler::AnimSampler(const aiAnimation *pAnim, const aiNode *pRoot) :
+        mAnim(pAnim) {
+    ai_assert(nullptr != pAnim);
+    const unsigned int numChannels = pAnim->mNumChannels;
+    mCursors.assign(numChannels * 3, 0);
+    mPositions.resize(numChannels);
+    mRotations.resize(numChannels);
+    mScalings.resize(numChannels, aiVector3D(1, 1, 1));
+    mPositionsA.resize(numChannels);
+    mPositionsB.resize(numChannels);
+    mScalingsA.resize(numChannels);
+    mScalingsB.resize(numChannels);
+    mRotationsA.resize(numChannels);
+    mRotationsB.resize(numChannels);
+    mPositionFactors.resize(numChannels);
+    mRotationFactors.resize(numChannels);
+    mScalingFactors.resize(numChannels);
+    mDefaultPositions.resize(numChannels);
+    mDefaultRotations.resize(numChannels);
+    mDefaultScalings.resize(numChannels, aiVector3D(1, 1, 1));
+    mChannelNodes.assign(numChannels, -1);
+
+    if (nullptr == pRoot) {
+        return;
+    }
+    AddNodes(pRoot, -1, mNodes, mParents);
+    mNodeChannels.assign(mNodes.size(), -1);
+    mGlobalTransforms.resize(mNodes.size());
+
+    std::unordered_map<std::string, int> nodesByName;
+    for (size_t i = mNodes.size(); i-- > 0;) {
+        nodesByName[mNodes[i]->mName.C_Str()] = static_cast<int>(i);
+    }
+    for (unsigned int c = 0; c < numChannels; ++c) {
+        const auto it = nodesByName.find(pAnim->mChannels[c]->mNodeName.C_Str());
+        if (it == nodesByName.end()) {
+            continue;
+        }
+        mChannelNodes[c] = it->second;
+        mNodeChannels[it->second] = static_cast<int>(c);
+        mNodes[it->second]->mTransformation.Decompose(mDefaultScalings[c], mDefaultRotations[c], mDefaultPositions[c]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+double AnimSampler::GetTicks(double pSeconds, bool pLoop) const {
+    const double ticks = pSeconds * (mAnim->mTicksPerSecond != 0.0 ? mAnim->mTicksPerSecond : 25.0);
+    if (mAnim->mDuration <= 0.0) {
+        return 0.0;
+    }
+    if (pLoop) {
+        const double time = std::fmod(ticks, mAnim->mDuration);
+        return time < 0.0 ? time + mAnim->mDuration : time;
+    }
+    return std::min(std::max(ticks, 0.0), mAnim->mDuration);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimSampler::Sample(double pTicks) {
+    const unsigned int numChannels = GetNumChannels();
+    for (unsigned int c = 0; c < numChannels; ++c) {
+        const aiNodeAnim *channel = mAnim->mChannels[c];
+        mPositionFactors[c] = Gather(channel->mPositionKeys, channel->mNumPositionKeys, pTicks, channel, true,
+                mDefaultPositions[c], mCursors[c * 3], mPositionsA[c], mPositionsB[c]);
+        mRotationFactors[c] = Gather(channel->mRotationKeys, channel->mNumRotationKeys, pTicks, channel, false,
+                mDefaultRotations[c], mCursors[c * 3 + 1], mRotationsA[c], mRotationsB[c]);
+        mScalingFactors[c] = Gather(channel->mScalingKeys, channel->mNumScalingKeys, pTicks, channel, true,
+                mDefaultScalings[c], mCursors[c * 3 + 2], mScalingsA[c], mScalingsB[c]);
+    }
+
+    Lerp(mPositionsA.data(), mPositionsB.data(), mPositionFactors.data(), mPositions.data(), numChannels);
+    Slerp(mRotationsA.data(), mRotationsB.data(), mRotationFactors.data(), mRotations.data(), numChannels);
+    Lerp(mScalingsA.data(), mScalingsB.data(), mScalingFactors.data(), mScalings.data(), numChannels);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimSampler::Reset() {
+    std::fill(mCursors.begin(), mCursors.end(), 0u);
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimSampler::ComputeGlobalTransforms() {
+    for (size_t i = 0; i < mNodes.size(); ++i) {
+        const int c = mNodeChannels[i];
+        const aiMatrix4x4 local = c < 0 ? mNodes[i]->mTransformation : aiMatrix4x4(mScalings[c], mRotations[c], mPositions[c]);
+        mGlobalTransforms[i] = mParents[i] < 0 ? local : mGlobalTransforms[mParents[i]] * local;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimSampler::GetLocalTransforms(aiMatrix4x4 *pOut) const {
+    for (unsigned int c = 0; c < GetNumChannels(); ++c) {
+        pOut[c] = aiMatrix4x4(mScalings[c], mRotations[c], mPositions[c]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+int AnimSampler::FindNode(const char *pName) const {
+    for (size_t i = 0; i < mNodes.size(); ++i) {
+        if (mNodes[i]->mName == aiString(pName)) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimSampler::Lerp(const aiVector3D *pA, const aiVector3D *pB, const ai_real *pFactors,
+        aiVector3D *pOut, size_t pNum) {
+    for (size_t i = 0; i < pNum; ++i) {
+        const ai_real t = pFactors[i];
+        pOut[i].x = pA[i].x + (pB[i].x - pA[i].x) * t;
+        pOut[i].y = pA[i].y + (pB[i].y - pA[i].y) * t;
+        pOut[i].z = pA[i].z + (pB[i].z - pA[i].z) * t;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void AnimSampler::Slerp(const aiQuaternion *pA, const aiQuaternion *pB, const ai_real *pFactors,
+        aiQuaternion *pOut, size_t pNum) {
+    for (size_t i = 0; i < pNum; ++i) {
+        const aiQuaternion &a = pA[i], &b = pB[i];
+        const ai_real t = pFactors[i];
+
+        // take the shorter path, fall back to linear interpolation for very close rotations
+        ai_real cosom = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        const ai_real sign = cosom < ai_real(0.0) ? ai_real(-1.0) : ai_real(1.0);
+        cosom *= sign;
+        ai_real sclp = ai_real(1.0) - t, sclq = t;
+        if (ai_real(1.0) - cosom > ai_epsilon) {
+            const ai_real omega = std::acos(cosom);
+            const ai_real sinom = std::sin(omega);
+            sclp = std::sin((ai_real(1.0) - t) * omega) / sinom;
+            sclq = std::sin(t * omega) / sinom;
+        }
+        sclq *= sign;
+
+        pOut[i].w = sclp * a.w + sclq * b.w;
+        pOut[i].x = sclp * a.x + sclq * b.x;
+        pOut[i].y = sclp * a.y + sclq * b.y;
+        pOut[i].z = sclp * a.z + sclq * b.z;
+    }
+}
@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "CApi/CInterfaceIOWrapper.h"
 #include "Importer.h"
+#include "ParallelFor.h"
 #include "ScenePrivate.h"
 
 #include <list>
@@ -459,6 +460,11 @@ ASSIMP_API void aiEnableVerboseLogging(aiBool d) {
     gVerboseLogging = d;
 }
 
+// ------------------------------------------------------------------------------------------------
+ASSIMP_API void aiSetMaxWorkerThreads(unsigned int count) {
+    SetMaxWorkerThreads(count);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Returns the error text of the last failed import process.
 const char *aiGetErrorString() {
@@ -0,0 +1,272 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file  AsyncLogQueue.cpp
+ *  @brief Implementation of the per-thread log message buffers.
+ */
+#include "AsyncLogQueue.h"
+
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+/** @brief Single producer, single consumer byte ring holding the messages of one thread.
+ *
+ *  Each record is an 8 byte header followed by the zero terminated text, padded
+ *  to 8 bytes. Records never wrap around, a record which does not fit at the end
+ *  is preceded by a marker telling the reader to continue at the start.
+ */
+class LogRing {
+public:
+    static constexpr size_t Capacity = 64 * 1024;
+
+    explicit LogRing(std::thread::id owner) :
+            mData(new char[Capacity]), mHead(0), mTail(0), mOwner(owner) {
+        // empty
+    }
+
+    std::thread::id getOwner() const {
+        return mOwner;
+    }
+
+    bool empty() const {
+        return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+    }
+
+    size_t getFill() const {
+        return mHead.load(std::memory_order_relaxed) - mTail.load(std::memory_order_relaxed);
+    }
+
+    // Producer side, returns false if the ring is full.
+    bool tryPush(const char *message, size_t length, Logger::ErrorSeverity severity) {
+        const size_t recordSize = (sizeof(Header) + length + 1 + 7) & ~size_t(7);
+        ai_assert(recordSize <= Capacity / 2);
+
+        const size_t head = mHead.load(std::memory_order_relaxed);
+        const size_t pos = head % Capacity;
+        const size_t skip = Capacity - pos < recordSize ? Capacity - pos : 0;
+        if (Capacity - (head - mTail.load(std::memory_order_acquire)) < skip + recordSize) {
+            return false;
+        }
+
+        if (skip != 0) {
+            const Header marker = { WrapMarker, 0 };
+            ::memcpy(&mData[pos], &marker, sizeof(Header));
+        }
+        char *record = &mData[(pos + skip) % Capacity];
+        const Header header = { static_cast<uint32_t>(length), static_cast<uint32_t>(severity) };
+        ::memcpy(record, &header, sizeof(Header));
+        ::memcpy(record + sizeof(Header), message, length);
+        record[sizeof(Header) + length] = '\0';
+
+        mHead.store(head + skip + recordSize, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, passes each queued message to func.
+    template <typename Func>
+    void drain(Func &&func) {
+        const size_t head = mHead.load(std::memory_order_acquire);
+        size_t tail = mTail.load(std::memory_order_relaxed);
+        while (tail != head) {
+            const size_t pos = tail % Capacity;
+            Header header;
+            ::memcpy(&header, &mData[pos], sizeof(Header));
+            if (header.length == WrapMarker) {
+                tail += Capacity - pos;
+                continue;
+            }
+            func(&mData[pos + sizeof(Header)], static_cast<Logger::ErrorSeverity>(header.severity));
+            tail += (sizeof(Header) + header.length + 1 + 7) & ~size_t(7);
+            mTail.store(tail, std::memory_order_release);
+        }
+        mTail.store(tail, std::memory_order_release);
+    }
+
+private:
+    struct Header {
+        uint32_t length;
+        uint32_t severity;
+    };
+    static constexpr uint32_t WrapMarker = ~uint32_t(0);
+
+    std::unique_ptr<char[]> mData;
+    alignas(64) std::atomic<size_t> mHead;
+    alignas(64) std::atomic<size_t> mTail;
+    const std::thread::id mOwner;
+};
+
+namespace {
+
+// The ring a thread used last, queues are told apart by their id since a new
+// queue may reuse the address of a destroyed one.
+struct ThreadRingCache {
+    uint64_t queueId = 0;
+    std::shared_ptr<LogRing> ring;
+};
+
+thread_local ThreadRingCache tRingCache;
+
+std::atomic<uint64_t> gNextQueueId(1);
+
+// How long the flusher sleeps if nobody wakes it up.
+constexpr std::chrono::milliseconds FlushInterval(20);
+
+} // namespace
+
+// ----------------------------------------------------------------------------------
+AsyncLogQueue::AsyncLogQueue(Sink sink) :
+        mSink(std::move(sink)),
+        mId(gNextQueueId.fetch_add(1)),
+        mWakeup(false),
+        mStop(false) {
+    mFlusher = std::thread(&AsyncLogQueue::run, this);
+}
+
+// ----------------------------------------------------------------------------------
+AsyncLogQueue::~AsyncLogQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mStop = true;
+    }
+    mWakeCondition.notify_one();
+    mFlusher.join();
+    flush();
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogQueue::push(const char *message, Logger::ErrorSeverity severity) {
+    ai_assert(nullptr != message);
+
+    LogRing &ring = getThreadRing();
+    const size_t length = ::strlen(message);
+    while (!ring.tryPush(message, length, severity)) {
+        wakeFlusher();
+        std::this_thread::yield();
+    }
+
+    // errors are written out before returning, they may be followed by a crash
+    if (severity == Logger::Err) {
+        std::lock_guard<std::mutex> drainLock(mDrainMutex);
+        ring.drain(mSink);
+    } else if (ring.getFill() > LogRing::Capacity / 2) {
+        wakeFlusher();
+    }
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogQueue::flush() {
+    std::lock_guard<std::mutex> drainLock(mDrainMutex);
+
+    std::vector<std::shared_ptr<LogRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock(mRingMutex);
+        rings = mRings;
+    }
+    for (const std::shared_ptr<LogRing> &ring : rings) {
+        ring->drain(mSink);
+    }
+    rings.clear();
+
+    // forget the rings of threads which have exited
+    std::lock_guard<std::mutex> lock(mRingMutex);
+    mRings.erase(std::remove_if(mRings.begin(), mRings.end(), [](const std::shared_ptr<LogRing> &ring) {
+        return ring.use_count() == 1 && ring->empty();
+    }), mRings.end());
+}
+
+// ----------------------------------------------------------------------------------
+LogRing &AsyncLogQueue::getThreadRing() {
+    ThreadRingCache &cache = tRingCache;
+    if (cache.queueId == mId) {
+        return *cache.ring;
+    }
+
+    const std::thread::id self = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(mRingMutex);
+    std::shared_ptr<LogRing> ring;
+    for (const std::shared_ptr<LogRing> &candidate : mRings) {
+        if (candidate->getOwner() == self) {
+            ring = candidate;
+            break;
+        }
+    }
+    if (!ring) {
+        ring = std::make_shared<LogRing>(self);
+        mRings.push_back(ring);
+    }
+    cache.queueId = mId;
+    cache.ring = std::move(ring);
+    return *cache.ring;
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogQueue::wakeFlusher() {
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mWakeup = true;
+    }
+    mWakeCondition.notify_one();
+}
+
+// ----------------------------------------------------------------------------------
+void AsyncLogQueue::run() {
+    std::unique_lock<std::mutex> lock(mWakeMutex);
+    while (!mStop) {
+        mWakeCondition.wait_for(lock, FlushInterval, [this]() {
+            return mWakeup || mStop;
+        });
+        mWakeup = false;
+
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+} // namespace Assimp
@@ -0,0 +1,123 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file  AsyncLogQueue.h
+ *  @brief Per-thread message buffers for the asynchronous DefaultLogger mode.
+ */
+#pragma once
+#ifndef AI_ASYNCLOGQUEUE_H_INC
+#define AI_ASYNCLOGQUEUE_H_INC
+
+#include <assimp/Logger.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+class LogRing;
+
+// ----------------------------------------------------------------------------------
+/** @brief Collects log messages in per-thread ring buffers and hands them to a
+ *  sink from a background thread.
+ *
+ *  Every thread which logs gets its own single-producer ring, so pushing a
+ *  message never contends with other logging threads. A flusher thread drains
+ *  the rings periodically and whenever a ring fills up. Errors are drained by
+ *  the thread logging them before push() returns. Messages of
+ *  one thread keep their order, messages of different threads are only ordered
+ *  by the time they are drained.
+ */
+class AsyncLogQueue {
+public:
+    /// The receiver of the drained messages, never called concurrently.
+    using Sink = std::function<void(const char *message, Logger::ErrorSeverity severity)>;
+
+    /// @brief  The class constructor, starts the flusher thread.
+    /// @param  sink    The receiver of the messages.
+    explicit AsyncLogQueue(Sink sink);
+
+    /// @brief  The class destructor, stops the flusher and drains all pending messages.
+    ~AsyncLogQueue();
+
+    AsyncLogQueue(const AsyncLogQueue &) = delete;
+    AsyncLogQueue &operator=(const AsyncLogQueue &) = delete;
+
+    /// @brief  Queues a message, blocks only while the ring of the calling thread is full.
+    ///         An error drains the ring of the calling thread to the sink right away.
+    /// @param  message     The message, at most MAX_LOG_MESSAGE_LENGTH plus a short prefix.
+    /// @param  severity    The kind of the message.
+    void push(const char *message, Logger::ErrorSeverity severity);
+
+    /// @brief  Hands all messages queued so far to the sink, on the calling thread.
+    void flush();
+
+private:
+    LogRing &getThreadRing();
+    void wakeFlusher();
+    void run();
+
+private:
+    Sink mSink;
+    const uint64_t mId;
+
+    std::mutex mRingMutex;
+    std::vector<std::shared_ptr<LogRing>> mRings;
+
+    // serializes the consumers, the flusher and explicit flush() calls
+    std::mutex mDrainMutex;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    bool mWakeup;
+    bool mStop;
+    std::thread mFlusher;
+};
+
+} // namespace Assimp
+
+#endif // AI_ASYNCLOGQUEUE_H_INC
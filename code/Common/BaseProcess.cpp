@@ -92,6 +92,12 @@ void BaseProcess::ExecuteOnScene(Importer *pImp) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::IsExtraActive(unsigned int /*pExtraFlags*/) const {
+    // steps are selected by the regular post processing flags by default
+    return false;
+}
+
 // ------------------------------------------------------------------------------------------------
 void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
     // the default implementation does nothing
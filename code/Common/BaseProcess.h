@@ -195,6 +195,16 @@ public:
      */
     virtual bool IsActive(unsigned int pFlags) const = 0;
 
+    // -------------------------------------------------------------------
+    /**
+     * @brief Returns whether the processing step is present in the given
+     *   extra flags, see #AI_CONFIG_PP_EXTRA_STEPS.
+     * @param pExtraFlags A bitwise combination of #aiPostProcessExtraSteps.
+     * @return true if the process is present in this flag fields,
+     *   false if not. The default implementation returns false.
+     */
+    virtual bool IsExtraActive(unsigned int pExtraFlags) const;
+
     // -------------------------------------------------------------------
     /** Check whether this step expects its input vertex data to be
      *  in verbose format. */
@@ -0,0 +1,104 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ChunkedLineParser.h
+ *  @brief Helpers to parse independent lines of a text chunk in parallel.
+ *
+ *  Point-cloud-like text formats store one record per line. Once a chunk of
+ *  lines is in memory, the line boundaries are found in one cheap pass and
+ *  the expensive number parsing is spread over the worker threads.
+ */
+#pragma once
+#ifndef AI_CHUNKEDLINEPARSER_H_INC
+#define AI_CHUNKEDLINEPARSER_H_INC
+
+#include "ParallelFor.h"
+
+#include <assimp/ParsingUtils.h>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Assimp {
+
+/// @brief The begin and the end of a line, the end points to the line end character.
+using TextLine = std::pair<const char *, const char *>;
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Collects all non-empty lines of a chunk.
+/// @param begin    The begin of the chunk.
+/// @param end      The end of the chunk, the chunk must be terminated by a line end.
+/// @param lines    Receives the lines.
+inline void IndexLines(const char *begin, const char *end, std::vector<TextLine> &lines) {
+    lines.clear();
+    const char *lineBegin = nullptr;
+    for (const char *cur = begin; cur != end; ++cur) {
+        if (!IsLineEnd(*cur)) {
+            if (nullptr == lineBegin) {
+                lineBegin = cur;
+            }
+        } else if (nullptr != lineBegin) {
+            lines.emplace_back(lineBegin, cur);
+            lineBegin = nullptr;
+        }
+    }
+    if (nullptr != lineBegin) {
+        lines.emplace_back(lineBegin, end);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Calls func(index, begin, end) for each line, spread over the worker threads.
+///
+/// The lines must be independent of each other, see ParallelFor.
+/// @param lines    The lines, see IndexLines.
+/// @param func     The line parser, called as func(size_t, const char *, const char *).
+/// @param grain    The number of consecutive lines handed out at once.
+template <typename Func>
+void ParallelForLines(const std::vector<TextLine> &lines, Func &&func, size_t grain = 4096) {
+    ParallelFor(lines.size(), [&](size_t i) {
+        func(i, lines[i].first, lines[i].second);
+    }, grain);
+}
+
+} // namespace Assimp
+
+#endif // AI_CHUNKEDLINEPARSER_H_INC
@@ -0,0 +1,271 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file CompactVertex.h
+ *  @brief Defines a channel-aware, packed vertex buffer and an open-addressing
+ *  hash table to find identical vertices in it.
+ *
+ *  In contrast to #Assimp::Vertex, which always carries every possible vertex
+ *  component, a #CompactVertexBuffer only stores the channels which are
+ *  actually present in a mesh. For the common position + normal + 2D texture
+ *  coordinate case this is 8 values per vertex instead of 68.
+ */
+#pragma once
+#ifndef AI_COMPACTVERTEX_H_INC
+#define AI_COMPACTVERTEX_H_INC
+
+#include <assimp/mesh.h>
+#include <assimp/ai_assert.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Assimp {
+
+// --------------------------------------------------------------------------------------------
+/** @brief Stores the present vertex channels of a mesh interleaved and tightly packed.
+ *
+ *  Each channel (position, normal, tangent, bitangent, every texture coordinate set and every
+ *  color set) occupies exactly as many values as it has components. Texture coordinate sets
+ *  only store #aiMesh::mNumUVComponents values. The position is always the first channel. */
+// --------------------------------------------------------------------------------------------
+class CompactVertexBuffer {
+public:
+    /// Maximum number of channels a vertex may have
+    static constexpr unsigned int MaxChannels = 4 + AI_MAX_NUMBER_OF_TEXTURECOORDS + AI_MAX_NUMBER_OF_COLOR_SETS;
+
+    // ----------------------------------------------------------------------------
+    /** @brief Packs all vertices of a mesh.
+     *  @param mesh The mesh, must have positions. */
+    explicit CompactVertexBuffer(const aiMesh *mesh) :
+            mNumVertices(mesh->mNumVertices), mStride(0), mNumChannels(0) {
+        ai_assert(mesh->HasPositions());
+
+        AddChannel(3);
+        if (mesh->HasNormals()) {
+            AddChannel(3);
+        }
+        if (mesh->HasTangentsAndBitangents()) {
+            AddChannel(3);
+            AddChannel(3);
+        }
+        for (unsigned int i = 0; mesh->HasTextureCoords(i); ++i) {
+            AddChannel(GetNumUVComponents(mesh, i));
+        }
+        for (unsigned int i = 0; mesh->HasVertexColors(i); ++i) {
+            AddChannel(4);
+        }
+
+        mData.resize(static_cast<size_t>(mNumVertices) * mStride);
+        unsigned int offset = 0;
+        offset = Scatter<ai_real>(mesh->mVertices, 3, offset);
+        if (mesh->HasNormals()) {
+            offset = Scatter<ai_real>(mesh->mNormals, 3, offset);
+        }
+        if (mesh->HasTangentsAndBitangents()) {
+            offset = Scatter<ai_real>(mesh->mTangents, 3, offset);
+            offset = Scatter<ai_real>(mesh->mBitangents, 3, offset);
+        }
+        for (unsigned int i = 0; mesh->HasTextureCoords(i); ++i) {
+            offset = Scatter<ai_real>(mesh->mTextureCoords[i], GetNumUVComponents(mesh, i), offset);
+        }
+        for (unsigned int i = 0; mesh->HasVertexColors(i); ++i) {
+            offset = Scatter<float>(mesh->mColors[i], 4, offset);
+        }
+        ai_assert(offset == mStride);
+    }
+
+    // ----------------------------------------------------------------------------
+    /** @brief Get the packed values of a vertex */
+    const ai_real *Get(unsigned int idx) const {
+        ai_assert(idx < mNumVertices);
+        return &mData[static_cast<size_t>(idx) * mStride];
+    }
+
+    /// Number of packed values per vertex
+    unsigned int GetStride() const { return mStride; }
+
+    /// Number of vertices in the buffer
+    unsigned int GetNumVertices() const { return mNumVertices; }
+
+    // ----------------------------------------------------------------------------
+    /** @brief Computes a hash from the exact bit pattern of the vertex position.
+     *
+     *  -0 and +0 yield the same hash. Since only the position participates, two
+     *  vertices which are equal by #Equal() always have the same hash as long as
+     *  their positions are bitwise identical. */
+    uint32_t Hash(unsigned int idx) const {
+        const ai_real *v = Get(idx);
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (unsigned int i = 0; i < 3; ++i) {
+            const ai_real f = v[i] == ai_real(0.0) ? ai_real(0.0) : v[i];
+            uint64_t bits = 0;
+            ::memcpy(&bits, &f, sizeof(ai_real));
+            h ^= bits;
+            h *= 0x9e3779b97f4a7c15ull;
+            h ^= h >> 29;
+        }
+        return static_cast<uint32_t>(h ^ (h >> 32));
+    }
+
+    // ----------------------------------------------------------------------------
+    /** @brief Checks whether two vertices are equal.
+     *
+     *  Every channel is compared separately, two vertices are considered equal if
+     *  the squared distance of all of their channels is below the given epsilon. */
+    bool Equal(unsigned int a, unsigned int b, ai_real squareEpsilon) const {
+        const ai_real *va = Get(a), *vb = Get(b);
+        unsigned int i = 0;
+        for (unsigned int c = 0; c < mNumChannels; ++c) {
+            ai_real dist = 0.0;
+            for (; i < mChannelEnd[c]; ++i) {
+                const ai_real d = va[i] - vb[i];
+                dist += d * d;
+            }
+            if (dist > squareEpsilon) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static unsigned int GetNumUVComponents(const aiMesh *mesh, unsigned int set) {
+        const unsigned int comp = mesh->mNumUVComponents[set];
+        return comp > 0 && comp <= 3 ? comp : 3;
+    }
+
+    void AddChannel(unsigned int numComponents) {
+        ai_assert(mNumChannels < MaxChannels);
+        mStride += numComponents;
+        mChannelEnd[mNumChannels++] = mStride;
+    }
+
+    template <typename TReal, typename T>
+    unsigned int Scatter(const T *src, unsigned int numComponents, unsigned int offset) {
+        static_assert(sizeof(T) % sizeof(TReal) == 0, "vertex component is not made of TReal");
+        const TReal *in = reinterpret_cast<const TReal *>(src);
+        const unsigned int inStride = sizeof(T) / sizeof(TReal);
+        ai_real *out = mData.data() + offset;
+        for (unsigned int v = 0; v < mNumVertices; ++v, in += inStride, out += mStride) {
+            for (unsigned int c = 0; c < numComponents; ++c) {
+                out[c] = static_cast<ai_real>(in[c]);
+            }
+        }
+        return offset + numComponents;
+    }
+
+    std::vector<ai_real> mData;
+    unsigned int mNumVertices;
+    unsigned int mStride;
+    unsigned int mNumChannels;
+    unsigned int mChannelEnd[MaxChannels];
+};
+
+// --------------------------------------------------------------------------------------------
+/** @brief Open-addressing hash set of vertex indices into a #CompactVertexBuffer.
+ *
+ *  The table is sized once for the maximum number of vertices it will hold and uses
+ *  linear probing. Each slot keeps the full hash, so most probes are rejected without
+ *  touching the vertex data at all. */
+// --------------------------------------------------------------------------------------------
+class CompactVertexHashTable {
+public:
+    /// Slot marker for an empty slot
+    static constexpr uint32_t Empty = 0xffffffffu;
+
+    // ----------------------------------------------------------------------------
+    /** @brief Creates the table.
+     *  @param buffer The vertices to be inserted, must outlive the table.
+     *  @param squareEpsilon Maximum squared distance per channel for two vertices
+     *    to be considered equal. */
+    CompactVertexHashTable(const CompactVertexBuffer &buffer, ai_real squareEpsilon) :
+            mBuffer(buffer), mSquareEpsilon(squareEpsilon), mMask(0), mSize(0) {
+        size_t capacity = 16;
+        while (capacity < static_cast<size_t>(buffer.GetNumVertices()) * 2) {
+            capacity <<= 1;
+        }
+        mSlots.resize(capacity, Slot{ 0, Empty });
+        mMask = capacity - 1;
+    }
+
+    // ----------------------------------------------------------------------------
+    /** @brief Looks up a vertex and inserts it if no equal vertex is present yet.
+     *  @param idx Index of the vertex in the buffer.
+     *  @return The index of the equal vertex already in the table, or idx if
+     *    the vertex was newly inserted. */
+    unsigned int FindOrInsert(unsigned int idx) {
+        const uint32_t hash = mBuffer.Hash(idx);
+        for (size_t pos = hash & mMask;; pos = (pos + 1) & mMask) {
+            Slot &slot = mSlots[pos];
+            if (slot.mIndex == Empty) {
+                ai_assert(mSize < mSlots.size());
+                slot.mHash = hash;
+                slot.mIndex = idx;
+                ++mSize;
+                return idx;
+            }
+            if (slot.mHash == hash && mBuffer.Equal(slot.mIndex, idx, mSquareEpsilon)) {
+                return slot.mIndex;
+            }
+        }
+    }
+
+    /// Number of vertices in the table
+    size_t Size() const { return mSize; }
+
+private:
+    struct Slot {
+        uint32_t mHash;
+        uint32_t mIndex;
+    };
+
+    const CompactVertexBuffer &mBuffer;
+    ai_real mSquareEpsilon;
+    std::vector<Slot> mSlots;
+    size_t mMask;
+    size_t mSize;
+};
+
+} // namespace Assimp
+
+#endif // AI_COMPACTVERTEX_H_INC
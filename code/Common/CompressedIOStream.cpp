@@ -0,0 +1,266 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+#include "CompressedIOStream.h"
+#include "Compression.h"
+#include <assimp/ai_assert.h>
+#include <assimp/Exceptional.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Assimp {
+
+static constexpr size_t InputBlockSize = 64 * 1024;
+static constexpr size_t UnknownSize = ~static_cast<size_t>(0);
+
+// deflate can't expand its input by more than this factor
+static constexpr size_t MaxExpansion = 1032;
+
+struct CompressedIOStream::impl {
+    struct Checkpoint {
+        size_t in;
+        std::unique_ptr<Compression> state;
+    };
+
+    std::shared_ptr<IOStream> mSource;
+    size_t mBase;
+    Compression mInflate;
+
+    // the input window and its offset relative to mBase
+    std::vector<char> mIn;
+    size_t mInOffset;
+    size_t mInPos;
+    size_t mInSize;
+
+    size_t mPos;
+    size_t mSize;
+    size_t mSizeHint;
+    bool mEnd;
+
+    // checkpoint n holds the state at n * CheckpointSpan bytes of output
+    std::vector<Checkpoint> mCheckpoints;
+    std::vector<char> mDiscard;
+
+    impl(std::shared_ptr<IOStream> source) :
+            mSource(std::move(source)),
+            mBase(mSource->Tell()),
+            mIn(InputBlockSize),
+            mInOffset(0),
+            mInPos(0),
+            mInSize(0),
+            mPos(0),
+            mSize(UnknownSize),
+            mSizeHint(0),
+            mEnd(false) {
+        // empty
+    }
+
+    void saveCheckpoint() {
+        Checkpoint cp;
+        cp.in = mInOffset + mInPos;
+        cp.state.reset(new Compression);
+        if (!mInflate.copyTo(*cp.state)) {
+            throw DeadlyImportError("Compression", "Failed to save the decompression state.");
+        }
+        mCheckpoints.push_back(std::move(cp));
+    }
+
+    void restoreCheckpoint(size_t n) {
+        const Checkpoint &cp = mCheckpoints[n];
+        if (!cp.state->copyTo(mInflate)) {
+            throw DeadlyImportError("Compression", "Failed to restore the decompression state.");
+        }
+        mInOffset = cp.in;
+        mInPos = mInSize = 0;
+        mSource->Seek(mBase + mInOffset, aiOrigin_SET);
+        mPos = n * CheckpointSpan;
+        mEnd = false;
+    }
+
+    // decompress up to size bytes to out, or skip them if out is nullptr
+    size_t inflate(char *out, size_t size) {
+        size_t total = 0;
+        while (total < size && !mEnd) {
+            if (mPos % CheckpointSpan == 0 && mPos / CheckpointSpan == mCheckpoints.size()) {
+                saveCheckpoint();
+            }
+            if (mInPos == mInSize) {
+                mInOffset += mInSize;
+                mInPos = 0;
+                mInSize = mSource->Read(mIn.data(), 1, mIn.size());
+            }
+
+            // stop at the next checkpoint boundary so the state can be saved there
+            size_t chunk = std::min(size - total, CheckpointSpan - mPos % CheckpointSpan);
+            char *dest = out + total;
+            if (out == nullptr) {
+                mDiscard.resize(std::min(chunk, InputBlockSize));
+                chunk = mDiscard.size();
+                dest = mDiscard.data();
+            }
+
+            size_t consumed = 0;
+            bool finished = false;
+            const size_t have = mInflate.decompressStream(mIn.data() + mInPos, mInSize - mInPos, consumed, dest, chunk, finished);
+            mInPos += consumed;
+            mPos += have;
+            total += have;
+            if (finished) {
+                mEnd = true;
+                mSize = mPos;
+            } else if (have == 0 && consumed == 0 && mInPos == mInSize) {
+                // the source ran dry before the end of the compressed stream
+                throw DeadlyImportError("Compression", "Unexpected end of the compressed stream.");
+            }
+        }
+        return total;
+    }
+
+    bool seek(size_t pos) {
+        if (mSize != UnknownSize && pos > mSize) {
+            return false;
+        }
+
+        // resume from a checkpoint if we have to go back or can skip ahead
+        const size_t n = std::min(pos / CheckpointSpan, mCheckpoints.size() - 1);
+        if (pos < mPos || n * CheckpointSpan > mPos) {
+            restoreCheckpoint(n);
+        }
+        inflate(nullptr, pos - mPos);
+        return mPos == pos;
+    }
+};
+
+CompressedIOStream::CompressedIOStream(std::shared_ptr<IOStream> source, Container container) :
+        mImpl(nullptr) {
+    ai_assert(source != nullptr);
+    mImpl = new impl(std::move(source));
+
+    int windowBits = 32 + Compression::MaxWBits;
+    bool gzip = container == Container::GZip;
+    switch (container) {
+        case Container::Auto: {
+            unsigned char magic[2] = {};
+            gzip = mImpl->mSource->Read(magic, 1, 2) == 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+            mImpl->mSource->Seek(mImpl->mBase, aiOrigin_SET);
+        } break;
+        case Container::GZip:
+            windowBits = 16 + Compression::MaxWBits;
+            break;
+        case Container::ZLib:
+            windowBits = Compression::MaxWBits;
+            break;
+        case Container::Raw:
+            windowBits = -Compression::MaxWBits;
+            break;
+    }
+    mImpl->mInflate.open(Compression::Format::Binary, Compression::FlushMode::NoFlush, windowBits);
+    mImpl->saveCheckpoint();
+
+    // the gzip trailer stores the size of the last member modulo 2^32 and
+    // can't be checked before the inflate gets there, so it is only a hint
+    const size_t sourceSize = mImpl->mSource->FileSize();
+    if (gzip && sourceSize >= mImpl->mBase + 18) {
+        unsigned char isize[4] = {};
+        if (mImpl->mSource->Seek(sourceSize - 4, aiOrigin_SET) == aiReturn_SUCCESS &&
+                mImpl->mSource->Read(isize, 1, 4) == 4) {
+            const size_t hint = static_cast<size_t>(isize[0]) | static_cast<size_t>(isize[1]) << 8 |
+                    static_cast<size_t>(isize[2]) << 16 | static_cast<size_t>(isize[3]) << 24;
+            const size_t compressedSize = sourceSize - mImpl->mBase;
+            mImpl->mSizeHint = compressedSize > UnknownSize / MaxExpansion ? hint : std::min(hint, compressedSize * MaxExpansion);
+        }
+        mImpl->mSource->Seek(mImpl->mBase, aiOrigin_SET);
+    }
+}
+
+CompressedIOStream::~CompressedIOStream() {
+    delete mImpl;
+}
+
+size_t CompressedIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    ai_assert(nullptr != pvBuffer);
+    ai_assert(0 != pSize);
+
+    return mImpl->inflate(static_cast<char *>(pvBuffer), pSize * pCount) / pSize;
+}
+
+size_t CompressedIOStream::Write(const void *, size_t, size_t) {
+    return 0;
+}
+
+aiReturn CompressedIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    size_t pos = pOffset;
+    if (aiOrigin_CUR == pOrigin) {
+        pos = mImpl->mPos + pOffset;
+    } else if (aiOrigin_END == pOrigin) {
+        const size_t size = FileSize();
+        if (pOffset > size) {
+            return AI_FAILURE;
+        }
+        pos = size - pOffset;
+    }
+    return mImpl->seek(pos) ? AI_SUCCESS : AI_FAILURE;
+}
+
+size_t CompressedIOStream::Tell() const {
+    return mImpl->mPos;
+}
+
+size_t CompressedIOStream::FileSize() const {
+    if (mImpl->mSize == UnknownSize) {
+        const size_t pos = mImpl->mPos;
+        mImpl->inflate(nullptr, UnknownSize);
+        mImpl->seek(pos);
+    }
+    return mImpl->mSize;
+}
+
+void CompressedIOStream::Flush() {
+    // nothing to be done for a read-only stream
+}
+
+size_t CompressedIOStream::SizeHint() const {
+    return mImpl->mSizeHint;
+}
+
+} // namespace Assimp
@@ -0,0 +1,101 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+#pragma once
+
+#include <assimp/IOStream.hpp>
+
+#include <memory>
+
+namespace Assimp {
+
+/// @brief Read-only stream which decompresses a gzip, zlib or raw deflate
+/// stream on the fly.
+///
+/// The compressed data is pulled from the source stream in small pieces, so
+/// neither the compressed nor the decompressed data is ever held in memory as
+/// a whole. The inflate state is saved every CheckpointSpan bytes of output:
+/// seeking backwards resumes from the nearest checkpoint, seeking forward
+/// decompresses and discards the data in between.
+class ASSIMP_API CompressedIOStream : public IOStream {
+public:
+    /// @brief The container around the deflate data.
+    enum class Container {
+        Auto,   ///< gzip or zlib, detected from the header.
+        GZip,   ///< gzip header and trailer.
+        ZLib,   ///< zlib header and trailer.
+        Raw     ///< Raw deflate data without any header.
+    };
+
+    /// @brief The distance between two checkpoints in the decompressed data.
+    static constexpr size_t CheckpointSpan = 1024 * 1024;
+
+    /// @brief  The class constructor.
+    /// @param[in] source       The compressed stream, reading starts at its current position.
+    /// @param[in] container    The container format of the compressed data.
+    CompressedIOStream(std::shared_ptr<IOStream> source, Container container = Container::Auto);
+
+    ///	@brief  The class destructor.
+    ~CompressedIOStream() override;
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override;
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override;
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+    size_t Tell() const override;
+
+    /// @brief Returns the size of the decompressed data. Unless the end
+    /// has already been reached, the stream has to be inflated once to
+    /// determine it.
+    size_t FileSize() const override;
+    void Flush() override;
+
+    /// @brief Returns the decompressed size claimed by the gzip trailer,
+    /// capped to what the compressed data can expand to, or 0 if unknown.
+    /// The value is not verified and only meant for reserving memory.
+    size_t SizeHint() const;
+
+private:
+    struct impl;
+    impl *mImpl;
+};
+
+} // namespace Assimp
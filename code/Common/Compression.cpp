@@ -40,9 +40,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "Compression.h"
+#include "ParallelFor.h"
 #include <assimp/ai_assert.h>
 #include <assimp/Exceptional.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace Assimp {
 
 struct Compression::impl {
@@ -196,6 +200,126 @@ size_t Compression::decompressBlock(const void *data, size_t in, char *out, size
     return availableOut - (size_t)mImpl->mZSstream.avail_out;
 }
 
+size_t Compression::decompressStream(const void *data, size_t in, size_t &consumed, char *out, size_t availableOut, bool &finished) {
+    ai_assert(mImpl != nullptr);
+    consumed = 0;
+    finished = false;
+    if (out == nullptr || availableOut == 0) {
+        return 0l;
+    }
+
+    mImpl->mZSstream.next_in = (Bytef *)data;
+    mImpl->mZSstream.avail_in = (uInt)in;
+    mImpl->mZSstream.next_out = (Bytef *)out;
+    mImpl->mZSstream.avail_out = (uInt)availableOut;
+
+    // Z_BUF_ERROR just means that no progress was possible without more input
+    const int ret = ::inflate(&mImpl->mZSstream, Z_NO_FLUSH);
+    if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+        throw DeadlyImportError("Compression", "Failure decompressing this stream.");
+    }
+    finished = ret == Z_STREAM_END;
+    consumed = in - (size_t)mImpl->mZSstream.avail_in;
+
+    return availableOut - (size_t)mImpl->mZSstream.avail_out;
+}
+
+bool Compression::copyTo(Compression &other) const {
+    ai_assert(mImpl != nullptr);
+    if (!mImpl->mOpen || &other == this) {
+        return false;
+    }
+
+    other.close();
+    if (::inflateCopy(&other.mImpl->mZSstream, &mImpl->mZSstream) != Z_OK) {
+        return false;
+    }
+    other.mImpl->mFlushMode = mImpl->mFlushMode;
+    other.mImpl->mOpen = true;
+
+    return true;
+}
+
+static constexpr size_t CompressBlockSize = 128 * 1024;
+static constexpr size_t CompressDictionarySize = 32 * 1024;
+
+size_t Compression::compress(const void *data, size_t in, int level, std::vector<char> &compressed) {
+    compressed.clear();
+    if (data == nullptr || in == 0) {
+        return 0l;
+    }
+    level = std::min(std::max(level, 1), 9);
+
+    // deflate the blocks as raw streams, only the last one is finished so
+    // the concatenation forms a single valid deflate stream
+    const Bytef *src = static_cast<const Bytef *>(data);
+    const size_t numBlocks = (in + CompressBlockSize - 1) / CompressBlockSize;
+    std::vector<std::vector<char>> blocks(numBlocks);
+    std::vector<uLong> checksums(numBlocks);
+    std::atomic<bool> ok(true);
+    ParallelFor(numBlocks, [&](size_t b) {
+        const size_t begin = b * CompressBlockSize;
+        const size_t size = std::min(CompressBlockSize, in - begin);
+        const bool last = b + 1 == numBlocks;
+        checksums[b] = ::adler32(::adler32(0L, Z_NULL, 0), src + begin, static_cast<uInt>(size));
+
+        z_stream zs = {};
+        if (::deflateInit2(&zs, level, Z_DEFLATED, -MaxWBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            ok = false;
+            return;
+        }
+        if (b > 0) {
+            const size_t dictSize = std::min(CompressDictionarySize, begin);
+            ::deflateSetDictionary(&zs, src + begin - dictSize, static_cast<uInt>(dictSize));
+        }
+
+        // the sync flush marker of intermediate blocks takes a few extra bytes
+        std::vector<char> &out = blocks[b];
+        out.resize(::deflateBound(&zs, static_cast<uLong>(size)) + 16);
+        zs.next_in = const_cast<Bytef *>(src + begin);
+        zs.avail_in = static_cast<uInt>(size);
+        zs.next_out = reinterpret_cast<Bytef *>(out.data());
+        zs.avail_out = static_cast<uInt>(out.size());
+        const int ret = ::deflate(&zs, last ? Z_FINISH : Z_SYNC_FLUSH);
+        if ((last && ret != Z_STREAM_END) || (!last && (ret != Z_OK || zs.avail_in != 0 || zs.avail_out == 0))) {
+            ok = false;
+        }
+        out.resize(out.size() - zs.avail_out);
+        ::deflateEnd(&zs);
+    });
+    if (!ok) {
+        return 0l;
+    }
+
+    // zlib header, the level hint is informative only
+    const unsigned char cmf = 0x78;
+    const unsigned int flevel = level < 2 ? 0 : (level < 6 ? 1 : (level == 6 ? 2 : 3));
+    unsigned int flg = flevel << 6;
+    flg += 31 - ((cmf << 8) | flg) % 31;
+
+    size_t total = 6;
+    for (const std::vector<char> &block : blocks) {
+        total += block.size();
+    }
+    compressed.reserve(total);
+    compressed.push_back(static_cast<char>(cmf));
+    compressed.push_back(static_cast<char>(flg));
+
+    uLong adler = checksums[0];
+    for (size_t b = 0; b < numBlocks; ++b) {
+        compressed.insert(compressed.end(), blocks[b].begin(), blocks[b].end());
+        if (b > 0) {
+            const size_t size = std::min(CompressBlockSize, in - b * CompressBlockSize);
+            adler = ::adler32_combine(adler, checksums[b], static_cast<z_off_t>(size));
+        }
+    }
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        compressed.push_back(static_cast<char>((adler >> shift) & 0xff));
+    }
+
+    return compressed.size();
+}
+
 bool Compression::isOpen() const {
     ai_assert(mImpl != nullptr);
 
@@ -48,7 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Assimp {
 
-/// @brief This class provides the decompression of zlib-compressed data.
+/// @brief This class provides the decompression of zlib-compressed data
+/// and a one-shot compression into zlib streams.
 class Compression {
 public:
     static const int MaxWBits = MAX_WBITS;
@@ -109,6 +110,31 @@ public:
     /// @return The size of the decompressed data buffer.
     size_t decompressBlock(const void *data, size_t in, char *out, size_t availableOut);
 
+    /// @brief Will decompress the next part of a stream, the state is kept between calls.
+    /// @param[in]  data         The compressed data, may be nullptr if in is 0.
+    /// @param[in]  in           The size of the data buffer.
+    /// @param[out] consumed     Receives the number of bytes taken from data.
+    /// @param[out] out          The output buffer.
+    /// @param[in]  availableOut The upper limit of the output buffer.
+    /// @param[out] finished     Set to true once the end of the stream has been reached.
+    /// @return The size of the decompressed data written to out.
+    size_t decompressStream(const void *data, size_t in, size_t &consumed, char *out, size_t availableOut, bool &finished);
+
+    /// @brief Will copy the decompression state into another instance, e.g. to resume from there later.
+    /// @param[out] other   The target, will be closed first if open.
+    /// @return true if the copy was successful, false if not.
+    bool copyTo(Compression &other) const;
+
+    /// @brief Will compress the data buffer into a single zlib stream.
+    /// Large buffers are split into blocks which are deflated concurrently,
+    /// each block uses the tail of its predecessor as preset dictionary.
+    /// @param[in]  data        The data to compress.
+    /// @param[in]  in          The size of the data.
+    /// @param[in]  level       The zlib compression level, between 1 and 9.
+    /// @param[out] compressed  A std::vector receiving the zlib stream.
+    /// @return The size of the compressed data, 0 in case of an error.
+    static size_t compress(const void *data, size_t in, int level, std::vector<char> &compressed);
+
 private:
     struct impl;
     impl *mImpl;
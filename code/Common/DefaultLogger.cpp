@@ -45,6 +45,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *  @brief Implementation of DefaultLogger (and Logger)
  */
 
+#include "AsyncLogQueue.h"
+
 // Default log streams
 #include "FileLogStream.h"
 #include "StdOStreamLogStream.h"
@@ -56,7 +58,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/NullLogger.hpp>
+#include <functional>
 #include <iostream>
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
 #include <mutex>
@@ -164,6 +173,9 @@ Logger *DefaultLogger::create(const char *name /*= "AssimpLog.txt"*/,
 
 // ----------------------------------------------------------------------------------
 void Logger::debug(const char *message) {
+    if (!isEnabled(Debugging, DEBUGGING)) {
+        return;
+    }
 
     // SECURITY FIX: otherwise it's easy to produce overruns since
     // sometimes importers will include data from the input file
@@ -176,6 +188,9 @@ void Logger::debug(const char *message) {
 
 // ----------------------------------------------------------------------------------
 void Logger::verboseDebug(const char *message) {
+    if (!isEnabled(Debugging, VERBOSE)) {
+        return;
+    }
 
     // SECURITY FIX: see above
     if (strlen(message) > MAX_LOG_MESSAGE_LENGTH) {
@@ -186,6 +201,9 @@ void Logger::verboseDebug(const char *message) {
 
 // ----------------------------------------------------------------------------------
 void Logger::info(const char *message) {
+    if (!isEnabled(Info)) {
+        return;
+    }
 
     // SECURITY FIX: see above
     if (strlen(message) > MAX_LOG_MESSAGE_LENGTH) {
@@ -196,6 +214,9 @@ void Logger::info(const char *message) {
 
 // ----------------------------------------------------------------------------------
 void Logger::warn(const char *message) {
+    if (!isEnabled(Warn)) {
+        return;
+    }
 
     // SECURITY FIX: see above
     if (strlen(message) > MAX_LOG_MESSAGE_LENGTH) {
@@ -206,6 +227,10 @@ void Logger::warn(const char *message) {
 
 // ----------------------------------------------------------------------------------
 void Logger::error(const char *message) {
+    if (!isEnabled(Err)) {
+        return;
+    }
+
     // SECURITY FIX: see above
     if (strlen(message) > MAX_LOG_MESSAGE_LENGTH) {
         return OnError("<fixme: long message discarded>");
@@ -264,7 +289,7 @@ void DefaultLogger::OnDebug(const char *message) {
     char msg[Size];
     ai_snprintf(msg, Size, "Debug, T%u: %s", GetThreadID(), message);
 
-    WriteToStreams(msg, Logger::Debugging);
+    Dispatch(msg, Logger::Debugging);
 }
 
 //  Verbose debug message
@@ -277,7 +302,7 @@ void DefaultLogger::OnVerboseDebug(const char *message) {
     char msg[Size];
     ai_snprintf(msg, Size, "Debug, T%u: %s", GetThreadID(), message);
 
-    WriteToStreams(msg, Logger::Debugging);
+    Dispatch(msg, Logger::Debugging);
 }
 
 // ----------------------------------------------------------------------------------
@@ -287,7 +312,7 @@ void DefaultLogger::OnInfo(const char *message) {
     char msg[Size];
     ai_snprintf(msg, Size, "Info,  T%u: %s", GetThreadID(), message);
 
-    WriteToStreams(msg, Logger::Info);
+    Dispatch(msg, Logger::Info);
 }
 
 // ----------------------------------------------------------------------------------
@@ -297,7 +322,7 @@ void DefaultLogger::OnWarn(const char *message) {
     char msg[Size];
     ai_snprintf(msg, Size, "Warn,  T%u: %s", GetThreadID(), message);
 
-    WriteToStreams(msg, Logger::Warn);
+    Dispatch(msg, Logger::Warn);
 }
 
 // ----------------------------------------------------------------------------------
@@ -307,7 +332,7 @@ void DefaultLogger::OnError(const char *message) {
     char msg[Size];
     ai_snprintf(msg, Size, "Error, T%u: %s", GetThreadID(), message);
 
-    WriteToStreams(msg, Logger::Err);
+    Dispatch(msg, Logger::Err);
 }
 
 // ----------------------------------------------------------------------------------
@@ -321,21 +346,24 @@ bool DefaultLogger::attachStream(LogStream *pStream, unsigned int severity) {
         severity = SeverityAll;
     }
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // the new stream must not receive messages logged before
+    flush();
+
     std::lock_guard<std::mutex> lock(m_arrayMutex);
-#endif
 
     for (StreamIt it = m_StreamArray.begin();
             it != m_StreamArray.end();
             ++it) {
         if ((*it)->m_pStream == pStream) {
             (*it)->m_uiErrorSeverity |= severity;
+            UpdateEnabledSeverities();
             return true;
         }
     }
 
     LogStreamInfo *pInfo = new LogStreamInfo(severity, pStream);
     m_StreamArray.push_back(pInfo);
+    UpdateEnabledSeverities();
     return true;
 }
 
@@ -350,9 +378,10 @@ bool DefaultLogger::detachStream(LogStream *pStream, unsigned int severity) {
         severity = SeverityAll;
     }
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // the stream still receives everything logged so far
+    flush();
+
     std::lock_guard<std::mutex> lock(m_arrayMutex);
-#endif
 
     bool res(false);
     for (StreamIt it = m_StreamArray.begin(); it != m_StreamArray.end(); ++it) {
@@ -366,36 +395,98 @@ bool DefaultLogger::detachStream(LogStream *pStream, unsigned int severity) {
                 res = true;
                 break;
             }
+            UpdateEnabledSeverities();
             return true;
         }
     }
+    UpdateEnabledSeverities();
     return res;
 }
 
+// ----------------------------------------------------------------------------------
+//  Checks whether a message would reach any stream
+bool DefaultLogger::isEnabled(ErrorSeverity severity, LogSeverity granularity) const {
+    return m_Severity >= granularity && (m_enabledSeverities.load(std::memory_order_relaxed) & severity) != 0;
+}
+
+// ----------------------------------------------------------------------------------
+//  Switches to the asynchronous mode and back
+bool DefaultLogger::setAsynchronous(bool enable) {
+    if (enable == (m_pQueue != nullptr)) {
+        return true;
+    }
+
+    if (!enable) {
+        // writes the pending messages
+        delete m_pQueue;
+        m_pQueue = nullptr;
+        return true;
+    }
+
+    try {
+        m_pQueue = new AsyncLogQueue([this](const char *message, ErrorSeverity severity) {
+            WriteToStreams(message, severity);
+        });
+    } catch (const std::system_error &) {
+        // no background thread available, stay synchronous
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------------
+//  Writes the pending messages of the asynchronous mode
+void DefaultLogger::flush() {
+    if (m_pQueue != nullptr) {
+        m_pQueue->flush();
+    }
+}
+
 // ----------------------------------------------------------------------------------
 //  Constructor
 DefaultLogger::DefaultLogger(LogSeverity severity) :
-        Logger(severity), noRepeatMsg(false), lastLen(0) {
+        Logger(severity), m_enabledSeverities(0), m_pQueue(nullptr), noRepeatMsg(false), lastLen(0) {
     lastMsg[0] = '\0';
 }
 
 // ----------------------------------------------------------------------------------
 //  Destructor
 DefaultLogger::~DefaultLogger() {
+    // the pending messages still go to the streams
+    delete m_pQueue;
+
     for (StreamIt it = m_StreamArray.begin(); it != m_StreamArray.end(); ++it) {
         // also frees the underlying stream, we are its owner.
         delete *it;
     }
 }
 
+// ----------------------------------------------------------------------------------
+//  Queues or writes a message
+void DefaultLogger::Dispatch(const char *message, ErrorSeverity ErrorSev) {
+    if (m_pQueue != nullptr) {
+        m_pQueue->push(message, ErrorSev);
+    } else {
+        WriteToStreams(message, ErrorSev);
+    }
+}
+
+// ----------------------------------------------------------------------------------
+//  Collects the flags of all streams
+void DefaultLogger::UpdateEnabledSeverities() {
+    unsigned int severities = 0;
+    for (ConstStreamIt it = m_StreamArray.begin(); it != m_StreamArray.end(); ++it) {
+        severities |= (*it)->m_uiErrorSeverity;
+    }
+    m_enabledSeverities.store(severities, std::memory_order_relaxed);
+}
+
 // ----------------------------------------------------------------------------------
 //  Writes message to stream
 void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev) {
     ai_assert(nullptr != message);
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
     std::lock_guard<std::mutex> lock(m_arrayMutex);
-#endif
 
     // Check whether this is a repeated message
     auto thisLen = ::strlen(message);
@@ -424,14 +515,16 @@ void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev)
 }
 
 // ----------------------------------------------------------------------------------
-//  Returns thread id, if not supported only a zero will be returned.
+//  Returns the thread id
 unsigned int DefaultLogger::GetThreadID() {
-    // fixme: we can get this value via std::threads
-    // std::this_thread::get_id().hash() returns a (big) size_t, not sure if this is useful in this case.
 #ifdef WIN32
     return (unsigned int)::GetCurrentThreadId();
+#elif defined(__linux__)
+    static thread_local const unsigned int id = static_cast<unsigned int>(::syscall(SYS_gettid));
+    return id;
 #else
-    return 0; // not supported
+    static thread_local const unsigned int id = static_cast<unsigned int>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    return id;
 #endif
 }
 
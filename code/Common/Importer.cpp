@@ -797,7 +797,8 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 
     // If no flags are given, return the current scene with no further action
-    if (!pFlags) {
+    const unsigned int extraFlags = GetPropertyInteger(AI_CONFIG_PP_EXTRA_STEPS, 0);
+    if (!pFlags && !extraFlags) {
         return pimpl->mScene;
     }
 
@@ -834,7 +835,7 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
-        if( process->IsActive( pFlags)) {
+        if( process->IsActive( pFlags) || process->IsExtraActive( extraFlags)) {
             if (profiler) {
                 profiler->BeginRegion("postprocess");
             }
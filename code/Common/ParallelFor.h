@@ -0,0 +1,154 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ParallelFor.h
+ *  @brief Minimal helper to distribute independent loop iterations over
+ *  worker threads.
+ */
+#pragma once
+#ifndef AI_PARALLELFOR_H_INC
+#define AI_PARALLELFOR_H_INC
+
+#include <assimp/defs.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Limits the number of threads used by ParallelFor, including the calling one.
+/// @param count    The maximum number of threads, 1 runs all loops on the calling thread,
+///                 0 (the default) uses all hardware threads.
+ASSIMP_API void SetMaxWorkerThreads(unsigned int count);
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Returns the limit set by SetMaxWorkerThreads.
+ASSIMP_API unsigned int GetMaxWorkerThreads();
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Returns the number of worker threads used by ParallelFor.
+/// @return The number of hardware threads capped by GetMaxWorkerThreads(), at least 1.
+inline unsigned int GetNumWorkerThreads() {
+    unsigned int n = std::thread::hardware_concurrency();
+    const unsigned int limit = GetMaxWorkerThreads();
+    if (limit > 0 && (n == 0 || n > limit)) {
+        n = limit;
+    }
+    return n > 0 ? n : 1u;
+}
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Calls func(i) for each i in [0, count).
+///
+/// Iterations are handed out to the workers in chunks of grain indices, the
+/// calling thread takes part in the work. Iterations must be independent of
+/// each other. If one or more iterations throw, the remaining chunks are
+/// skipped and the first exception is rethrown on the calling thread.
+/// @param count    The number of iterations.
+/// @param func     The loop body, called as func(size_t).
+/// @param grain    The number of consecutive iterations handed out at once.
+template <typename Func>
+void ParallelFor(size_t count, Func &&func, size_t grain = 1) {
+    grain = std::max<size_t>(grain, 1);
+    const size_t numChunks = (count + grain - 1) / grain;
+    const size_t numThreads = std::min<size_t>(GetNumWorkerThreads(), numChunks);
+    if (numThreads <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        while (!failed.load(std::memory_order_relaxed)) {
+            const size_t begin = next.fetch_add(grain);
+            if (begin >= count) {
+                return;
+            }
+            const size_t end = std::min(begin + grain, count);
+            try {
+                for (size_t i = begin; i < end; ++i) {
+                    func(i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (size_t t = 1; t < numThreads; ++t) {
+        try {
+            threads.emplace_back(worker);
+        } catch (const std::system_error &) {
+            // out of threads, continue with the ones we already have
+            break;
+        }
+    }
+    worker();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace Assimp
+
+#endif // AI_PARALLELFOR_H_INC
@@ -137,6 +137,18 @@ corresponding preprocessor flag to selectively disable steps.
 #if (!defined ASSIMP_BUILD_NO_GENBOUNDINGBOXES_PROCESS)
 #   include "PostProcessing/GenBoundingBoxesProcess.h"
 #endif
+#if (!defined ASSIMP_BUILD_NO_GENMESHLETS_PROCESS)
+#   include "PostProcessing/GenMeshletsProcess.h"
+#endif
+#if (!defined ASSIMP_BUILD_NO_GENLODS_PROCESS)
+#   include "PostProcessing/GenLODsProcess.h"
+#endif
+#if (!defined ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS)
+#   include "PostProcessing/OptimizeAnimationsProcess.h"
+#endif
+#if (!defined ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS)
+#   include "PostProcessing/QuantizeVerticesProcess.h"
+#endif
 
 
 
@@ -205,6 +217,9 @@ void GetPostProcessingStepInstanceList(std::vector< BaseProcess* >& out)
 #if (!defined ASSIMP_BUILD_NO_FINDINVALIDDATA_PROCESS)
     out.push_back( new FindInvalidDataProcess());
 #endif
+#if (!defined ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS)
+    out.push_back(new OptimizeAnimationsProcess);
+#endif
 #if (!defined ASSIMP_BUILD_NO_OPTIMIZEMESHES_PROCESS)
     out.push_back( new OptimizeMeshesProcess());
 #endif
@@ -254,12 +269,21 @@ void GetPostProcessingStepInstanceList(std::vector< BaseProcess* >& out)
 #if (!defined ASSIMP_BUILD_NO_LIMITBONEWEIGHTS_PROCESS)
     out.push_back( new LimitBoneWeightsProcess());
 #endif
+#if (!defined ASSIMP_BUILD_NO_GENLODS_PROCESS)
+    out.push_back(new GenLODsProcess);
+#endif
 #if (!defined ASSIMP_BUILD_NO_IMPROVECACHELOCALITY_PROCESS)
     out.push_back( new ImproveCacheLocalityProcess());
 #endif
 #if (!defined ASSIMP_BUILD_NO_GENBOUNDINGBOXES_PROCESS)
     out.push_back(new GenBoundingBoxesProcess);
 #endif
+#if (!defined ASSIMP_BUILD_NO_GENMESHLETS_PROCESS)
+    out.push_back(new GenMeshletsProcess);
+#endif
+#if (!defined ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS)
+    out.push_back(new QuantizeVerticesProcess);
+#endif
 }
 
 }
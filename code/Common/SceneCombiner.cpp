@@ -1110,6 +1110,31 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
             Copy(&dest->mTextureCoordsNames[i], src->mTextureCoordsNames[i]);
         }
     }
+
+    // make a deep copy of the meshlets
+    if (src->mMeshlets != nullptr) {
+        aiMeshletTable *meshlets = dest->mMeshlets = new aiMeshletTable();
+        *meshlets = *src->mMeshlets;
+        GetArrayCopy(meshlets->mMeshlets, meshlets->mNumMeshlets);
+        GetArrayCopy(meshlets->mVertices, meshlets->mNumVertices);
+        GetArrayCopy(meshlets->mTriangles, meshlets->mNumTriangleIndices);
+    }
+
+    // make a deep copy of the quantized vertices
+    if (src->mQuantizedVertices != nullptr) {
+        aiQuantizedVertices *quantized = dest->mQuantizedVertices = new aiQuantizedVertices();
+        *quantized = *src->mQuantizedVertices;
+        const unsigned int numVertices = quantized->mNumVertices;
+        GetArrayCopy(quantized->mPositions, numVertices * 4);
+        GetArrayCopy(quantized->mNormals, numVertices * 2);
+        GetArrayCopy(quantized->mTangents, numVertices * 4);
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            GetArrayCopy(quantized->mTextureCoords[i], numVertices * 2);
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            GetArrayCopy(quantized->mColors[i], numVertices * 4);
+        }
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -0,0 +1,136 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file TextStreamWriter.cpp
+ *  @brief Implementation of the buffered text writer.
+ */
+#include "TextStreamWriter.h"
+
+#include <assimp/ai_assert.h>
+#include <assimp/Exceptional.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+TextStreamWriter::TextStreamWriter(IOStream *stream, size_t bufferSize) :
+        mStream(stream),
+        mBuffer(std::max<size_t>(bufferSize, MaxRealLength)),
+        mPos(0),
+        mWritten(0) {
+    ai_assert(nullptr != stream);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::flush() {
+    flushBuffer();
+    mStream->Flush();
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::flushBuffer() {
+    if (0 == mPos) {
+        return;
+    }
+    const size_t length = mPos;
+    mPos = 0;
+    writeToStream(mBuffer.data(), length);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::writeToStream(const char *data, size_t length) {
+    if (mStream->Write(data, 1, length) != length) {
+        throw DeadlyExportError("Failed to write ", length, " bytes to the output stream.");
+    }
+    mWritten += length;
+}
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+
+// ------------------------------------------------------------------------------------------------
+size_t TextStreamWriter::formatReal(char *buffer, float value) {
+    return static_cast<size_t>(std::to_chars(buffer, buffer + MaxRealLength, value).ptr - buffer);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t TextStreamWriter::formatReal(char *buffer, double value) {
+    return static_cast<size_t>(std::to_chars(buffer, buffer + MaxRealLength, value).ptr - buffer);
+}
+
+#else
+
+// ------------------------------------------------------------------------------------------------
+// Without floating point support in std::to_chars, the first precision that reads back
+// to the same value is searched with snprintf.
+template <typename T>
+static size_t formatRealFallback(char *buffer, T value, int maxDigits) {
+    char text[TextStreamWriter::MaxRealLength + 1] = {};
+    int length = 0;
+    for (int digits = 6; digits <= maxDigits; ++digits) {
+        length = ::snprintf(text, sizeof(text), "%.*g", digits, static_cast<double>(value));
+        if (static_cast<T>(::strtod(text, nullptr)) == value) {
+            break;
+        }
+    }
+
+    // snprintf follows the C locale of the application, undo a decimal comma
+    for (int i = 0; i < length; ++i) {
+        buffer[i] = text[i] == ',' ? '.' : text[i];
+    }
+    return static_cast<size_t>(length);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t TextStreamWriter::formatReal(char *buffer, float value) {
+    return formatRealFallback(buffer, value, 9);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t TextStreamWriter::formatReal(char *buffer, double value) {
+    return formatRealFallback(buffer, value, 17);
+}
+
+#endif
+
+} // namespace Assimp
@@ -0,0 +1,179 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file TextStreamWriter.h
+ *  @brief Buffered text output for the text based exporters.
+ */
+#pragma once
+#ifndef AI_TEXTSTREAMWRITER_H_INC
+#define AI_TEXTSTREAMWRITER_H_INC
+
+#include <assimp/IOStream.hpp>
+
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Assimp {
+
+/// @brief Writes text to an IOStream in large chunks.
+///
+/// Replaces the std::ostringstream the exporters used to assemble the whole
+/// file in memory before writing it: the data goes to the stream whenever the
+/// chunk buffer is full. Numbers are formatted locale-independently, floating
+/// point numbers with the shortest representation that reads back to the same
+/// value.
+///
+/// The exporter calls flush() once it has written everything. The destructor
+/// does not write the buffered data, so an export which fails half-way does not
+/// add its tail to the file.
+class ASSIMP_API TextStreamWriter {
+public:
+    /// @brief The default size of the chunk buffer.
+    static constexpr size_t DefaultBufferSize = 1024 * 1024;
+
+    /// @brief The maximum number of characters formatReal() writes.
+    static constexpr size_t MaxRealLength = 32;
+
+    /// @brief  The class constructor.
+    /// @param[in] stream       The stream to write to, must outlive the writer.
+    /// @param[in] bufferSize   The size of the chunk buffer.
+    explicit TextStreamWriter(IOStream *stream, size_t bufferSize = DefaultBufferSize);
+
+    /// @brief  The class destructor, discards the data which was not flushed.
+    ~TextStreamWriter() = default;
+
+    TextStreamWriter(const TextStreamWriter &) = delete;
+    TextStreamWriter &operator=(const TextStreamWriter &) = delete;
+
+    /// @brief Writes raw data.
+    /// @param[in] data     The data.
+    /// @param[in] length   The number of bytes.
+    void write(const char *data, size_t length) {
+        if (mBuffer.size() - mPos < length) {
+            flushBuffer();
+            if (length > mBuffer.size()) {
+                writeToStream(data, length);
+                return;
+            }
+        }
+        ::memcpy(&mBuffer[mPos], data, length);
+        mPos += length;
+    }
+
+    /// @brief Writes the buffered data to the stream and flushes it, to be
+    ///        called when the export succeeded.
+    /// @throw DeadlyExportError if the stream does not accept the data.
+    void flush();
+
+    /// @brief Returns the number of bytes written so far.
+    size_t size() const {
+        return mWritten + mPos;
+    }
+
+    TextStreamWriter &operator<<(const char *str) {
+        write(str, ::strlen(str));
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(const std::string &str) {
+        write(str.c_str(), str.size());
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(char c) {
+        if (mPos == mBuffer.size()) {
+            flushBuffer();
+        }
+        mBuffer[mPos++] = c;
+        return *this;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, char>::value && !std::is_same<T, bool>::value,
+            TextStreamWriter &>::type
+    operator<<(T value) {
+        char buffer[24];
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        write(buffer, static_cast<size_t>(result.ptr - buffer));
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(float value) {
+        char buffer[MaxRealLength];
+        write(buffer, formatReal(buffer, value));
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(double value) {
+        char buffer[MaxRealLength];
+        write(buffer, formatReal(buffer, value));
+        return *this;
+    }
+
+    /// @brief Formats a float with the shortest representation that reads back to the same value.
+    /// @param[out] buffer  Receives the text, at least MaxRealLength characters, not terminated.
+    /// @param[in] value    The value.
+    /// @return The number of characters written.
+    static size_t formatReal(char *buffer, float value);
+
+    /// @brief Formats a double with the shortest representation that reads back to the same value.
+    /// @param[out] buffer  Receives the text, at least MaxRealLength characters, not terminated.
+    /// @param[in] value    The value.
+    /// @return The number of characters written.
+    static size_t formatReal(char *buffer, double value);
+
+private:
+    void flushBuffer();
+    void writeToStream(const char *data, size_t length);
+
+private:
+    IOStream *mStream;
+    std::vector<char> mBuffer;
+    size_t mPos;
+    size_t mWritten;
+};
+
+} // namespace Assimp
+
+#endif // AI_TEXTSTREAMWRITER_H_INC
@@ -0,0 +1,226 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file VertexQuantization.h
+ *  @brief Helpers to encode and decode the packed vertex formats of
+ *  #aiQuantizedVertices.
+ */
+#pragma once
+#ifndef AI_VERTEXQUANTIZATION_H_INC
+#define AI_VERTEXQUANTIZATION_H_INC
+
+#include <assimp/Hash.h>
+#include <assimp/mesh.h>
+#include <assimp/vector3.inl>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace Assimp {
+namespace Quantization {
+
+// --------------------------------------------------------------------------------------------
+/// @brief Converts a value in [0,1] to an unsigned normalized integer with the given bits.
+inline uint32_t EncodeUNorm(float v, unsigned int bits) {
+    const float scale = static_cast<float>((1u << bits) - 1u);
+    v = v < 0.f ? 0.f : (v > 1.f ? 1.f : v);
+    return static_cast<uint32_t>(v * scale + 0.5f);
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Converts a value in [-1,1] to a signed normalized integer with the given bits.
+inline int32_t EncodeSNorm(float v, unsigned int bits) {
+    const float scale = static_cast<float>((1u << (bits - 1u)) - 1u);
+    v = v < -1.f ? -1.f : (v > 1.f ? 1.f : v);
+    return static_cast<int32_t>(v * scale + (v >= 0.f ? 0.5f : -0.5f));
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Converts a signed normalized integer with the given bits back to [-1,1].
+inline float DecodeSNorm(int32_t v, unsigned int bits) {
+    const float scale = static_cast<float>((1u << (bits - 1u)) - 1u);
+    const float f = static_cast<float>(v) / scale;
+    return f < -1.f ? -1.f : f;
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Converts a float to IEEE 754 half precision, rounding to nearest even.
+inline uint16_t EncodeHalf(float v) {
+    uint32_t bits;
+    ::memcpy(&bits, &v, sizeof(bits));
+
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t abs = bits & 0x7fffffffu;
+    if (abs >= 0x7f800000u) {
+        // infinity or NaN, keep NaNs quiet
+        return static_cast<uint16_t>(sign | 0x7c00u | (abs > 0x7f800000u ? 0x200u : 0u));
+    }
+    if (abs >= 0x477ff000u) {
+        // overflows to infinity after rounding
+        return static_cast<uint16_t>(sign | 0x7c00u);
+    }
+    if (abs < 0x38800000u) {
+        // subnormal half or zero: shift the mantissa including the implicit bit
+        if (abs < 0x33000000u) {
+            return static_cast<uint16_t>(sign);
+        }
+        const uint32_t exponent = abs >> 23;
+        const uint32_t mantissa = (abs & 0x7fffffu) | 0x800000u;
+        const uint32_t shift = 126u - exponent;
+        uint32_t half = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (rest > halfway || (rest == halfway && (half & 1u))) {
+            ++half;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // normal number, rebias the exponent and round the mantissa
+    uint32_t half = (abs - 0x38000000u) >> 13;
+    const uint32_t rest = abs & 0x1fffu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+        ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Converts an IEEE 754 half precision value to float.
+inline float DecodeHalf(uint16_t h) {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    const uint32_t exponent = (h >> 10) & 0x1fu;
+    const uint32_t mantissa = h & 0x3ffu;
+
+    uint32_t bits;
+    if (0 == exponent) {
+        // zero or subnormal, which is exactly representable as a scaled float
+        const float f = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -f : f;
+    } else if (0x1f == exponent) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+    float f;
+    ::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// --------------------------------------------------------------------------------------------
+/** @brief Maps a unit vector onto the octahedron and unfolds it into [-1,1]^2.
+ *  @param n The vector, need not be normalized.
+ *  @param u Receives the first coordinate.
+ *  @param v Receives the second coordinate. */
+inline void EncodeOctahedron(const aiVector3D &n, float &u, float &v) {
+    const float x = static_cast<float>(n.x), y = static_cast<float>(n.y), z = static_cast<float>(n.z);
+    const float l1 = std::fabs(x) + std::fabs(y) + std::fabs(z);
+    if (l1 <= 0.f) {
+        u = v = 0.f;
+        return;
+    }
+    u = x / l1;
+    v = y / l1;
+    if (z < 0.f) {
+        const float fu = u, fv = v;
+        u = (1.f - std::fabs(fv)) * (fu >= 0.f ? 1.f : -1.f);
+        v = (1.f - std::fabs(fu)) * (fv >= 0.f ? 1.f : -1.f);
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Inverse of #EncodeOctahedron, returns a normalized vector.
+inline aiVector3D DecodeOctahedron(float u, float v) {
+    float x = u, y = v;
+    const float z = 1.f - std::fabs(u) - std::fabs(v);
+    const float t = z < 0.f ? -z : 0.f;
+    x += x >= 0.f ? -t : t;
+    y += y >= 0.f ? -t : t;
+    aiVector3D n(static_cast<ai_real>(x), static_cast<ai_real>(y), static_cast<ai_real>(z));
+    return n.NormalizeSafe();
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Hashes the float attributes of a mesh which are quantized, see
+///        aiQuantizedVertices::mSourceHash.
+inline uint32_t HashSourceAttributes(const aiMesh &mesh) {
+    const uint32_t size = mesh.mNumVertices * static_cast<uint32_t>(sizeof(aiVector3D));
+    uint32_t hash = SuperFastHash(reinterpret_cast<const char *>(&mesh.mNumVertices), sizeof(mesh.mNumVertices));
+    const aiVector3D *arrays[] = { mesh.mVertices, mesh.mNormals, mesh.mTangents, mesh.mBitangents };
+    for (const aiVector3D *array : arrays) {
+        // hash the presence of the attribute as well
+        const char present = array != nullptr;
+        hash = SuperFastHash(&present, 1, hash);
+        if (array != nullptr && size > 0) {
+            hash = SuperFastHash(reinterpret_cast<const char *>(array), size, hash);
+        }
+    }
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+        const char present = mesh.HasTextureCoords(c) && mesh.mNumUVComponents[c] <= 2;
+        hash = SuperFastHash(&present, 1, hash);
+        if (present && size > 0) {
+            hash = SuperFastHash(reinterpret_cast<const char *>(mesh.mTextureCoords[c]), size, hash);
+        }
+    }
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        const char present = mesh.HasVertexColors(c);
+        hash = SuperFastHash(&present, 1, hash);
+        if (present && mesh.mNumVertices > 0) {
+            hash = SuperFastHash(reinterpret_cast<const char *>(mesh.mColors[c]),
+                    mesh.mNumVertices * static_cast<uint32_t>(sizeof(aiColor4D)), hash);
+        }
+    }
+    return hash;
+}
+
+// --------------------------------------------------------------------------------------------
+/// @brief Returns true if the mesh has quantized vertices which were generated from its
+///        current float attributes.
+inline bool HasCurrentQuantizedVertices(const aiMesh &mesh) {
+    return mesh.HasQuantizedVertices() && mesh.mQuantizedVertices->mSourceHash == HashSourceAttributes(mesh);
+}
+
+} // namespace Quantization
+} // namespace Assimp
+
+#endif // AI_VERTEXQUANTIZATION_H_INC
@@ -47,9 +47,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ZipArchiveIOSystem.h>
 
 #include <assimp/ai_assert.h>
+#include "ParallelFor.h"
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #ifdef ASSIMP_USE_HUNTER
 #    include <minizip/unzip.h>
@@ -63,10 +65,9 @@ namespace Assimp {
 // A read-only file inside a ZIP
 
 class ZipFile final : public IOStream {
-    friend class ZipFileInfo;
-    explicit ZipFile(std::string &filename, size_t size);
-
 public:
+    explicit ZipFile(std::string &filename, size_t size, std::unique_ptr<uint8_t[]> buffer);
+
     std::string m_Filename;
     ~ZipFile() override = default;
 
@@ -232,6 +233,11 @@ public:
     // Allocate and Extract data from the ZIP
     ZipFile *Extract(std::string &filename, unzFile zip_handle) const;
 
+    // Extract the data only, nullptr in case of an error
+    std::unique_ptr<uint8_t[]> ExtractBuffer(unzFile zip_handle) const;
+
+    size_t GetSize() const { return m_Size; }
+
 private:
     size_t m_Size = 0;
     unz_file_pos_s m_ZipFilePos;
@@ -249,6 +255,16 @@ ZipFileInfo::ZipFileInfo(unzFile zip_handle, size_t size) :
 
 // ----------------------------------------------------------------
 ZipFile *ZipFileInfo::Extract(std::string &filename, unzFile zip_handle) const {
+    std::unique_ptr<uint8_t[]> buffer = ExtractBuffer(zip_handle);
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+
+    return new ZipFile(filename, m_Size, std::move(buffer));
+}
+
+// ----------------------------------------------------------------
+std::unique_ptr<uint8_t[]> ZipFileInfo::ExtractBuffer(unzFile zip_handle) const {
     // Find in the ZIP. This cannot fail
     unz_file_pos_s *filepos = const_cast<unz_file_pos_s *>(&(m_ZipFilePos));
     if (unzGoToFilePos(zip_handle, filepos) != UNZ_OK)
@@ -257,41 +273,38 @@ ZipFile *ZipFileInfo::Extract(std::string &filename, unzFile zip_handle) const {
     if (unzOpenCurrentFile(zip_handle) != UNZ_OK)
         return nullptr;
 
-    ZipFile *zip_file = new ZipFile(filename, m_Size);
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[m_Size]);
 
-    // Unzip has a limit of UINT16_MAX bytes buffer
-    uint16_t unzipBufferSize = zip_file->m_Size <= UINT16_MAX ? static_cast<uint16_t>(zip_file->m_Size) : UINT16_MAX;
-    std::unique_ptr<uint8_t[]> unzipBuffer = std::unique_ptr<uint8_t[]>(new uint8_t[unzipBufferSize]);
+    // Unzip has a limit of UINT16_MAX bytes per read
     size_t readCount = 0;
-    while (readCount < zip_file->m_Size)
+    while (readCount < m_Size)
     {
-        size_t bufferSize = zip_file->m_Size - readCount;
+        size_t bufferSize = m_Size - readCount;
         if (bufferSize > UINT16_MAX) {
             bufferSize = UINT16_MAX;
         }
 
-        int ret = unzReadCurrentFile(zip_handle, unzipBuffer.get(), static_cast<unsigned int>(bufferSize));
+        int ret = unzReadCurrentFile(zip_handle, buffer.get() + readCount, static_cast<unsigned int>(bufferSize));
         if (ret != static_cast<int>(bufferSize))
         {
             // Failed, release the memory
-            delete zip_file;
-            zip_file = nullptr;
+            buffer.reset();
             break;
         }
 
-        std::memcpy(zip_file->m_Buffer.get() + readCount, unzipBuffer.get(), ret);
         readCount += ret;
     }
 
-    ai_assert(unzCloseCurrentFile(zip_handle) == UNZ_OK);
-    return zip_file;
+    const int closed = unzCloseCurrentFile(zip_handle);
+    ai_assert(closed == UNZ_OK || buffer == nullptr);
+    (void)closed;
+    return buffer;
 }
 
 // ----------------------------------------------------------------
-ZipFile::ZipFile(std::string &filename, size_t size) :
-        m_Filename(filename), m_Size(size) {
+ZipFile::ZipFile(std::string &filename, size_t size, std::unique_ptr<uint8_t[]> buffer) :
+        m_Filename(filename), m_Size(size), m_Buffer(std::move(buffer)) {
     ai_assert(m_Size != 0);
-    m_Buffer = std::unique_ptr<uint8_t[]>(new uint8_t[m_Size]);
 }
 
 // ----------------------------------------------------------------
@@ -369,17 +382,36 @@ public:
     void getFileListExtension(std::vector<std::string> &rFileList, const std::string &extension);
     bool Exists(std::string &filename);
     IOStream *OpenFile(std::string &filename);
+    void Prefetch(const std::vector<std::string> &rFileList);
 
     static void SimplifyFilename(std::string &filename);
 
 private:
     void MapArchive();
 
+    // Every reader needs its own handle, unzip keeps the current file and its
+    // inflate state in there. Handles are pooled and opened on demand, the
+    // IOSystem is only ever entered by one thread at a time.
+    unzFile AcquireHandle();
+    void ReleaseHandle(unzFile handle);
+
 private:
     typedef std::map<std::string, ZipFileInfo> ZipFileInfoMap;
+    typedef std::map<std::string, std::unique_ptr<uint8_t[]>> PrefetchMap;
 
+    std::string m_Filename;
+    zlib_filefunc_def m_Mapping;
     unzFile m_ZipFileHandle = nullptr;
+    std::vector<unzFile> m_FreeHandles;
+    std::mutex m_HandleMutex;
+
+    // the central directory, read once and immutable afterwards
     ZipFileInfoMap m_ArchiveMap;
+    std::mutex m_MapMutex;
+    bool m_Mapped = false;
+
+    PrefetchMap m_Prefetched;
+    std::mutex m_PrefetchMutex;
 };
 
 // ----------------------------------------------------------------
@@ -390,15 +422,43 @@ ZipArchiveIOSystem::Implement::Implement(IOSystem *pIOHandler, const char *pFile
         return;
     }
 
-    zlib_filefunc_def mapping = IOSystem2Unzip::get(pIOHandler);
-    m_ZipFileHandle = unzOpen2(pFilename, &mapping);
+    m_Filename = pFilename;
+    m_Mapping = IOSystem2Unzip::get(pIOHandler);
+    m_ZipFileHandle = unzOpen2(pFilename, &m_Mapping);
+    if (m_ZipFileHandle != nullptr) {
+        m_FreeHandles.push_back(m_ZipFileHandle);
+    }
 }
 
 // ----------------------------------------------------------------
 ZipArchiveIOSystem::Implement::~Implement() {
-    if (m_ZipFileHandle != nullptr) {
-        unzClose(m_ZipFileHandle);
+    // all streams hold their own copy of the data, so every handle is back in the pool
+    for (unzFile handle : m_FreeHandles) {
+        unzClose(handle);
+    }
+}
+
+// ----------------------------------------------------------------
+unzFile ZipArchiveIOSystem::Implement::AcquireHandle() {
+    std::lock_guard<std::mutex> lock(m_HandleMutex);
+    if (!m_FreeHandles.empty()) {
+        unzFile handle = m_FreeHandles.back();
+        m_FreeHandles.pop_back();
+        return handle;
+    }
+
+    // opening calls into the IOSystem, which need not be thread-safe
+    return unzOpen2(m_Filename.c_str(), &m_Mapping);
+}
+
+// ----------------------------------------------------------------
+void ZipArchiveIOSystem::Implement::ReleaseHandle(unzFile handle) {
+    if (handle == nullptr) {
+        return;
     }
+
+    std::lock_guard<std::mutex> lock(m_HandleMutex);
+    m_FreeHandles.push_back(handle);
 }
 
 // ----------------------------------------------------------------
@@ -406,26 +466,36 @@ void ZipArchiveIOSystem::Implement::MapArchive() {
     if (m_ZipFileHandle == nullptr)
         return;
 
-    if (!m_ArchiveMap.empty())
+    std::lock_guard<std::mutex> lock(m_MapMutex);
+    if (m_Mapped)
+        return;
+    m_Mapped = true;
+
+    unzFile handle = AcquireHandle();
+    if (handle == nullptr)
         return;
 
     //  At first ensure file is already open
-    if (unzGoToFirstFile(m_ZipFileHandle) != UNZ_OK)
+    if (unzGoToFirstFile(handle) != UNZ_OK) {
+        ReleaseHandle(handle);
         return;
+    }
 
     // Loop over all files
     do {
         char filename[FileNameSize];
         unz_file_info fileInfo;
 
-        if (unzGetCurrentFileInfo(m_ZipFileHandle, &fileInfo, filename, FileNameSize, nullptr, 0, nullptr, 0) == UNZ_OK) {
+        if (unzGetCurrentFileInfo(handle, &fileInfo, filename, FileNameSize, nullptr, 0, nullptr, 0) == UNZ_OK) {
             if (fileInfo.uncompressed_size != 0 && fileInfo.size_filename <= FileNameSize) {
                 std::string filename_string(filename, fileInfo.size_filename);
                 SimplifyFilename(filename_string);
-                m_ArchiveMap.emplace(filename_string, ZipFileInfo(m_ZipFileHandle, fileInfo.uncompressed_size));
+                m_ArchiveMap.emplace(filename_string, ZipFileInfo(handle, fileInfo.uncompressed_size));
             }
         }
-    } while (unzGoToNextFile(m_ZipFileHandle) != UNZ_END_OF_LIST_OF_FILE);
+    } while (unzGoToNextFile(handle) != UNZ_END_OF_LIST_OF_FILE);
+
+    ReleaseHandle(handle);
 }
 
 // ----------------------------------------------------------------
@@ -474,7 +544,83 @@ IOStream *ZipArchiveIOSystem::Implement::OpenFile(std::string &filename) {
         return nullptr;
 
     const ZipFileInfo &zip_file = (*zip_it).second;
-    return zip_file.Extract(filename, m_ZipFileHandle);
+    {
+        std::lock_guard<std::mutex> lock(m_PrefetchMutex);
+        // prefetched data is handed over to the first stream to keep memory low
+        PrefetchMap::iterator it = m_Prefetched.find(filename);
+        if (it != m_Prefetched.end()) {
+            std::unique_ptr<uint8_t[]> buffer = std::move((*it).second);
+            m_Prefetched.erase(it);
+            return new ZipFile(filename, zip_file.GetSize(), std::move(buffer));
+        }
+    }
+
+    unzFile handle = AcquireHandle();
+    if (handle == nullptr)
+        return nullptr;
+
+    ZipFile *result = zip_file.Extract(filename, handle);
+    ReleaseHandle(handle);
+    return result;
+}
+
+// ----------------------------------------------------------------
+void ZipArchiveIOSystem::Implement::Prefetch(const std::vector<std::string> &rFileList) {
+    MapArchive();
+
+    std::vector<std::pair<std::string, const ZipFileInfo *>> todo;
+    {
+        std::lock_guard<std::mutex> lock(m_PrefetchMutex);
+        for (std::string filename : rFileList) {
+            SimplifyFilename(filename);
+            ZipFileInfoMap::const_iterator zip_it = m_ArchiveMap.find(filename);
+            if (zip_it != m_ArchiveMap.cend() && m_Prefetched.find(filename) == m_Prefetched.cend()) {
+                todo.emplace_back(filename, &(*zip_it).second);
+            }
+        }
+    }
+
+    // Each worker inflates with a handle of its own. The handles are opened
+    // here, so the workers only read from their streams and never open any.
+    std::vector<unzFile> handles;
+    const size_t numHandles = std::min<size_t>(todo.size(), GetNumWorkerThreads());
+    while (handles.size() < numHandles) {
+        unzFile handle = AcquireHandle();
+        if (handle == nullptr) {
+            break;
+        }
+        handles.push_back(handle);
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> buffers(todo.size());
+    std::mutex handlesMutex;
+    ParallelFor(todo.size(), [&](size_t i) {
+        unzFile handle = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(handlesMutex);
+            if (handles.empty()) {
+                // fewer handles than workers, the file is extracted when it is opened
+                return;
+            }
+            handle = handles.back();
+            handles.pop_back();
+        }
+        buffers[i] = todo[i].second->ExtractBuffer(handle);
+
+        std::lock_guard<std::mutex> lock(handlesMutex);
+        handles.push_back(handle);
+    });
+
+    for (unzFile handle : handles) {
+        ReleaseHandle(handle);
+    }
+
+    std::lock_guard<std::mutex> lock(m_PrefetchMutex);
+    for (size_t i = 0; i < todo.size(); ++i) {
+        if (buffers[i] != nullptr) {
+            m_Prefetched.emplace(todo[i].first, std::move(buffers[i]));
+        }
+    }
 }
 
 // ----------------------------------------------------------------
@@ -589,6 +735,11 @@ void ZipArchiveIOSystem::getFileListExtension(std::vector<std::string> &rFileLis
     return pImpl->getFileListExtension(rFileList, extension);
 }
 
+// ----------------------------------------------------------------
+void ZipArchiveIOSystem::prefetch(const std::vector<std::string> &rFileList) {
+    pImpl->Prefetch(rFileList);
+}
+
 // ----------------------------------------------------------------
 bool ZipArchiveIOSystem::isZipArchive(IOSystem *pIOHandler, const char *pFilename) {
     Implement tmp(pIOHandler, pFilename, "r");
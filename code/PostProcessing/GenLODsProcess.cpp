@@ -0,0 +1,581 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to generate level-of-detail meshes.
+ */
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#include "PostProcessing/GenLODsProcess.h"
+#include "PostProcessing/ProcessHelper.h"
+
+#include <assimp/fast_atof.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <list>
+#include <queue>
+#include <unordered_map>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+GenLODsProcess::GenLODsProcess() :
+        mRatios{ 0.5f, 0.25f, 0.125f }, mMaxError(0.f) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenLODsProcess::IsActive(unsigned int /*pFlags*/) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenLODsProcess::IsExtraActive(unsigned int pExtraFlags) const {
+    return 0 != (pExtraFlags & aiProcessExtra_GenLODs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::SetupProperties(const Importer *pImp) {
+    const std::string ratios = pImp->GetPropertyString(AI_CONFIG_PP_LOD_RATIOS, AI_LOD_DEFAULT_RATIOS);
+    std::list<std::string> tokens;
+    ConvertListToStrings(ratios, tokens);
+
+    // each level must have fewer triangles than the previous one
+    mRatios.clear();
+    for (const std::string &token : tokens) {
+        const float ratio = fast_atof(token.c_str());
+        if (ratio <= 0.f || ratio >= 1.f || (!mRatios.empty() && ratio >= mRatios.back())) {
+            ASSIMP_LOG_WARN("GenLODsProcess: Ignoring invalid LOD ratio ", token);
+            continue;
+        }
+        mRatios.push_back(ratio);
+    }
+    mMaxError = pImp->GetPropertyFloat(AI_CONFIG_PP_LOD_MAX_ERROR, 0.f);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("GenLODsProcess begin");
+    if (mRatios.empty()) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess finished, no LOD ratios given");
+        return;
+    }
+    if (!(pScene->mFlags & AI_SCENE_FLAGS_NON_VERBOSE_FORMAT)) {
+        ASSIMP_LOG_WARN("GenLODsProcess: The scene is in verbose format, #aiProcess_JoinIdenticalVertices "
+                        "should be used to allow for any simplification");
+    }
+
+    std::vector<aiMesh *> meshes(pScene->mMeshes, pScene->mMeshes + pScene->mNumMeshes);
+    std::vector<aiMesh *> lods;
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        lods.clear();
+        ProcessMesh(pScene->mMeshes[i], lods);
+        for (size_t n = 0; n < lods.size(); ++n) {
+            if (nullptr == pScene->mMetaData) {
+                pScene->mMetaData = new aiMetadata();
+            }
+            pScene->mMetaData->Add("LOD_" + ai_to_string(i) + "_" + ai_to_string(n + 1), static_cast<uint32_t>(meshes.size()));
+            meshes.push_back(lods[n]);
+        }
+    }
+
+    if (meshes.size() == pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess finished, nothing to simplify");
+        return;
+    }
+
+    ASSIMP_LOG_INFO("GenLODsProcess finished. Generated ", meshes.size() - pScene->mNumMeshes, " LOD meshes");
+    delete[] pScene->mMeshes;
+    pScene->mNumMeshes = static_cast<unsigned int>(meshes.size());
+    pScene->mMeshes = new aiMesh *[pScene->mNumMeshes];
+    std::copy(meshes.begin(), meshes.end(), pScene->mMeshes);
+}
+
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+// Symmetric 4x4 matrix of the quadric error metric, stored as its upper triangle
+struct Quadric {
+    double a[10] = {};
+
+    void AddPlane(const aiVector3D &n, double d, double weight) {
+        const double x = n.x, y = n.y, z = n.z;
+        a[0] += weight * x * x; a[1] += weight * x * y; a[2] += weight * x * z; a[3] += weight * x * d;
+        a[4] += weight * y * y; a[5] += weight * y * z; a[6] += weight * y * d;
+        a[7] += weight * z * z; a[8] += weight * z * d;
+        a[9] += weight * d * d;
+    }
+
+    Quadric &operator+=(const Quadric &o) {
+        for (unsigned int i = 0; i < 10; ++i) {
+            a[i] += o.a[i];
+        }
+        return *this;
+    }
+
+    double Error(const aiVector3D &p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        const double e = a[0] * x * x + 2 * a[1] * x * y + 2 * a[2] * x * z + 2 * a[3] * x
+                       + a[4] * y * y + 2 * a[5] * y * z + 2 * a[6] * y
+                       + a[7] * z * z + 2 * a[8] * z
+                       + a[9];
+        return std::max(e, 0.0);
+    }
+};
+
+struct Collapse {
+    double mError;
+    unsigned int mFrom, mTo;
+
+    bool operator<(const Collapse &o) const {
+        // std::priority_queue is a max-heap
+        return mError > o.mError;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Edge collapse simplifier working on the index buffer of a triangle mesh
+class QuadricSimplifier {
+public:
+    explicit QuadricSimplifier(const aiMesh *mesh) :
+            mMesh(mesh),
+            mIndices(mesh->mNumFaces * 3),
+            mFaceAlive(mesh->mNumFaces, true),
+            mVertexFaces(mesh->mNumVertices),
+            mQuadrics(mesh->mNumVertices),
+            mLocked(mesh->mNumVertices, false),
+            mRemoved(mesh->mNumVertices, false),
+            mBone(mesh->mNumVertices, -1),
+            mNumFaces(mesh->mNumFaces) {
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < 3; ++i) {
+                mIndices[f * 3 + i] = mesh->mFaces[f].mIndices[i];
+                mVertexFaces[mIndices[f * 3 + i]].push_back(f);
+            }
+        }
+        SetupQuadrics();
+        LockBordersAndSeams();
+        SetupBones();
+
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < 3; ++i) {
+                PushCollapse(mIndices[f * 3 + i], mIndices[f * 3 + (i + 1) % 3]);
+                PushCollapse(mIndices[f * 3 + (i + 1) % 3], mIndices[f * 3 + i]);
+            }
+        }
+    }
+
+    // Collapses edges until the face count reaches the target or the error limit is hit
+    void Simplify(unsigned int targetFaces, double maxError) {
+        while (mNumFaces > targetFaces && !mQueue.empty()) {
+            const Collapse c = mQueue.top();
+            mQueue.pop();
+            if (c.mError > maxError) {
+                break;
+            }
+            if (mRemoved[c.mFrom] || mRemoved[c.mTo] || !IsEdge(c.mFrom, c.mTo)) {
+                continue;
+            }
+
+            // the quadrics changed since the collapse was queued, requeue with the actual error
+            const double error = CollapseError(c.mFrom, c.mTo);
+            if (error > c.mError * (1.0 + 1e-6) + 1e-12) {
+                mQueue.push(Collapse{ error, c.mFrom, c.mTo });
+                continue;
+            }
+            if (!IsValidCollapse(c.mFrom, c.mTo)) {
+                continue;
+            }
+            DoCollapse(c.mFrom, c.mTo);
+        }
+    }
+
+    unsigned int GetNumFaces() const { return mNumFaces; }
+
+    // Builds a new mesh from the remaining faces
+    aiMesh *BuildMesh() const;
+
+private:
+    aiVector3D FaceNormal(unsigned int f, unsigned int replace, unsigned int by) const {
+        aiVector3D p[3];
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int idx = mIndices[f * 3 + i];
+            p[i] = mMesh->mVertices[idx == replace ? by : idx];
+        }
+        return (p[1] - p[0]) ^ (p[2] - p[0]);
+    }
+
+    void SetupQuadrics() {
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            aiVector3D n = FaceNormal(f, ~0u, ~0u);
+            const ai_real area = n.Length();
+            if (area <= 0.0) {
+                continue;
+            }
+            n /= area;
+            const double d = -(n * mMesh->mVertices[mIndices[f * 3]]);
+            for (unsigned int i = 0; i < 3; ++i) {
+                mQuadrics[mIndices[f * 3 + i]].AddPlane(n, d, area);
+            }
+        }
+    }
+
+    // Vertices on open borders and vertices sharing their position with other vertices
+    // (attribute seams) may not be removed.
+    void LockBordersAndSeams() {
+        std::unordered_map<uint64_t, unsigned int> edges;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < 3; ++i) {
+                const uint64_t a = mIndices[f * 3 + i], b = mIndices[f * 3 + (i + 1) % 3];
+                ++edges[std::min(a, b) << 32 | std::max(a, b)];
+            }
+        }
+        for (const auto &edge : edges) {
+            if (edge.second != 2) {
+                mLocked[edge.first >> 32] = true;
+                mLocked[edge.first & 0xffffffff] = true;
+            }
+        }
+
+        std::unordered_map<aiVector3D, unsigned int, PositionHash> positions;
+        for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+            auto it = positions.emplace(mMesh->mVertices[v], v);
+            if (!it.second) {
+                mLocked[v] = true;
+                mLocked[it.first->second] = true;
+            }
+        }
+    }
+
+    void SetupBones() {
+        std::vector<float> weight(mMesh->mNumVertices, 0.f);
+        for (unsigned int b = 0; b < mMesh->mNumBones; ++b) {
+            const aiBone *bone = mMesh->mBones[b];
+            for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                const aiVertexWeight &vw = bone->mWeights[w];
+                if (vw.mVertexId < mMesh->mNumVertices && vw.mWeight > weight[vw.mVertexId]) {
+                    weight[vw.mVertexId] = vw.mWeight;
+                    mBone[vw.mVertexId] = static_cast<int>(b);
+                }
+            }
+        }
+    }
+
+    double CollapseError(unsigned int from, unsigned int to) const {
+        Quadric q = mQuadrics[from];
+        q += mQuadrics[to];
+        return q.Error(mMesh->mVertices[to]);
+    }
+
+    void PushCollapse(unsigned int from, unsigned int to) {
+        if (from == to || mLocked[from] || mBone[from] != mBone[to]) {
+            return;
+        }
+        mQueue.push(Collapse{ CollapseError(from, to), from, to });
+    }
+
+    bool IsEdge(unsigned int a, unsigned int b) const {
+        for (unsigned int f : mVertexFaces[a]) {
+            if (mFaceAlive[f] && HasVertex(f, b)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasVertex(unsigned int f, unsigned int v) const {
+        return mIndices[f * 3] == v || mIndices[f * 3 + 1] == v || mIndices[f * 3 + 2] == v;
+    }
+
+    void CollectNeighbours(unsigned int v, std::vector<unsigned int> &out) const {
+        out.clear();
+        for (unsigned int f : mVertexFaces[v]) {
+            if (!mFaceAlive[f]) {
+                continue;
+            }
+            for (unsigned int i = 0; i < 3; ++i) {
+                const unsigned int n = mIndices[f * 3 + i];
+                if (n != v && std::find(out.begin(), out.end(), n) == out.end()) {
+                    out.push_back(n);
+                }
+            }
+        }
+    }
+
+    bool IsValidCollapse(unsigned int from, unsigned int to) {
+        // link condition: the edge must be shared by exactly two faces whose opposite
+        // vertices are the only common neighbours, otherwise the collapse is non-manifold
+        CollectNeighbours(from, mNeighboursFrom);
+        CollectNeighbours(to, mNeighboursTo);
+        unsigned int common = 0;
+        for (unsigned int n : mNeighboursFrom) {
+            common += std::find(mNeighboursTo.begin(), mNeighboursTo.end(), n) != mNeighboursTo.end();
+        }
+        if (common != 2) {
+            return false;
+        }
+
+        // faces which remain must not flip
+        for (unsigned int f : mVertexFaces[from]) {
+            if (!mFaceAlive[f] || HasVertex(f, to)) {
+                continue;
+            }
+            const aiVector3D before = FaceNormal(f, ~0u, ~0u);
+            const aiVector3D after = FaceNormal(f, from, to);
+            if (before * after <= 0.0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void DoCollapse(unsigned int from, unsigned int to) {
+        for (unsigned int f : mVertexFaces[from]) {
+            if (!mFaceAlive[f]) {
+                continue;
+            }
+            if (HasVertex(f, to)) {
+                mFaceAlive[f] = false;
+                --mNumFaces;
+                continue;
+            }
+            for (unsigned int i = 0; i < 3; ++i) {
+                if (mIndices[f * 3 + i] == from) {
+                    mIndices[f * 3 + i] = to;
+                }
+            }
+            mVertexFaces[to].push_back(f);
+        }
+        mVertexFaces[from].clear();
+        mRemoved[from] = true;
+        mQuadrics[to] += mQuadrics[from];
+
+        // drop dead faces from the list of the surviving vertex and requeue its edges
+        std::vector<unsigned int> &faces = mVertexFaces[to];
+        faces.erase(std::remove_if(faces.begin(), faces.end(), [this](unsigned int f) { return !mFaceAlive[f]; }), faces.end());
+        CollectNeighbours(to, mNeighboursTo);
+        for (unsigned int n : mNeighboursTo) {
+            PushCollapse(n, to);
+            PushCollapse(to, n);
+        }
+    }
+
+    struct PositionHash {
+        size_t operator()(const aiVector3D &v) const {
+            std::hash<ai_real> hasher;
+            size_t seed = hasher(v.x);
+            seed ^= hasher(v.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            seed ^= hasher(v.z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            return seed;
+        }
+    };
+
+    const aiMesh *mMesh;
+    std::vector<unsigned int> mIndices;
+    std::vector<bool> mFaceAlive;
+    std::vector<std::vector<unsigned int>> mVertexFaces;
+    std::vector<Quadric> mQuadrics;
+    std::vector<bool> mLocked;
+    std::vector<bool> mRemoved;
+    std::vector<int> mBone;
+    std::priority_queue<Collapse> mQueue;
+    std::vector<unsigned int> mNeighboursFrom, mNeighboursTo;
+    unsigned int mNumFaces;
+};
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+T *compactArray(const T *in, const std::vector<unsigned int> &used) {
+    if (nullptr == in) {
+        return nullptr;
+    }
+    T *out = new T[used.size()];
+    for (size_t i = 0; i < used.size(); ++i) {
+        out[i] = in[used[i]];
+    }
+    return out;
+}
+
+template <typename XMesh>
+void compactVertexChannels(const XMesh *in, XMesh *out, const std::vector<unsigned int> &used) {
+    out->mNumVertices = static_cast<unsigned int>(used.size());
+    out->mVertices = compactArray(in->mVertices, used);
+    out->mNormals = compactArray(in->mNormals, used);
+    out->mTangents = compactArray(in->mTangents, used);
+    out->mBitangents = compactArray(in->mBitangents, used);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        out->mTextureCoords[i] = compactArray(in->mTextureCoords[i], used);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        out->mColors[i] = compactArray(in->mColors[i], used);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMesh *QuadricSimplifier::BuildMesh() const {
+    static const unsigned int Unused = 0xffffffff;
+    std::vector<unsigned int> remap(mMesh->mNumVertices, Unused);
+    std::vector<unsigned int> used;
+
+    aiMesh *out = new aiMesh();
+    out->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    out->mMaterialIndex = mMesh->mMaterialIndex;
+    out->mMethod = mMesh->mMethod;
+    out->mNumFaces = mNumFaces;
+    out->mFaces = new aiFace[mNumFaces];
+
+    unsigned int face = 0;
+    for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+        if (!mFaceAlive[f]) {
+            continue;
+        }
+        aiFace &outFace = out->mFaces[face++];
+        outFace.mNumIndices = 3;
+        outFace.mIndices = new unsigned int[3];
+        for (unsigned int i = 0; i < 3; ++i) {
+            unsigned int &idx = remap[mIndices[f * 3 + i]];
+            if (Unused == idx) {
+                idx = static_cast<unsigned int>(used.size());
+                used.push_back(mIndices[f * 3 + i]);
+            }
+            outFace.mIndices[i] = idx;
+        }
+    }
+
+    compactVertexChannels(mMesh, out, used);
+    std::copy(mMesh->mNumUVComponents, mMesh->mNumUVComponents + AI_MAX_NUMBER_OF_TEXTURECOORDS, out->mNumUVComponents);
+
+    // the surviving vertices keep their original bone weights
+    std::vector<aiBone *> bones;
+    for (unsigned int b = 0; b < mMesh->mNumBones; ++b) {
+        const aiBone *inBone = mMesh->mBones[b];
+        std::vector<aiVertexWeight> weights;
+        for (unsigned int w = 0; w < inBone->mNumWeights; ++w) {
+            const aiVertexWeight &vw = inBone->mWeights[w];
+            if (vw.mVertexId < remap.size() && Unused != remap[vw.mVertexId]) {
+                weights.emplace_back(remap[vw.mVertexId], vw.mWeight);
+            }
+        }
+        if (weights.empty()) {
+            continue;
+        }
+        aiBone *bone = new aiBone();
+        bone->mName = inBone->mName;
+        bone->mArmature = inBone->mArmature;
+        bone->mNode = inBone->mNode;
+        bone->mOffsetMatrix = inBone->mOffsetMatrix;
+        bone->mNumWeights = static_cast<unsigned int>(weights.size());
+        bone->mWeights = new aiVertexWeight[bone->mNumWeights];
+        std::copy(weights.begin(), weights.end(), bone->mWeights);
+        bones.push_back(bone);
+    }
+    if (!bones.empty()) {
+        out->mNumBones = static_cast<unsigned int>(bones.size());
+        out->mBones = new aiBone *[out->mNumBones];
+        std::copy(bones.begin(), bones.end(), out->mBones);
+    }
+
+    // blend shapes keep working on the remaining vertices
+    if (mMesh->mNumAnimMeshes > 0) {
+        out->mAnimMeshes = new aiAnimMesh *[mMesh->mNumAnimMeshes];
+        for (unsigned int a = 0; a < mMesh->mNumAnimMeshes; ++a) {
+            const aiAnimMesh *inAnim = mMesh->mAnimMeshes[a];
+            if (inAnim->mNumVertices != mMesh->mNumVertices) {
+                ASSIMP_LOG_WARN("GenLODsProcess: Dropping blend shape ", inAnim->mName.C_Str(), ", its vertex count does not match the mesh");
+                continue;
+            }
+            aiAnimMesh *anim = out->mAnimMeshes[out->mNumAnimMeshes++] = new aiAnimMesh();
+            anim->mName = inAnim->mName;
+            anim->mWeight = inAnim->mWeight;
+            compactVertexChannels(inAnim, anim, used);
+        }
+        if (0 == out->mNumAnimMeshes) {
+            delete[] out->mAnimMeshes;
+            out->mAnimMeshes = nullptr;
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::ProcessMesh(const aiMesh *pMesh, std::vector<aiMesh *> &out) const {
+    ai_assert(nullptr != pMesh);
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions() || (pMesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_VERBOSE_DEBUG("GenLODsProcess: Skipping mesh ", pMesh->mName.C_Str(), ", it is no triangle mesh");
+        return;
+    }
+
+    // the error limit is given relative to the size of the mesh
+    double maxError = std::numeric_limits<double>::max();
+    if (mMaxError > 0.f) {
+        aiVector3D min, max;
+        ArrayBounds(pMesh->mVertices, pMesh->mNumVertices, min, max);
+        const double limit = mMaxError * (max - min).Length();
+        maxError = limit * limit;
+    }
+
+    QuadricSimplifier simplifier(pMesh);
+    unsigned int lastNumFaces = pMesh->mNumFaces;
+    for (size_t n = 0; n < mRatios.size(); ++n) {
+        simplifier.Simplify(static_cast<unsigned int>(pMesh->mNumFaces * mRatios[n]), maxError);
+        if (simplifier.GetNumFaces() == lastNumFaces || 0 == simplifier.GetNumFaces()) {
+            // no further progress possible
+            break;
+        }
+        lastNumFaces = simplifier.GetNumFaces();
+
+        aiMesh *lod = simplifier.BuildMesh();
+        lod->mName.Set(std::string(pMesh->mName.C_Str()) + "_LOD" + ai_to_string(n + 1));
+        out.push_back(lod);
+
+        ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", pMesh->mName.C_Str(), " | LOD ", n + 1, ": ", lod->mNumFaces, " of ", pMesh->mNumFaces, " faces");
+    }
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_GENLODS_PROCESS
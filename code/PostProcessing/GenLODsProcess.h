@@ -0,0 +1,116 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file Defines a post-processing step to generate simplified level-of-detail meshes.
+ */
+
+#pragma once
+
+#ifndef AI_GENLODSPROCESS_H_INC
+#define AI_GENLODSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+#include <vector>
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing process to generate a chain of simplified meshes
+ *        (levels of detail) for each triangle mesh.
+ *
+ * The simplification collapses edges in order of their quadric error
+ * (Garland & Heckbert). Collapses always move a vertex onto one of its
+ * neighbours, so no vertex attributes need to be interpolated. Vertices on
+ * open borders and attribute seams are never removed, and vertices are only
+ * merged if they are dominated by the same bone.
+ *
+ * The generated meshes are appended to aiScene::mMeshes. The index of LOD
+ * level n (starting at 1) of mesh i is stored as AI_UINT32 entry
+ * "LOD_<i>_<n>" in the scene metadata.
+ */
+class ASSIMP_API GenLODsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    GenLODsProcess();
+    ~GenLODsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns false, this step is selected via the extra flags.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Will return true, if aiProcessExtra_GenLODs is defined.
+    bool IsExtraActive(unsigned int pExtraFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads the target ratios and the error limit.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /** @brief Generates the simplified versions of a single mesh.
+     *  @param pMesh The mesh to simplify, it is not modified.
+     *  @param out Receives one mesh per configured ratio, unless the
+     *    mesh could not be simplified any further.
+     */
+    void ProcessMesh(const aiMesh *pMesh, std::vector<aiMesh *> &out) const;
+
+private:
+    std::vector<float> mRatios;
+    float mMaxError;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#endif // AI_GENLODSPROCESS_H_INC
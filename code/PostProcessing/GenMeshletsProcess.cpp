@@ -0,0 +1,299 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to partition meshes into meshlets.
+ */
+
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+
+#include "PostProcessing/GenMeshletsProcess.h"
+#include "Common/VertexTriangleAdjacency.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+GenMeshletsProcess::GenMeshletsProcess() :
+        mMaxVertices(AI_GML_DEFAULT_MAX_VERTICES), mMaxTriangles(AI_GML_DEFAULT_MAX_TRIANGLES) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenMeshletsProcess::IsActive(unsigned int /*pFlags*/) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenMeshletsProcess::IsExtraActive(unsigned int pExtraFlags) const {
+    return 0 != (pExtraFlags & aiProcessExtra_GenMeshlets);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::SetupProperties(const Importer *pImp) {
+    // local vertex indices are stored as bytes, so there can't be more than 256 vertices
+    const int maxVertices = pImp->GetPropertyInteger(AI_CONFIG_PP_GML_MAX_VERTICES, AI_GML_DEFAULT_MAX_VERTICES);
+    const int maxTriangles = pImp->GetPropertyInteger(AI_CONFIG_PP_GML_MAX_TRIANGLES, AI_GML_DEFAULT_MAX_TRIANGLES);
+    mMaxVertices = static_cast<unsigned int>(std::min(std::max(maxVertices, 3), 256));
+    mMaxTriangles = static_cast<unsigned int>(std::min(std::max(maxTriangles, 1), 512));
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("GenMeshletsProcess begin");
+
+    unsigned int numMeshlets = 0;
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        aiMesh *mesh = pScene->mMeshes[i];
+        if (nullptr != mesh && ProcessMesh(mesh)) {
+            numMeshlets += mesh->mMeshlets->mNumMeshlets;
+        }
+    }
+
+    ASSIMP_LOG_INFO("GenMeshletsProcess finished. Generated ", numMeshlets, " meshlets");
+}
+
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+// Computes the bounding sphere and the normal cone of a meshlet, see
+// https://zeux.io/2023/04/28/triangle-backface-culling/ for the cone test.
+void computeMeshletBounds(const aiMesh *mesh, aiMeshlet &meshlet, const unsigned int *vertices, const unsigned char *triangles) {
+    // bounding sphere around the center of the bounding box
+    aiVector3D min = mesh->mVertices[vertices[0]], max = min;
+    for (unsigned int i = 1; i < meshlet.mNumVertices; ++i) {
+        const aiVector3D &p = mesh->mVertices[vertices[i]];
+        min.x = std::min(min.x, p.x);
+        min.y = std::min(min.y, p.y);
+        min.z = std::min(min.z, p.z);
+        max.x = std::max(max.x, p.x);
+        max.y = std::max(max.y, p.y);
+        max.z = std::max(max.z, p.z);
+    }
+    meshlet.mCenter = (min + max) * static_cast<ai_real>(0.5);
+    ai_real radius = 0.0;
+    for (unsigned int i = 0; i < meshlet.mNumVertices; ++i) {
+        radius = std::max(radius, (mesh->mVertices[vertices[i]] - meshlet.mCenter).SquareLength());
+    }
+    meshlet.mRadius = std::sqrt(radius);
+
+    // normal cone: average of the triangle normals
+    std::vector<aiVector3D> normals(meshlet.mNumTriangles);
+    aiVector3D axis;
+    for (unsigned int t = 0; t < meshlet.mNumTriangles; ++t) {
+        const aiVector3D &p0 = mesh->mVertices[vertices[triangles[t * 3]]];
+        const aiVector3D &p1 = mesh->mVertices[vertices[triangles[t * 3 + 1]]];
+        const aiVector3D &p2 = mesh->mVertices[vertices[triangles[t * 3 + 2]]];
+        aiVector3D n = (p1 - p0) ^ (p2 - p0);
+        const ai_real length = n.Length();
+        if (length > 0.0) {
+            n /= length;
+        }
+        normals[t] = n;
+        axis += n;
+    }
+
+    meshlet.mConeApex = meshlet.mCenter;
+    meshlet.mConeAxis = aiVector3D();
+    meshlet.mConeCutoff = 1.0;
+
+    const ai_real axisLength = axis.Length();
+    if (axisLength <= 0.0) {
+        return;
+    }
+    axis /= axisLength;
+
+    ai_real minDot = 1.0;
+    for (const aiVector3D &n : normals) {
+        minDot = std::min(minDot, n * axis);
+    }
+
+    // the normals span (nearly) a hemisphere, the cone can't be used for culling
+    if (minDot <= static_cast<ai_real>(0.1)) {
+        return;
+    }
+
+    // move the apex back so that the cone contains all triangle planes
+    ai_real maxT = 0.0;
+    for (unsigned int t = 0; t < meshlet.mNumTriangles; ++t) {
+        const aiVector3D &p0 = mesh->mVertices[vertices[triangles[t * 3]]];
+        const ai_real dc = (meshlet.mCenter - p0) * normals[t];
+        const ai_real dn = normals[t] * axis;
+        maxT = std::max(maxT, dc / dn);
+    }
+
+    meshlet.mConeApex = meshlet.mCenter - axis * maxT;
+    meshlet.mConeAxis = axis;
+    meshlet.mConeCutoff = std::sqrt(1 - minDot * minDot);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool GenMeshletsProcess::ProcessMesh(aiMesh *pMesh) const {
+    ai_assert(nullptr != pMesh);
+
+    delete pMesh->mMeshlets;
+    pMesh->mMeshlets = nullptr;
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions()) {
+        return false;
+    }
+
+    if ((pMesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_WARN("GenMeshletsProcess: Mesh ", pMesh->mName.C_Str(), " is skipped, it contains non-triangle faces");
+        return false;
+    }
+
+    static const unsigned int Unused = 0xffffffff;
+    const unsigned int numFaces = pMesh->mNumFaces;
+    VertexTriangleAdjacency adj(pMesh->mFaces, numFaces, pMesh->mNumVertices, true);
+
+    // local index of each vertex in the current meshlet
+    std::vector<unsigned int> localIndex(pMesh->mNumVertices, Unused);
+    std::vector<bool> abEmitted(numFaces, false);
+
+    std::vector<aiMeshlet> meshlets;
+    std::vector<unsigned int> vertices;
+    std::vector<unsigned char> triangles;
+    vertices.reserve(pMesh->mNumVertices);
+    triangles.reserve(numFaces * 3);
+
+    aiMeshlet current;
+    auto flush = [&]() {
+        for (unsigned int i = 0; i < current.mNumVertices; ++i) {
+            localIndex[vertices[current.mVertexOffset + i]] = Unused;
+        }
+        computeMeshletBounds(pMesh, current, &vertices[current.mVertexOffset], &triangles[current.mTriangleOffset]);
+        meshlets.push_back(current);
+
+        current = aiMeshlet();
+        current.mVertexOffset = static_cast<unsigned int>(vertices.size());
+        current.mTriangleOffset = static_cast<unsigned int>(triangles.size());
+    };
+
+    // returns the number of vertices a face would add to the current meshlet
+    auto countNewVertices = [&](const aiFace &face) {
+        const unsigned int *ind = face.mIndices;
+        unsigned int numNew = 0;
+        numNew += localIndex[ind[0]] == Unused;
+        numNew += localIndex[ind[1]] == Unused && ind[1] != ind[0];
+        numNew += localIndex[ind[2]] == Unused && ind[2] != ind[0] && ind[2] != ind[1];
+        return numNew;
+    };
+
+    unsigned int scanCursor = 0;
+    for (unsigned int numEmitted = 0; numEmitted < numFaces; ++numEmitted) {
+        if (current.mNumTriangles == mMaxTriangles) {
+            flush();
+        }
+
+        // find the adjacent triangle which adds the fewest vertices and still fits
+        int best = -1;
+        unsigned int bestNew = 4;
+        for (unsigned int i = 0; i < current.mNumVertices && bestNew > 0; ++i) {
+            const unsigned int dp = vertices[current.mVertexOffset + i];
+            const unsigned int *piList = adj.GetAdjacentTriangles(dp);
+            for (unsigned int t = 0; t < adj.mLiveTriangles[dp]; ++t) {
+                const unsigned int fidx = piList[t];
+                if (abEmitted[fidx]) {
+                    continue;
+                }
+                const unsigned int numNew = countNewVertices(pMesh->mFaces[fidx]);
+                if (numNew < bestNew && current.mNumVertices + numNew <= mMaxVertices) {
+                    bestNew = numNew;
+                    best = static_cast<int>(fidx);
+                    if (0 == numNew) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        // no candidate, start a new meshlet with the next triangle in input order
+        if (best < 0) {
+            if (current.mNumTriangles > 0) {
+                flush();
+            }
+            while (abEmitted[scanCursor]) {
+                ++scanCursor;
+            }
+            best = static_cast<int>(scanCursor);
+        }
+
+        abEmitted[best] = true;
+        const aiFace &face = pMesh->mFaces[best];
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int dp = face.mIndices[i];
+            if (localIndex[dp] == Unused) {
+                localIndex[dp] = current.mNumVertices++;
+                vertices.push_back(dp);
+            }
+            triangles.push_back(static_cast<unsigned char>(localIndex[dp]));
+        }
+        ++current.mNumTriangles;
+    }
+    flush();
+
+    aiMeshletTable *table = pMesh->mMeshlets = new aiMeshletTable();
+    table->mNumMeshlets = static_cast<unsigned int>(meshlets.size());
+    table->mMeshlets = new aiMeshlet[table->mNumMeshlets];
+    std::copy(meshlets.begin(), meshlets.end(), table->mMeshlets);
+    table->mNumVertices = static_cast<unsigned int>(vertices.size());
+    table->mVertices = new unsigned int[table->mNumVertices];
+    std::copy(vertices.begin(), vertices.end(), table->mVertices);
+    table->mNumTriangleIndices = static_cast<unsigned int>(triangles.size());
+    table->mTriangles = new unsigned char[table->mNumTriangleIndices];
+    std::copy(triangles.begin(), triangles.end(), table->mTriangles);
+
+    ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", pMesh->mName.C_Str(), " | ", numFaces, " faces in ", table->mNumMeshlets, " meshlets");
+    return true;
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
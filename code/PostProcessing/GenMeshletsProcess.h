@@ -0,0 +1,106 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file Defines a post-processing step to partition meshes into meshlets.
+ */
+
+#pragma once
+
+#ifndef AI_GENMESHLETSPROCESS_H_INC
+#define AI_GENMESHLETSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing process to partition triangle meshes into meshlets,
+ *        small clusters of triangles suitable for mesh shaders and GPU-driven
+ *        culling. Each meshlet gets a bounding sphere and a normal cone.
+ *
+ * Triangles are added greedily to the current meshlet, preferring triangles
+ * adjacent to it which introduce the fewest new vertices.
+ */
+class ASSIMP_API GenMeshletsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    GenMeshletsProcess();
+    ~GenMeshletsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns false, this step is selected via the extra flags.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Will return true, if aiProcessExtra_GenMeshlets is defined.
+    bool IsExtraActive(unsigned int pExtraFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads the meshlet size limits.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /** @brief Generates the meshlets of a single mesh.
+     *  @param pMesh The mesh to process, replaces an existing meshlet table.
+     *  @return true if meshlets were generated. */
+    bool ProcessMesh(aiMesh *pMesh) const;
+
+private:
+    unsigned int mMaxVertices;
+    unsigned int mMaxTriangles;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_GENMESHLETS_PROCESS
+
+#endif // AI_GENMESHLETSPROCESS_H_INC
@@ -41,9 +41,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 /** @file Implementation of the post processing step to improve the cache locality of a mesh.
  * <br>
- * The algorithm is roughly basing on this paper:
+ * The default algorithm is roughly basing on this paper:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw reduction isn't implemented yet ...
+ * <br>
+ * Alternatively Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" can be used, which
+ * models an LRU cache and scores vertices by cache position and remaining valence.
+ * The overdraw reduction sorts clusters of the cache-optimized triangle order front to
+ * back as described in the paper above, the optional vertex fetch optimization reorders
+ * the vertex buffers in the order the vertices are first referenced.
  */
 
 // internal headers
@@ -55,6 +60,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <stdio.h>
+#include <algorithm>
+#include <cmath>
 #include <stack>
 
 namespace Assimp {
@@ -62,7 +69,10 @@ namespace Assimp {
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 ImproveCacheLocalityProcess::ImproveCacheLocalityProcess() :
-        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE) {
+        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE),
+        mConfigAlgorithm(aiICLAlgorithm_Tipsify),
+        mConfigOverdrawThreshold(0.f),
+        mConfigOptimizeVertexFetch(false) {
     // empty
 }
 
@@ -77,6 +87,9 @@ bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
 void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
     // AI_CONFIG_PP_ICL_PTCACHE_SIZE controls the target cache size for the optimizer
     mConfigCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, PP_ICL_PTCACHE_SIZE);
+    mConfigAlgorithm = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM, aiICLAlgorithm_Tipsify);
+    mConfigOverdrawThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, 0.f);
+    mConfigOptimizeVertexFetch = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH, false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -107,38 +120,55 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Simulates a FIFO post-transform cache using per-vertex time stamps: a vertex is in the cache
+// if less than configCacheDepth misses happened since it was inserted.
+namespace {
+
+class FIFOCacheSimulator {
+public:
+    FIFOCacheSimulator(unsigned int numVertices, unsigned int cacheDepth) :
+            mStamps(numVertices, 0u), mCacheDepth(cacheDepth), mTime(cacheDepth + 1) {
+        // empty
+    }
+
+    // returns the number of cache misses caused by a triangle
+    unsigned int Access(const unsigned int *indices) {
+        unsigned int misses = 0;
+        for (unsigned int i = 0; i < 3; ++i) {
+            unsigned int &stamp = mStamps[indices[i]];
+            if (mTime - stamp > mCacheDepth) {
+                stamp = mTime++;
+                ++misses;
+            }
+        }
+        return misses;
+    }
+
+    // evicts all vertices from the cache
+    void Flush() {
+        mTime += mCacheDepth + 1;
+    }
+
+private:
+    std::vector<unsigned int> mStamps;
+    unsigned int mCacheDepth;
+    unsigned int mTime;
+};
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 static ai_real calculateInputACMR(aiMesh *pMesh, const aiFace *const pcEnd,
         unsigned int configCacheDepth, unsigned int meshNum) {
-    ai_real fACMR = 0.0f;
-    unsigned int *piFIFOStack = new unsigned int[configCacheDepth];
-    memset(piFIFOStack, 0xff, configCacheDepth * sizeof(unsigned int));
-    unsigned int *piCur = piFIFOStack;
-    const unsigned int *const piCurEnd = piFIFOStack + configCacheDepth;
+    FIFOCacheSimulator cache(pMesh->mNumVertices, configCacheDepth);
 
     // count the number of cache misses
     unsigned int iCacheMisses = 0;
     for (const aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        for (unsigned int qq = 0; qq < 3; ++qq) {
-            bool bInCache = false;
-            for (unsigned int *pp = piFIFOStack; pp < piCurEnd; ++pp) {
-                if (*pp == pcFace->mIndices[qq]) {
-                    // the vertex is in cache
-                    bInCache = true;
-                    break;
-                }
-            }
-            if (!bInCache) {
-                ++iCacheMisses;
-                if (piCurEnd == piCur) {
-                    piCur = piFIFOStack;
-                }
-                *piCur++ = pcFace->mIndices[qq];
-            }
-        }
+        iCacheMisses += cache.Access(pcFace->mIndices);
     }
-    delete[] piFIFOStack;
-    fACMR = (ai_real)iCacheMisses / pMesh->mNumFaces;
+    const ai_real fACMR = (ai_real)iCacheMisses / pMesh->mNumFaces;
     if (3.0 == fACMR) {
         char szBuff[128]; // should be sufficiently large in every case
 
@@ -155,7 +185,6 @@ static ai_real calculateInputACMR(aiMesh *pMesh, const aiFace *const pcEnd,
 // ------------------------------------------------------------------------------------------------
 // Improves the cache coherency of a specific mesh
 ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshNum) {
-    // TODO: rewrite this to use std::vector or boost::shared_array
     ai_assert(nullptr != pMesh);
 
     // Check whether the input data is valid
@@ -181,6 +210,59 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
         fACMR = calculateInputACMR(pMesh, pcEnd, mConfigCacheDepth, meshNum);
     }
 
+    // allocate an empty output index buffer. We store the output indices in one large array.
+    // Since the number of triangles won't change the input faces can be reused. This is how
+    // we save thousands of redundant mini allocations for aiFace::mIndices
+    std::vector<unsigned int> piIBOutput(pMesh->mNumFaces * 3);
+    if (mConfigAlgorithm == aiICLAlgorithm_Forsyth) {
+        OptimizeForsyth(pMesh, piIBOutput);
+    } else {
+        OptimizeTipsify(pMesh, piIBOutput);
+    }
+
+    if (mConfigOverdrawThreshold > 0.f) {
+        OptimizeOverdraw(pMesh, piIBOutput);
+    }
+
+    // sort the output index buffer back to the input array
+    std::vector<unsigned int>::const_iterator piCSIter = piIBOutput.begin();
+    for (aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
+        unsigned nind = pcFace->mNumIndices;
+        unsigned *ind = pcFace->mIndices;
+        if (nind > 0)
+            ind[0] = *piCSIter++;
+        if (nind > 1)
+            ind[1] = *piCSIter++;
+        if (nind > 2)
+            ind[2] = *piCSIter++;
+    }
+
+    if (mConfigOptimizeVertexFetch) {
+        OptimizeVertexFetch(pMesh);
+    }
+
+    ai_real fACMR2 = 0.0f;
+    if (!DefaultLogger::isNullLogger()) {
+        FIFOCacheSimulator cache(pMesh->mNumVertices, mConfigCacheDepth);
+        unsigned int iCacheMisses = 0;
+        for (const aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
+            iCacheMisses += cache.Access(pcFace->mIndices);
+        }
+        fACMR2 = static_cast<ai_real>(iCacheMisses) / pMesh->mNumFaces;
+        const ai_real averageACMR = ((fACMR - fACMR2) / fACMR) * 100.f;
+        // very intense verbose logging ... prepare for much text if there are many meshes
+        if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
+            ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", fACMR, " out: ", fACMR2, " | average ACMR ", averageACMR);
+        }
+        fACMR2 *= pMesh->mNumFaces;
+    }
+
+    return fACMR2;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Tipsify: fans around vertices which are likely to be still in the FIFO cache
+void ImproveCacheLocalityProcess::OptimizeTipsify(const aiMesh *pMesh, std::vector<unsigned int> &piIBOutput) const {
     // first we need to build a vertex-triangle adjacency list
     VertexTriangleAdjacency adj(pMesh->mFaces, pMesh->mNumFaces, pMesh->mNumVertices, true);
 
@@ -189,12 +271,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     piCachingStamps.resize(pMesh->mNumVertices);
     memset(&piCachingStamps[0], 0x0, pMesh->mNumVertices * sizeof(unsigned int));
 
-    // allocate an empty output index buffer. We store the output indices in one large array.
-    // Since the number of triangles won't change the input faces can be reused. This is how
-    // we save thousands of redundant mini allocations for aiFace::mIndices
-    const unsigned int iIdxCnt = pMesh->mNumFaces * 3;
-    std::vector<unsigned int> piIBOutput;
-    piIBOutput.resize(iIdxCnt);
     std::vector<unsigned int>::iterator piCSIter = piIBOutput.begin();
 
     // allocate the flag array to hold the information
@@ -220,7 +296,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     ai_assert(iMaxRefTris > 0);
     std::vector<unsigned int> piCandidates;
     piCandidates.resize(iMaxRefTris * 3);
-    unsigned int iCacheMisses = 0;
 
     // ...................................................................................
     /** PSEUDOCODE for the algorithm
@@ -292,7 +367,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
                     // if the vertex is not yet in cache, set its cache count
                     if (iStampCnt - piCachingStamps[dp] > mConfigCacheDepth) {
                         piCachingStamps[dp] = iStampCnt++;
-                        ++iCacheMisses;
                     }
                 }
                 // flag triangle as emitted
@@ -352,32 +426,321 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
             }
         }
     }
-    ai_real fACMR2 = 0.0f;
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR2 = static_cast<ai_real>(iCacheMisses / pMesh->mNumFaces);
-        const ai_real averageACMR = ((fACMR - fACMR2) / fACMR) * 100.f;
-        // very intense verbose logging ... prepare for much text if there are many meshes
-        if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
-            ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", fACMR, " out: ", fACMR2, " | average ACMR ", averageACMR);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Scoring function of the Forsyth optimizer, see
+// https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+namespace {
+
+const float ForsythCacheDecayPower = 1.5f;
+const float ForsythLastTriScore = 0.75f;
+const float ForsythValenceBoostScale = 2.0f;
+const float ForsythValenceBoostPower = 0.5f;
+
+float forsythVertexScore(int cachePosition, unsigned int cacheSize, unsigned int numLiveTriangles) {
+    if (0 == numLiveTriangles) {
+        // no triangle needs this vertex anymore
+        return 0.f;
+    }
+
+    float score = 0.f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // the vertex was used in the last triangle, so the score is fixed to discourage
+            // using it again right away (this would create a strip instead of a fan)
+            score = ForsythLastTriScore;
+        } else {
+            const float scaler = 1.f / static_cast<float>(cacheSize - 3);
+            score = std::pow(1.f - static_cast<float>(cachePosition - 3) * scaler, ForsythCacheDecayPower);
         }
-        fACMR2 *= pMesh->mNumFaces;
     }
 
-    // sort the output index buffer back to the input array
-    piCSIter = piIBOutput.begin();
-    for (aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        unsigned nind = pcFace->mNumIndices;
-        unsigned *ind = pcFace->mIndices;
-        if (nind > 0)
-            ind[0] = *piCSIter++;
-        if (nind > 1)
-            ind[1] = *piCSIter++;
-        if (nind > 2)
-            ind[2] = *piCSIter++;
+    // boost vertices with only few remaining triangles to get rid of lone triangles
+    score += ForsythValenceBoostScale * std::pow(static_cast<float>(numLiveTriangles), -ForsythValenceBoostPower);
+    return score;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Forsyth: greedily emits the triangle with the highest score, modelling an LRU cache
+void ImproveCacheLocalityProcess::OptimizeForsyth(const aiMesh *pMesh, std::vector<unsigned int> &piIBOutput) const {
+    // the scoring function needs at least a handful of entries besides the last triangle
+    const unsigned int cacheSize = std::max(mConfigCacheDepth, 4u);
+    const unsigned int numVertices = pMesh->mNumVertices;
+    const unsigned int numFaces = pMesh->mNumFaces;
+
+    // adjacency lists are shrunk as triangles are emitted, mLiveTriangles holds their length
+    VertexTriangleAdjacency adj(pMesh->mFaces, numFaces, numVertices, true);
+    unsigned int *const piNumLive = adj.mLiveTriangles;
+
+    std::vector<int> cachePosition(numVertices, -1);
+    std::vector<float> vertexScore(numVertices);
+    for (unsigned int v = 0; v < numVertices; ++v) {
+        vertexScore[v] = forsythVertexScore(-1, cacheSize, piNumLive[v]);
     }
 
-    return fACMR2;
+    std::vector<float> triangleScore(numFaces);
+    int bestTriangle = -1;
+    float bestScore = -1.f;
+    for (unsigned int f = 0; f < numFaces; ++f) {
+        const unsigned int *ind = pMesh->mFaces[f].mIndices;
+        triangleScore[f] = vertexScore[ind[0]] + vertexScore[ind[1]] + vertexScore[ind[2]];
+        if (triangleScore[f] > bestScore) {
+            bestScore = triangleScore[f];
+            bestTriangle = static_cast<int>(f);
+        }
+    }
+
+    std::vector<bool> abEmitted(numFaces, false);
+    std::vector<unsigned int> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+
+    unsigned int scanCursor = 0;
+    std::vector<unsigned int>::iterator piCSIter = piIBOutput.begin();
+    for (unsigned int emitted = 0; emitted < numFaces; ++emitted) {
+        if (bestTriangle < 0) {
+            // no candidate in the cache, continue with the next triangle in input order
+            while (abEmitted[scanCursor]) {
+                ++scanCursor;
+            }
+            bestTriangle = static_cast<int>(scanCursor);
+        }
+
+        const unsigned int *ind = pMesh->mFaces[bestTriangle].mIndices;
+        abEmitted[bestTriangle] = true;
+
+        // emit the triangle and remove it from the adjacency lists of its vertices
+        newCache.clear();
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int dp = ind[i];
+            *piCSIter++ = dp;
+
+            unsigned int *piList = adj.GetAdjacentTriangles(dp);
+            unsigned int &numLive = piNumLive[dp];
+            for (unsigned int t = 0; t < numLive; ++t) {
+                if (piList[t] == static_cast<unsigned int>(bestTriangle)) {
+                    std::swap(piList[t], piList[numLive - 1]);
+                    --numLive;
+                    break;
+                }
+            }
+            if (std::find(newCache.begin(), newCache.end(), dp) == newCache.end()) {
+                newCache.push_back(dp);
+            }
+        }
+
+        // the vertices of the emitted triangle move to the front of the LRU cache
+        for (unsigned int dp : cache) {
+            if (ind[0] != dp && ind[1] != dp && ind[2] != dp) {
+                newCache.push_back(dp);
+            }
+        }
+
+        // update the scores of all vertices whose cache position changed and of their triangles
+        for (size_t i = 0; i < newCache.size(); ++i) {
+            const unsigned int dp = newCache[i];
+            cachePosition[dp] = i < cacheSize ? static_cast<int>(i) : -1;
+
+            const float score = forsythVertexScore(cachePosition[dp], cacheSize, piNumLive[dp]);
+            const float delta = score - vertexScore[dp];
+            vertexScore[dp] = score;
+
+            const unsigned int *piList = adj.GetAdjacentTriangles(dp);
+            for (unsigned int t = 0; t < piNumLive[dp]; ++t) {
+                triangleScore[piList[t]] += delta;
+            }
+        }
+        if (newCache.size() > cacheSize) {
+            newCache.resize(cacheSize);
+        }
+        cache.swap(newCache);
+
+        // find the best triangle adjacent to the cache
+        bestTriangle = -1;
+        bestScore = -1.f;
+        for (unsigned int dp : cache) {
+            const unsigned int *piList = adj.GetAdjacentTriangles(dp);
+            for (unsigned int t = 0; t < piNumLive[dp]; ++t) {
+                if (triangleScore[piList[t]] > bestScore) {
+                    bestScore = triangleScore[piList[t]];
+                    bestTriangle = static_cast<int>(piList[t]);
+                }
+            }
+        }
+    }
 }
 
-} // namespace Assimp
+// ------------------------------------------------------------------------------------------------
+// Splits the cache-optimized triangle order into clusters and sorts them so that clusters facing
+// away from the mesh center, which are likely to occlude others, are rendered first.
+void ImproveCacheLocalityProcess::OptimizeOverdraw(const aiMesh *pMesh, std::vector<unsigned int> &piIBOutput) const {
+    const unsigned int numFaces = static_cast<unsigned int>(piIBOutput.size() / 3);
+    FIFOCacheSimulator cache(pMesh->mNumVertices, mConfigCacheDepth);
+
+    // hard boundaries: triangles which miss the cache for all of their vertices
+    std::vector<unsigned int> hardBounds;
+    for (unsigned int f = 0; f < numFaces; ++f) {
+        if (cache.Access(&piIBOutput[f * 3]) == 3) {
+            hardBounds.push_back(f);
+        }
+    }
+    hardBounds.push_back(numFaces);
+
+    // soft boundaries: split clusters further as long as the local ACMR stays within the
+    // given threshold of the ACMR of the whole cluster
+    std::vector<unsigned int> clusters;
+    for (size_t c = 0; c + 1 < hardBounds.size(); ++c) {
+        const unsigned int start = hardBounds[c], end = hardBounds[c + 1];
+
+        cache.Flush();
+        unsigned int clusterMisses = 0;
+        for (unsigned int f = start; f < end; ++f) {
+            clusterMisses += cache.Access(&piIBOutput[f * 3]);
+        }
+        const float clusterACMR = static_cast<float>(clusterMisses) / (end - start);
+
+        cache.Flush();
+        clusters.push_back(start);
+        unsigned int runningStart = start, runningMisses = 0;
+        for (unsigned int f = start; f < end; ++f) {
+            runningMisses += cache.Access(&piIBOutput[f * 3]);
+            if (f + 1 < end && runningMisses <= clusterACMR * mConfigOverdrawThreshold * (f + 1 - runningStart)) {
+                clusters.push_back(f + 1);
+                cache.Flush();
+                runningStart = f + 1;
+                runningMisses = 0;
+            }
+        }
+    }
+    clusters.push_back(numFaces);
+
+    // compute the area-weighted center of the mesh
+    aiVector3D meshCenter;
+    ai_real meshArea = 0.0;
+    const size_t numClusters = clusters.size() - 1;
+    std::vector<aiVector3D> clusterCenter(numClusters), clusterNormal(numClusters);
+    for (size_t c = 0; c < numClusters; ++c) {
+        ai_real clusterArea = 0.0;
+        for (unsigned int f = clusters[c]; f < clusters[c + 1]; ++f) {
+            const aiVector3D &p0 = pMesh->mVertices[piIBOutput[f * 3]];
+            const aiVector3D &p1 = pMesh->mVertices[piIBOutput[f * 3 + 1]];
+            const aiVector3D &p2 = pMesh->mVertices[piIBOutput[f * 3 + 2]];
+            const aiVector3D normal = (p1 - p0) ^ (p2 - p0);
+            const ai_real area = normal.Length();
+
+            clusterCenter[c] += (p0 + p1 + p2) * (area / 3.f);
+            clusterNormal[c] += normal;
+            clusterArea += area;
+        }
+        meshCenter += clusterCenter[c];
+        meshArea += clusterArea;
+        if (clusterArea > 0.0) {
+            clusterCenter[c] /= clusterArea;
+        }
+    }
+    if (meshArea > 0.0) {
+        meshCenter /= meshArea;
+    }
+
+    // sort the clusters by how much they face away from the mesh center
+    std::vector<std::pair<ai_real, unsigned int>> sortKeys(numClusters);
+    for (size_t c = 0; c < numClusters; ++c) {
+        const ai_real length = clusterNormal[c].Length();
+        const ai_real key = length > 0.0 ? ((clusterCenter[c] - meshCenter) * clusterNormal[c]) / length : 0.0;
+        sortKeys[c] = std::make_pair(-key, static_cast<unsigned int>(c));
+    }
+    std::stable_sort(sortKeys.begin(), sortKeys.end());
+
+    std::vector<unsigned int> sorted;
+    sorted.reserve(piIBOutput.size());
+    for (const auto &key : sortKeys) {
+        sorted.insert(sorted.end(), piIBOutput.begin() + clusters[key.second] * 3, piIBOutput.begin() + clusters[key.second + 1] * 3);
+    }
+    piIBOutput.swap(sorted);
+}
+
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+template <typename T>
+void remapVertexArray(T *&pArray, const std::vector<unsigned int> &remap) {
+    if (nullptr == pArray) {
+        return;
+    }
+    T *pNew = new T[remap.size()];
+    for (size_t i = 0; i < remap.size(); ++i) {
+        pNew[remap[i]] = pArray[i];
+    }
+    delete[] pArray;
+    pArray = pNew;
+}
+
+template <typename XMesh>
+void remapVertexChannels(XMesh *pMesh, const std::vector<unsigned int> &remap) {
+    remapVertexArray(pMesh->mVertices, remap);
+    remapVertexArray(pMesh->mNormals, remap);
+    remapVertexArray(pMesh->mTangents, remap);
+    remapVertexArray(pMesh->mBitangents, remap);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        remapVertexArray(pMesh->mTextureCoords[i], remap);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        remapVertexArray(pMesh->mColors[i], remap);
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the vertex buffers in the order the vertices are first referenced by the faces
+void ImproveCacheLocalityProcess::OptimizeVertexFetch(aiMesh *pMesh) const {
+    static const unsigned int Unused = 0xffffffff;
+    std::vector<unsigned int> remap(pMesh->mNumVertices, Unused);
+
+    unsigned int iNext = 0;
+    bool bIdentity = true;
+    for (const aiFace *pcFace = pMesh->mFaces; pcFace != pMesh->mFaces + pMesh->mNumFaces; ++pcFace) {
+        for (unsigned int i = 0; i < pcFace->mNumIndices; ++i) {
+            unsigned int &dp = remap[pcFace->mIndices[i]];
+            if (Unused == dp) {
+                bIdentity = bIdentity && iNext == pcFace->mIndices[i];
+                dp = iNext++;
+            }
+        }
+    }
+
+    // unreferenced vertices are kept at the end of the buffers
+    for (unsigned int &dp : remap) {
+        if (Unused == dp) {
+            dp = iNext++;
+        }
+    }
+    if (bIdentity) {
+        return;
+    }
+
+    remapVertexChannels(pMesh, remap);
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; ++a) {
+        if (pMesh->mAnimMeshes[a]->mNumVertices == pMesh->mNumVertices) {
+            remapVertexChannels(pMesh->mAnimMeshes[a], remap);
+        }
+    }
+
+    for (unsigned int a = 0; a < pMesh->mNumBones; ++a) {
+        aiBone *bone = pMesh->mBones[a];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            bone->mWeights[w].mVertexId = remap[bone->mWeights[w].mVertexId];
+        }
+    }
 
+    for (aiFace *pcFace = pMesh->mFaces; pcFace != pMesh->mFaces + pMesh->mNumFaces; ++pcFace) {
+        for (unsigned int i = 0; i < pcFace->mNumIndices; ++i) {
+            pcFace->mIndices[i] = remap[pcFace->mIndices[i]];
+        }
+    }
+}
+
+} // namespace Assimp
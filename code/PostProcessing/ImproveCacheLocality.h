@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/types.h>
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp {
@@ -57,9 +59,14 @@ namespace Assimp {
  *  cache locality. It tries to arrange all faces to fans and to render
  *  faces which share vertices directly one after the other.
  *
+ *  Optionally the faces are sorted afterwards to reduce overdraw and the
+ *  vertices are reordered for better vertex fetch locality, see
+ *  #AI_CONFIG_PP_ICL_ALGORITHM, #AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD and
+ *  #AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH.
+ *
  *  @note This step expects triagulated input data.
  */
-class ImproveCacheLocalityProcess : public BaseProcess {
+class ASSIMP_API ImproveCacheLocalityProcess : public BaseProcess {
 public:
     // -------------------------------------------------------------------
     /// The default class constructor / destructor.
@@ -86,10 +93,47 @@ protected:
      */
     ai_real ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
 
+    // -------------------------------------------------------------------
+    /** Computes a cache-friendly triangle order using the Tipsify algorithm
+     * @param pMesh The mesh to process.
+     * @param piIBOutput Receives the reordered indices, 3 per face.
+     */
+    void OptimizeTipsify(const aiMesh* pMesh, std::vector<unsigned int>& piIBOutput) const;
+
+    // -------------------------------------------------------------------
+    /** Computes a cache-friendly triangle order using Forsyth's algorithm
+     * @param pMesh The mesh to process.
+     * @param piIBOutput Receives the reordered indices, 3 per face.
+     */
+    void OptimizeForsyth(const aiMesh* pMesh, std::vector<unsigned int>& piIBOutput) const;
+
+    // -------------------------------------------------------------------
+    /** Sorts clusters of an optimized triangle order to reduce overdraw
+     * @param pMesh The mesh the indices belong to.
+     * @param piIBOutput The optimized indices, sorted in place.
+     */
+    void OptimizeOverdraw(const aiMesh* pMesh, std::vector<unsigned int>& piIBOutput) const;
+
+    // -------------------------------------------------------------------
+    /** Reorders all vertex buffers in the order they are referenced
+     * @param pMesh The mesh to process.
+     */
+    void OptimizeVertexFetch(aiMesh* pMesh) const;
+
 private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
+
+    //! Configuration parameter: the algorithm to use, see #aiICLAlgorithm
+    int mConfigAlgorithm;
+
+    //! Configuration parameter: the ACMR threshold for overdraw
+    //! optimization, 0 disables it.
+    float mConfigOverdrawThreshold;
+
+    //! Configuration parameter: whether to reorder the vertex buffers.
+    bool mConfigOptimizeVertexFetch;
 };
 
 } // end of namespace Assimp
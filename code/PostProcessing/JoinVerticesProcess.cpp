@@ -47,14 +47,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "JoinVerticesProcess.h"
 #include "ProcessHelper.h"
-#include <assimp/Vertex.h>
+#include "Common/CompactVertex.h"
 #include <assimp/TinyFormatter.h>
 
 #include <stdio.h>
-#include <unordered_set>
-#include <unordered_map>
 #include <memory>
-#include <map>
 
 using namespace Assimp;
 
@@ -100,65 +97,6 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
 
 namespace {
 
-struct CompareVerticesAlmostEqual {
-    bool operator () (const Vertex & a, const Vertex & b) const {
-        static const float epsilon = 1e-5f;
-        static const float squareEpsilon = epsilon * epsilon;
-
-        if ((a.position - b.position).SquareLength() > squareEpsilon) {
-            return false;
-        }
-
-        // We just test the other attributes even if they're not present in the mesh.
-        // In this case they're initialized to 0 so the comparison succeeds.
-        // By this method the non-present attributes are effectively ignored in the comparison.
-
-        if ((a.normal - b.normal).SquareLength() > squareEpsilon) {
-            return false;
-        }
-
-        if ((a.tangent - b.tangent).SquareLength() > squareEpsilon) {
-            return false;
-        }
-
-        if ((a.bitangent - b.bitangent).SquareLength() > squareEpsilon) {
-            return false;
-        }
-
-        for (uint32_t i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; i ++) {
-            if ((a.texcoords[i] - b.texcoords[i]).SquareLength() > squareEpsilon) {
-                return false;
-            }
-        }
-
-        for (uint32_t i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; i ++) {
-            if (GetColorDifference(a.colors[i], b.colors[i]) > squareEpsilon) {
-                return false;
-            }
-        }
-
-        // If reached this point, they are ~equal
-        return true;
-    }
-};
-
-struct HashVertex {
-    inline void hash_combine(std::size_t& seed, const ai_real& v) const {
-        std::hash<ai_real> hasher;
-        seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-
-    size_t operator () (const Vertex & v) const {
-        size_t hash = 0;
-
-        hash_combine(hash, v.position.x);
-        hash_combine(hash, v.position.y);
-        hash_combine(hash, v.position.z);
-
-        return hash;
-    }
-};
-
 template<class XMesh>
 void updateXMeshVertices(XMesh *pMesh, std::vector<int> &uniqueVertices) {
     // replace vertex data with the unique data sets
@@ -266,8 +204,13 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
             uniqueAnimatedVertices[animMeshIndex].reserve(pMesh->mNumVertices);
         }
     }
-    // a map that maps a vertex to its new index
-    std::unordered_map<Vertex, int, HashVertex, CompareVerticesAlmostEqual> vertex2Index = {};
+    // Pack only the channels present in the mesh and look them up in a flat hash table.
+    // Vertices whose positions differ bitwise are never joined, all other channels are
+    // compared using an epsilon.
+    static constexpr ai_real epsilon = static_cast<ai_real>(1e-5);
+    const CompactVertexBuffer vertices(pMesh);
+    CompactVertexHashTable vertex2Index(vertices, epsilon * epsilon);
+    uniqueVertices.reserve(pMesh->mNumVertices);
     // we can not end up with more vertices than we started with
     // Now check each vertex if it brings something new to the table
     int newIndex = 0;
@@ -276,14 +219,10 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
         if (!usedVertexIndicesMask[a]) {
             continue;
         }
-        // collect the vertex data
-        Vertex v(pMesh,a);
-        // is the vertex already in the map?
-        auto it = vertex2Index.find(v);
-        // if the vertex is not in the map then it is a new vertex add it.
-        if (it == vertex2Index.end()) {
-            // this is a new vertex give it a new index
-            vertex2Index.emplace(v, newIndex);
+        // is the vertex already in the table?
+        const unsigned int existing = vertex2Index.FindOrInsert(a);
+        // if the vertex was not in the table then it is a new vertex.
+        if (existing == a) {
             // keep track of its index and increment 1
             replaceIndex[a] = newIndex++;
             // add the vertex to the unique vertices
@@ -296,7 +235,7 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
         } else{
             // if the vertex is already there just find the replace index that is appropriate to it
 			// mark it with JOINED_VERTICES_MARK
-            replaceIndex[a] = it->second | JOINED_VERTICES_MARK;
+            replaceIndex[a] = replaceIndex[existing] | JOINED_VERTICES_MARK;
         }
     }
 
@@ -0,0 +1,280 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to remove redundant animation keys.
+ */
+
+#ifndef ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS
+
+#include "PostProcessing/OptimizeAnimationsProcess.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Interpolation factor of time t between two keys
+inline ai_real Factor(double ta, double tb, double t) {
+    return tb > ta ? static_cast<ai_real>((t - ta) / (tb - ta)) : ai_real(0.0);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Angle between two rotations, in radians
+inline ai_real Angle(const aiQuaternion &a, const aiQuaternion &b) {
+    const double la = std::sqrt((double)a.w * a.w + (double)a.x * a.x + (double)a.y * a.y + (double)a.z * a.z);
+    const double lb = std::sqrt((double)b.w * b.w + (double)b.x * b.x + (double)b.y * b.y + (double)b.z * b.z);
+    if (la <= 0.0 || lb <= 0.0) {
+        return ai_real(0.0);
+    }
+    const double dot = ((double)a.w * b.w + (double)a.x * b.x + (double)a.y * b.y + (double)a.z * b.z) / (la * lb);
+    return static_cast<ai_real>(2.0 * std::acos(std::min(std::fabs(dot), 1.0)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Error of a vector key against the track between keys a and b
+inline ai_real Error(const aiVectorKey &a, const aiVectorKey &b, const aiVectorKey &key, bool step) {
+    if (step) {
+        return (key.mValue - a.mValue).Length();
+    }
+    const aiVector3D value = a.mValue + (b.mValue - a.mValue) * Factor(a.mTime, b.mTime, key.mTime);
+    return (key.mValue - value).Length();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Error of a rotation key against the track between keys a and b
+inline ai_real Error(const aiQuatKey &a, const aiQuatKey &b, const aiQuatKey &key, bool step) {
+    if (step) {
+        return Angle(key.mValue, a.mValue);
+    }
+    aiQuaternion value;
+    aiQuaternion::Interpolate(value, a.mValue, b.mValue, Factor(a.mTime, b.mTime, key.mTime));
+    return Angle(key.mValue, value);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the track can be reduced, sets step if it uses step interpolation
+template <typename KeyType>
+bool IsReducible(const KeyType *keys, unsigned int numKeys, bool &step) {
+    unsigned int numStep = 0, numLinear = 0;
+    for (unsigned int i = 0; i < numKeys; ++i) {
+        switch (keys[i].mInterpolation) {
+        case aiAnimInterpolation_Step:
+            ++numStep;
+            break;
+        case aiAnimInterpolation_Linear:
+        case aiAnimInterpolation_Spherical_Linear:
+            ++numLinear;
+            break;
+        default:
+            return false;
+        }
+    }
+    step = numStep == numKeys;
+    return step || numLinear == numKeys;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Removes all keys of a track which are reproduced by the remaining keys within the tolerance.
+// Returns the number of removed keys.
+template <typename KeyType>
+unsigned int ReduceTrack(KeyType *&keys, unsigned int &numKeys, ai_real tolerance) {
+    bool step = false;
+    if (numKeys < 2 || !IsReducible(keys, numKeys, step)) {
+        return 0;
+    }
+
+    std::vector<bool> keep(numKeys, false);
+
+    // a constant track collapses to its first key
+    bool constant = true;
+    for (unsigned int i = 1; i < numKeys && constant; ++i) {
+        constant = Error(keys[0], keys[0], keys[i], true) <= tolerance;
+    }
+    keep[0] = true;
+
+    if (!constant) {
+        keep[numKeys - 1] = true;
+
+        // subdivide at the key with the largest error until all are within the tolerance
+        std::vector<std::pair<unsigned int, unsigned int>> stack;
+        stack.emplace_back(0, numKeys - 1);
+        while (!stack.empty()) {
+            const std::pair<unsigned int, unsigned int> range = stack.back();
+            stack.pop_back();
+
+            ai_real maxError = ai_real(0.0);
+            unsigned int maxKey = 0;
+            for (unsigned int i = range.first + 1; i < range.second; ++i) {
+                const ai_real error = Error(keys[range.first], keys[range.second], keys[i], step);
+                if (error > maxError) {
+                    maxError = error;
+                    maxKey = i;
+                }
+            }
+            if (maxError > tolerance) {
+                keep[maxKey] = true;
+                stack.emplace_back(range.first, maxKey);
+                stack.emplace_back(maxKey, range.second);
+            }
+        }
+    }
+
+    const unsigned int numKept = static_cast<unsigned int>(std::count(keep.begin(), keep.end(), true));
+    const unsigned int numRemoved = numKeys - numKept;
+    if (numRemoved == 0) {
+        return 0;
+    }
+    KeyType *kept = new KeyType[numKept];
+    for (unsigned int i = 0, n = 0; i < numKeys; ++i) {
+        if (keep[i]) {
+            kept[n++] = keys[i];
+        }
+    }
+    delete[] keys;
+    keys = kept;
+    numKeys = numKept;
+    return numRemoved;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+OptimizeAnimationsProcess::OptimizeAnimationsProcess() :
+        mPositionTolerance(AI_OA_DEFAULT_POSITION_TOLERANCE),
+        mRotationTolerance(static_cast<ai_real>(AI_DEG_TO_RAD(AI_OA_DEFAULT_ROTATION_TOLERANCE))),
+        mScalingTolerance(AI_OA_DEFAULT_SCALING_TOLERANCE) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool OptimizeAnimationsProcess::IsActive(unsigned int /*pFlags*/) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool OptimizeAnimationsProcess::IsExtraActive(unsigned int pExtraFlags) const {
+    return 0 != (pExtraFlags & aiProcessExtra_OptimizeAnimations);
+}
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeAnimationsProcess::SetupProperties(const Importer *pImp) {
+    mPositionTolerance = std::max(pImp->GetPropertyFloat(AI_CONFIG_PP_OA_POSITION_TOLERANCE, AI_OA_DEFAULT_POSITION_TOLERANCE), ai_real(0.0));
+    mRotationTolerance = std::max(static_cast<ai_real>(AI_DEG_TO_RAD(
+            pImp->GetPropertyFloat(AI_CONFIG_PP_OA_ROTATION_TOLERANCE, AI_OA_DEFAULT_ROTATION_TOLERANCE))), ai_real(0.0));
+    mScalingTolerance = std::max(pImp->GetPropertyFloat(AI_CONFIG_PP_OA_SCALING_TOLERANCE, AI_OA_DEFAULT_SCALING_TOLERANCE), ai_real(0.0));
+}
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeAnimationsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("OptimizeAnimationsProcess begin");
+
+    unsigned int numKeys = 0, numRemovedKeys = 0, numRemovedChannels = 0;
+    for (unsigned int a = 0; a < pScene->mNumAnimations; ++a) {
+        aiAnimation *anim = pScene->mAnimations[a];
+        unsigned int numChannels = 0;
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            aiNodeAnim *channel = anim->mChannels[c];
+            numKeys += channel->mNumPositionKeys + channel->mNumRotationKeys + channel->mNumScalingKeys;
+            numRemovedKeys += ProcessChannel(channel);
+
+            // keep at least one channel, an animation without channels is invalid
+            const bool last = numChannels == 0 && c + 1 == anim->mNumChannels && anim->mNumMorphMeshChannels == 0;
+            const aiNode *node = pScene->mRootNode ? pScene->mRootNode->FindNode(channel->mNodeName) : nullptr;
+            if (!last && node && IsRedundant(channel, node)) {
+                numRemovedKeys += channel->mNumPositionKeys + channel->mNumRotationKeys + channel->mNumScalingKeys;
+                ++numRemovedChannels;
+                delete channel;
+                continue;
+            }
+            anim->mChannels[numChannels++] = channel;
+        }
+        anim->mNumChannels = numChannels;
+    }
+
+    if (numRemovedKeys == 0) {
+        ASSIMP_LOG_DEBUG("OptimizeAnimationsProcess finished, no redundant keys found");
+        return;
+    }
+    ASSIMP_LOG_INFO("OptimizeAnimationsProcess finished. Removed ", numRemovedKeys, " of ", numKeys,
+            " animation keys and ", numRemovedChannels, " channels");
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int OptimizeAnimationsProcess::ProcessChannel(aiNodeAnim *pChannel) const {
+    return ReduceTrack(pChannel->mPositionKeys, pChannel->mNumPositionKeys, mPositionTolerance) +
+           ReduceTrack(pChannel->mRotationKeys, pChannel->mNumRotationKeys, mRotationTolerance) +
+           ReduceTrack(pChannel->mScalingKeys, pChannel->mNumScalingKeys, mScalingTolerance);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool OptimizeAnimationsProcess::IsRedundant(const aiNodeAnim *pChannel, const aiNode *pNode) const {
+    if (pChannel->mNumPositionKeys > 1 || pChannel->mNumRotationKeys > 1 || pChannel->mNumScalingKeys > 1) {
+        return false;
+    }
+
+    aiVector3D scaling, position;
+    aiQuaternion rotation;
+    pNode->mTransformation.Decompose(scaling, rotation, position);
+
+    if (pChannel->mNumPositionKeys && (pChannel->mPositionKeys[0].mValue - position).Length() > mPositionTolerance) {
+        return false;
+    }
+    if (pChannel->mNumRotationKeys && Angle(pChannel->mRotationKeys[0].mValue, rotation) > mRotationTolerance) {
+        return false;
+    }
+    if (pChannel->mNumScalingKeys && (pChannel->mScalingKeys[0].mValue - scaling).Length() > mScalingTolerance) {
+        return false;
+    }
+    return true;
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS
@@ -0,0 +1,125 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file Defines a post-processing step to remove redundant animation keys.
+ */
+
+#pragma once
+
+#ifndef AI_OPTIMIZEANIMATIONSPROCESS_H_INC
+#define AI_OPTIMIZEANIMATIONSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+struct aiAnimation;
+struct aiNode;
+struct aiNodeAnim;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing process to reduce the number of keys of node
+ *        animation channels.
+ *
+ * Keys which are reproduced by linear (positions, scalings) or spherical
+ * linear (rotations) interpolation of the remaining keys within the
+ * configured tolerances are removed, using a Ramer-Douglas-Peucker style
+ * subdivision. The error is measured at the time of each original key.
+ * Tracks using step interpolation only lose keys repeating the previous
+ * value, tracks with mixed or cubic interpolation are left untouched.
+ *
+ * Constant tracks are reduced to a single key. Channels in which all tracks
+ * are constant and equal to the transformation of the animated node are
+ * removed, unless the animation would be left without any channel.
+ */
+class ASSIMP_API OptimizeAnimationsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    OptimizeAnimationsProcess();
+    ~OptimizeAnimationsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns false, this step is selected via the extra flags.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Will return true, if aiProcessExtra_OptimizeAnimations is defined.
+    bool IsExtraActive(unsigned int pExtraFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Reads the error tolerances.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /** @brief Removes the redundant keys of a single channel.
+     *  @param pChannel The channel to optimize.
+     *  @return The number of removed keys.
+     */
+    unsigned int ProcessChannel(aiNodeAnim *pChannel) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Checks whether a channel holds the node transformation.
+     *  @param pChannel A channel with at most one key per track.
+     *  @param pNode The animated node.
+     *  @return true if the channel can be dropped.
+     */
+    bool IsRedundant(const aiNodeAnim *pChannel, const aiNode *pNode) const;
+
+private:
+    ai_real mPositionTolerance;
+    ai_real mRotationTolerance; // radians
+    ai_real mScalingTolerance;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_OPTIMIZEANIMATIONS_PROCESS
+
+#endif // AI_OPTIMIZEANIMATIONSPROCESS_H_INC
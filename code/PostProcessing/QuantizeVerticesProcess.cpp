@@ -0,0 +1,178 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to generate quantized vertex data.
+ */
+
+#ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+
+#include "PostProcessing/QuantizeVerticesProcess.h"
+#include "Common/VertexQuantization.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+
+namespace Assimp {
+
+using namespace Quantization;
+
+// ------------------------------------------------------------------------------------------------
+bool QuantizeVerticesProcess::IsActive(unsigned int /*pFlags*/) const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool QuantizeVerticesProcess::IsExtraActive(unsigned int pExtraFlags) const {
+    return 0 != (pExtraFlags & aiProcessExtra_QuantizeVertices);
+}
+
+// ------------------------------------------------------------------------------------------------
+void QuantizeVerticesProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("QuantizeVerticesProcess begin");
+
+    unsigned int numMeshes = 0;
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        aiMesh *mesh = pScene->mMeshes[i];
+        if (nullptr != mesh && ProcessMesh(mesh)) {
+            ++numMeshes;
+        }
+    }
+
+    ASSIMP_LOG_INFO("QuantizeVerticesProcess finished. Quantized the vertices of ", numMeshes, " meshes");
+}
+
+// ------------------------------------------------------------------------------------------------
+bool QuantizeVerticesProcess::ProcessMesh(aiMesh *pMesh) const {
+    ai_assert(nullptr != pMesh);
+
+    delete pMesh->mQuantizedVertices;
+    pMesh->mQuantizedVertices = nullptr;
+    if (!pMesh->HasPositions() || 0 == pMesh->mNumVertices) {
+        return false;
+    }
+
+    const unsigned int numVertices = pMesh->mNumVertices;
+    aiQuantizedVertices *out = pMesh->mQuantizedVertices = new aiQuantizedVertices();
+    out->mNumVertices = numVertices;
+    out->mSourceHash = HashSourceAttributes(*pMesh);
+
+    // positions, the scale is uniform so normals stay valid under the dequantization transform
+    aiVector3D min = pMesh->mVertices[0], max = min;
+    for (unsigned int i = 1; i < numVertices; ++i) {
+        const aiVector3D &p = pMesh->mVertices[i];
+        min.x = std::min(min.x, p.x);
+        min.y = std::min(min.y, p.y);
+        min.z = std::min(min.z, p.z);
+        max.x = std::max(max.x, p.x);
+        max.y = std::max(max.y, p.y);
+        max.z = std::max(max.z, p.z);
+    }
+    const ai_real extent = std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+    out->mPositionOffset = min;
+    out->mPositionScale = extent > 0.0 ? extent / 65535 : 1;
+
+    const ai_real invScale = 1 / out->mPositionScale;
+    out->mPositions = new unsigned short[numVertices * 4];
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        const aiVector3D p = (pMesh->mVertices[i] - min) * invScale;
+        unsigned short *q = out->mPositions + i * 4;
+        q[0] = static_cast<unsigned short>(std::min(p.x + (ai_real)0.5, (ai_real)65535));
+        q[1] = static_cast<unsigned short>(std::min(p.y + (ai_real)0.5, (ai_real)65535));
+        q[2] = static_cast<unsigned short>(std::min(p.z + (ai_real)0.5, (ai_real)65535));
+        q[3] = 0;
+    }
+
+    if (pMesh->HasNormals()) {
+        out->mNormals = new short[numVertices * 2];
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            float u, v;
+            EncodeOctahedron(pMesh->mNormals[i], u, v);
+            out->mNormals[i * 2] = static_cast<short>(EncodeSNorm(u, 16));
+            out->mNormals[i * 2 + 1] = static_cast<short>(EncodeSNorm(v, 16));
+        }
+    }
+
+    if (pMesh->HasNormals() && pMesh->HasTangentsAndBitangents()) {
+        out->mTangents = new short[numVertices * 4];
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            float u, v;
+            EncodeOctahedron(pMesh->mTangents[i], u, v);
+            const ai_real handedness = (pMesh->mNormals[i] ^ pMesh->mTangents[i]) * pMesh->mBitangents[i];
+            out->mTangents[i * 4] = static_cast<short>(EncodeSNorm(u, 16));
+            out->mTangents[i * 4 + 1] = static_cast<short>(EncodeSNorm(v, 16));
+            out->mTangents[i * 4 + 2] = handedness < 0.0 ? -32767 : 32767;
+            out->mTangents[i * 4 + 3] = 0;
+        }
+    }
+
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+        if (!pMesh->HasTextureCoords(c) || pMesh->mNumUVComponents[c] > 2) {
+            continue;
+        }
+        unsigned short *uvs = out->mTextureCoords[c] = new unsigned short[numVertices * 2];
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            uvs[i * 2] = EncodeHalf(static_cast<float>(pMesh->mTextureCoords[c][i].x));
+            uvs[i * 2 + 1] = EncodeHalf(static_cast<float>(pMesh->mTextureCoords[c][i].y));
+        }
+    }
+
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        if (!pMesh->HasVertexColors(c)) {
+            continue;
+        }
+        unsigned char *colors = out->mColors[c] = new unsigned char[numVertices * 4];
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            const aiColor4D &color = pMesh->mColors[c][i];
+            colors[i * 4] = static_cast<unsigned char>(EncodeUNorm(color.r, 8));
+            colors[i * 4 + 1] = static_cast<unsigned char>(EncodeUNorm(color.g, 8));
+            colors[i * 4 + 2] = static_cast<unsigned char>(EncodeUNorm(color.b, 8));
+            colors[i * 4 + 3] = static_cast<unsigned char>(EncodeUNorm(color.a, 8));
+        }
+    }
+    return true;
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
@@ -0,0 +1,100 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+
+/** @file Defines a post-processing step to generate quantized vertex data.
+ */
+
+#pragma once
+
+#ifndef AI_QUANTIZEVERTICESPROCESS_H_INC
+#define AI_QUANTIZEVERTICESPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+
+#include "Common/BaseProcess.h"
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing process to store a compact, GPU-ready copy of the
+ *        vertex attributes of each mesh in aiMesh::mQuantizedVertices.
+ *
+ * Positions are stored as 16 bit integers relative to the bounding box,
+ * normals and tangents are octahedron-encoded, texture coordinates are
+ * stored as half floats and colors as 8 bit unsigned normalized integers.
+ * The float vertex arrays are left untouched.
+ */
+class ASSIMP_API QuantizeVerticesProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    QuantizeVerticesProcess() = default;
+    ~QuantizeVerticesProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns false, this step is selected via the extra flags.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Will return true, if aiProcessExtra_QuantizeVertices is defined.
+    bool IsExtraActive(unsigned int pExtraFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /** @brief Quantizes the vertices of a single mesh.
+     *  @param pMesh The mesh to process, replaces existing quantized data.
+     *  @return true if the mesh has vertices to quantize. */
+    bool ProcessMesh(aiMesh *pMesh) const;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_QUANTIZEVERTICES_PROCESS
+
+#endif // AI_QUANTIZEVERTICESPROCESS_H_INC
@@ -0,0 +1,201 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file AnimSampler.h
+ *  Declares AnimSampler, a helper to evaluate the node animation channels
+ *  of an aiAnimation at arbitrary points in time.
+ */
+
+#pragma once
+#ifndef AI_ANIMSAMPLER_H_INC
+#define AI_ANIMSAMPLER_H_INC
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/anim.h>
+#include <assimp/matrix4x4.h>
+#include <vector>
+
+struct aiNode;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * Evaluates all node channels of an animation into a pose buffer holding
+ * one position, rotation and scaling per channel.
+ *
+ * Each track keeps a cursor to the key used last, so steadily advancing
+ * playback only steps forward over a few keys. Larger jumps and backward
+ * seeks fall back to a binary search. The interpolation of all channels is
+ * done in batches over flat arrays, which the compiler can vectorize.
+ *
+ * If the root of the node hierarchy is given, the sampler also composes the
+ * global transformation of every node. Nodes without a channel keep their
+ * default transformation.
+ *
+ * Step keys hold their value, all other keys are interpolated linearly
+ * (positions, scalings) or spherically (rotations). Outside of the key range
+ * of a track, aiAnimBehaviour_REPEAT wraps the time into the key range and
+ * aiAnimBehaviour_LINEAR extrapolates positions and scalings. All other
+ * behaviours hold the first or last key, since most importers leave the
+ * behaviour at aiAnimBehaviour_DEFAULT. Tracks without keys take the value
+ * from the node transformation, if the node is known.
+ */
+class ASSIMP_API AnimSampler {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Constructs a sampler for an animation.
+     *  @param pAnim The animation to sample. It is not copied, so it must
+     *    stay valid as long as the sampler is used.
+     *  @param pRoot Optional root node of the hierarchy the animation
+     *    applies to, usually aiScene::mRootNode.
+     */
+    explicit AnimSampler(const aiAnimation *pAnim, const aiNode *pRoot = nullptr);
+
+    // -------------------------------------------------------------------
+    /** @brief Converts a time in seconds to animation ticks.
+     *  @param pSeconds The time in seconds.
+     *  @param pLoop Wrap the time into the duration of the animation if
+     *    true, clamp it otherwise.
+     *  @return The time in ticks. 25 ticks per second are assumed if the
+     *    animation does not specify a rate.
+     */
+    double GetTicks(double pSeconds, bool pLoop = true) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Evaluates all channels of the animation.
+     *  @param pTicks The time in ticks.
+     */
+    void Sample(double pTicks);
+
+    // -------------------------------------------------------------------
+    /** @brief Resets the cached key cursors. */
+    void Reset();
+
+    // -------------------------------------------------------------------
+    /** @brief Composes the global transformations of all nodes from the
+     *    last sampled pose. Does nothing if no root node was given.
+     */
+    void ComputeGlobalTransforms();
+
+    // -------------------------------------------------------------------
+    /** @brief Computes the local transformation of each channel.
+     *  @param pOut Receives GetNumChannels() matrices.
+     */
+    void GetLocalTransforms(aiMatrix4x4 *pOut) const;
+
+    /// @brief Returns the number of channels.
+    unsigned int GetNumChannels() const { return static_cast<unsigned int>(mPositions.size()); }
+
+    /// @brief Returns the sampled positions, one per channel.
+    const aiVector3D *GetPositions() const { return mPositions.data(); }
+
+    /// @brief Returns the sampled rotations, one per channel.
+    const aiQuaternion *GetRotations() const { return mRotations.data(); }
+
+    /// @brief Returns the sampled scalings, one per channel.
+    const aiVector3D *GetScalings() const { return mScalings.data(); }
+
+    /// @brief Returns the number of nodes in the hierarchy.
+    unsigned int GetNumNodes() const { return static_cast<unsigned int>(mNodes.size()); }
+
+    /// @brief Returns a node, nodes are stored parents first.
+    const aiNode *GetNode(unsigned int pIndex) const { return mNodes[pIndex]; }
+
+    /// @brief Returns the index of a node by name, or -1.
+    int FindNode(const char *pName) const;
+
+    /// @brief Returns the node index of a channel, or -1 if the node is unknown.
+    int GetChannelNode(unsigned int pChannel) const { return mChannelNodes[pChannel]; }
+
+    /// @brief Returns the global transformations computed by ComputeGlobalTransforms().
+    const aiMatrix4x4 *GetGlobalTransforms() const { return mGlobalTransforms.data(); }
+
+    // -------------------------------------------------------------------
+    /** @brief Interpolates linearly between two arrays of vectors.
+     *
+     *  pOut[i] = pA[i] + (pB[i] - pA[i]) * pFactors[i]
+     */
+    static void Lerp(const aiVector3D *pA, const aiVector3D *pB, const ai_real *pFactors,
+            aiVector3D *pOut, size_t pNum);
+
+    // -------------------------------------------------------------------
+    /** @brief Interpolates spherically between two arrays of rotations,
+     *    with the same result as aiQuaternion::Interpolate.
+     */
+    static void Slerp(const aiQuaternion *pA, const aiQuaternion *pB, const ai_real *pFactors,
+            aiQuaternion *pOut, size_t pNum);
+
+private:
+    const aiAnimation *mAnim;
+
+    /** the last key used per channel and track (position, rotation, scaling) */
+    std::vector<unsigned int> mCursors;
+
+    /** the pose, one entry per channel */
+    std::vector<aiVector3D> mPositions;
+    std::vector<aiQuaternion> mRotations;
+    std::vector<aiVector3D> mScalings;
+
+    /** interpolation input gathered per channel */
+    std::vector<aiVector3D> mPositionsA, mPositionsB, mScalingsA, mScalingsB;
+    std::vector<aiQuaternion> mRotationsA, mRotationsB;
+    std::vector<ai_real> mPositionFactors, mRotationFactors, mScalingFactors;
+
+    /** the values used for tracks without keys */
+    std::vector<aiVector3D> mDefaultPositions, mDefaultScalings;
+    std::vector<aiQuaternion> mDefaultRotations;
+
+    /** the flattened node hierarchy */
+    std::vector<const aiNode *> mNodes;
+    std::vector<int> mParents;
+    std::vector<int> mNodeChannels;
+    std::vector<int> mChannelNodes;
+    std::vector<aiMatrix4x4> mGlobalTransforms;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_ANIMSAMPLER_H_INC
@@ -54,16 +54,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "LogStream.hpp"
 #include "Logger.hpp"
 #include "NullLogger.hpp"
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-#include <mutex>
 #include <thread>
 #endif
 
 namespace Assimp {
 // ------------------------------------------------------------------------------------
 class IOStream;
+class AsyncLogQueue;
 struct LogStreamInfo;
 
 /** default name of log-file */
@@ -81,6 +83,10 @@ struct LogStreamInfo;
  *
  *  If you wish to customize the logging at an even deeper level supply your own
  *  implementation of #Logger to #set().
+ *
+ *  Importers may log from several threads at once. #setAsynchronous() moves the
+ *  stream output to a background thread, so logging threads only append to a
+ *  buffer of their own.
  *  @note The whole logging stuff causes a small extra overhead for all imports. */
 class ASSIMP_API DefaultLogger : public Logger {
 public:
@@ -140,6 +146,28 @@ public:
     /** @copydoc Logger::detachStream */
     bool detachStream(LogStream *pStream, unsigned int severity) override;
 
+    // ----------------------------------------------------------------------
+    /** @copydoc Logger::isEnabled */
+    bool isEnabled(ErrorSeverity severity, LogSeverity granularity = NORMAL) const override;
+
+    // ----------------------------------------------------------------------
+    /** @brief  Switches between synchronous and asynchronous output.
+     *
+     *  In asynchronous mode messages are formatted on the logging thread,
+     *  queued in a per-thread buffer and written to the streams by a
+     *  background thread. Messages of one thread keep their order. Pending
+     *  messages are written before streams are attached or detached, on
+     *  #flush() and when the logger is destroyed.
+     *  Must not be called while other threads are logging.
+     *  @param  enable  true to write asynchronously.
+     *  @return true if the requested mode is active, false if no background
+     *    thread could be started. */
+    bool setAsynchronous(bool enable);
+
+    // ----------------------------------------------------------------------
+    /** @brief  Writes all pending messages of the asynchronous mode. */
+    void flush();
+
 private:
     // ----------------------------------------------------------------------
     /** @briefPrivate construction for internal use by create().
@@ -165,14 +193,23 @@ private:
     /** @brief  Logs an error message */
     void OnError(const char *message) override;
 
+    // ----------------------------------------------------------------------
+    /** @brief Queues a message in asynchronous mode, writes it otherwise */
+    void Dispatch(const char *message, ErrorSeverity ErrorSev);
+
     // ----------------------------------------------------------------------
     /** @brief Writes a message to all streams */
     void WriteToStreams(const char *message, ErrorSeverity ErrorSev);
 
     // ----------------------------------------------------------------------
-    /** @brief Returns the thread id.
-     *  @note This is an OS specific feature, if not supported, a
-     *    zero will be returned.
+    /** @brief Recomputes the message kinds any stream is interested in,
+     *  must be called with m_arrayMutex locked */
+    void UpdateEnabledSeverities();
+
+    // ----------------------------------------------------------------------
+    /** @brief Returns the id of the calling thread.
+     *  @note This is an OS specific feature, the id of the native thread
+     *    on Windows and Linux, a hash of the std::thread id elsewhere.
      */
     unsigned int GetThreadID();
 
@@ -189,9 +226,15 @@ private:
     //! Attached streams
     StreamArray m_StreamArray;
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // importers may log from worker threads, so the streams and the repeat
+    // buffer are always guarded
     std::mutex m_arrayMutex;
-#endif
+
+    //! The ErrorSeverity flags of all attached streams
+    std::atomic<unsigned int> m_enabledSeverities;
+
+    //! The message queue of the asynchronous mode, nullptr otherwise
+    AsyncLogQueue *m_pQueue;
 
     bool noRepeatMsg;
     char lastMsg[MAX_LOG_MESSAGE_LENGTH * 2];
@@ -116,6 +116,15 @@ public:
     /// @return true if successful.
     bool getNextBlock(std::vector<T> &buffer);
 
+    /// @brief  Will read the next lines as one chunk of text.
+    ///
+    /// Empty lines are skipped. The line ends are kept and the chunk is always terminated
+    /// with a line end, so the chunk can be split and parsed without further copies.
+    /// @param  buffer      The buffer for the lines.
+    /// @param  numLines    The number of lines to read.
+    /// @return The number of lines read, less than numLines at the end of the stream.
+    size_t getNextLines(std::vector<T> &buffer, size_t numLines);
+
 private:
     IOStream *m_stream;
     size_t m_filesize;
@@ -345,6 +354,49 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextBlock(std::vector<T> &buffer) {
     return true;
 }
 
+template <class T>
+AI_FORCE_INLINE size_t IOStreamBuffer<T>::getNextLines(std::vector<T> &buffer, size_t numLines) {
+    buffer.clear();
+    size_t numRead = 0;
+    bool inLine = false;
+    while (numRead < numLines) {
+        if (m_cachePos >= m_cacheSize || 0 == m_filePos) {
+            if (!readNextBlock()) {
+                break;
+            }
+        }
+
+        size_t pos = m_cachePos;
+        for (; pos < m_cacheSize; ++pos) {
+            if (!IsLineEnd(m_cache[pos])) {
+                inLine = true;
+            } else if (inLine) {
+                inLine = false;
+                if (++numRead == numLines) {
+                    break;
+                }
+            }
+        }
+        buffer.insert(buffer.end(), m_cache.begin() + m_cachePos, m_cache.begin() + pos);
+        m_cachePos = pos;
+    }
+    if (inLine) {
+        // the last line is not terminated
+        ++numRead;
+    }
+    buffer.push_back('\n');
+
+    // move behind the line end, like getNextLine does
+    while (0 != numRead && (m_cachePos < m_cacheSize || readNextBlock())) {
+        if (!IsLineEnd(m_cache[m_cachePos])) {
+            break;
+        }
+        ++m_cachePos;
+    }
+
+    return numRead;
+}
+
 } // namespace Assimp
 
 #endif // AI_IOSTREAMBUFFER_H_INC
@@ -103,7 +103,9 @@ public:
 
     template<typename... T>
     void debug(T&&... args) {
-        debug(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Debugging, DEBUGGING)) {
+            debug(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -113,7 +115,9 @@ public:
 
     template<typename... T>
     void verboseDebug(T&&... args) {
-        verboseDebug(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Debugging, VERBOSE)) {
+            verboseDebug(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -123,7 +127,9 @@ public:
 
     template<typename... T>
     void info(T&&... args) {
-        info(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Info)) {
+            info(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -133,7 +139,9 @@ public:
 
     template<typename... T>
     void warn(T&&... args) {
-        warn(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Warn)) {
+            warn(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -143,7 +151,9 @@ public:
 
     template<typename... T>
     void error(T&&... args) {
-        error(formatMessage(std::forward<T>(args)...).c_str());
+        if (isEnabled(Err)) {
+            error(formatMessage(std::forward<T>(args)...).c_str());
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -242,6 +252,20 @@ protected:
      *    the function is left.
      */
     virtual void OnError(const char* message) = 0;
+
+public:
+    // ----------------------------------------------------------------------
+    /** @brief  Returns whether a message would be written at all.
+     *
+     *  The formatting overloads use this to skip building messages which
+     *  would be discarded anyway. Declared behind the other virtual
+     *  functions to keep their vtable slots.
+     *  @param  severity  The kind of message.
+     *  @param  granularity  The log severity the message requires, DEBUGGING
+     *    for debug messages and VERBOSE for verbose debug messages.
+     *  @return false if the message would be discarded.*/
+    virtual bool isEnabled(ErrorSeverity severity, LogSeverity granularity = NORMAL) const;
+
 protected:
     std::string formatMessage(Assimp::Formatter::format f) {
         return f;
@@ -271,6 +295,11 @@ inline Logger::Logger(LogSeverity severity) :
     // empty
 }
 
+// ----------------------------------------------------------------------------------
+inline bool Logger::isEnabled(ErrorSeverity, LogSeverity) const {
+    return true;
+}
+
 // ----------------------------------------------------------------------------------
 inline void Logger::setLogSeverity(LogSeverity log_severity){
     m_Severity = log_severity;
@@ -90,6 +90,12 @@ public:
         (void)message; //this avoids compiler warnings
     }
 
+    /** @brief  Rejects all messages, so they are not even formatted */
+    bool isEnabled(ErrorSeverity severity, LogSeverity granularity = NORMAL) const {
+        (void)severity; (void)granularity; //this avoids compiler warnings
+        return false;
+    }
+
     /** @brief  Detach a still attached stream from logger */
     bool attachStream(LogStream *pStream, unsigned int severity) {
         (void)pStream; (void)severity; //this avoids compiler warnings
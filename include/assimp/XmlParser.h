@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_IRRXML_WRAPPER
 
 #include <assimp/ai_assert.h>
+#include <assimp/ParsingUtils.h>
 #include <assimp/StringUtils.h>
 #include <assimp/DefaultLogger.hpp>
 
@@ -50,7 +51,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "IOStream.hpp"
 
 #include <pugixml.hpp>
+#include <algorithm>
+#include <cstring>
 #include <istream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -129,6 +133,12 @@ public:
     /// @return true, if the parsing was successful, false if not.
     bool parse(IOStream *stream);
 
+    /// @brief  Will parse an xml-file from a stream which is read until its end,
+    ///         for streams which cannot tell their size cheaply.
+    /// @param[in] stream      The input stream.
+    /// @return true, if the parsing was successful, false if not.
+    bool parseUntilEnd(IOStream *stream);
+
     /// @brief  Will parse an xml-file from a stringstream.
     /// @param[in] str      The input istream (note: not "const" to match pugixml param)
     /// @return true, if the parsing was successful, false if not.
@@ -242,6 +252,8 @@ public:
     static inline bool getValueAsBool(XmlNode &node, bool &v);
 
 private:
+    bool parseData();
+
     pugi::xml_document *mDoc;
     TNodeType mCurrent;
     std::vector<char> mData;
@@ -314,10 +326,42 @@ bool TXmlParser<TNodeType>::parse(IOStream *stream) {
     memset(&mData[0], '\0', len + 1);
     stream->Read(&mData[0], 1, len);
 
+    return parseData();
+}
+
+template <class TNodeType>
+bool TXmlParser<TNodeType>::parseUntilEnd(IOStream *stream) {
+    if (hasRoot()) {
+        clear();
+    }
+
+    if (nullptr == stream) {
+        ASSIMP_LOG_DEBUG("Stream is nullptr.");
+        return false;
+    }
+
+    size_t len = 0;
+    mData.resize(64 * 1024);
+    for (;;) {
+        len += stream->Read(&mData[len], 1, mData.size() - len);
+        if (len < mData.size()) {
+            break;
+        }
+        mData.resize(mData.size() * 2);
+    }
+    mData.resize(len + 1);
+    mData[len] = '\0';
+
+    return parseData();
+}
+
+template <class TNodeType>
+bool TXmlParser<TNodeType>::parseData() {
     mDoc = new pugi::xml_document();
-    // load_string assumes native encoding (aka always utf-8 per build options)
-    //pugi::xml_parse_result parse_result = mDoc->load_string(&mData[0], pugi::parse_full);
-    pugi::xml_parse_result parse_result = mDoc->load_buffer(&mData[0], mData.size(), pugi::parse_full);
+    // Parse in place: mData outlives mDoc, so pugixml does not need a private copy of the
+    // buffer. Comments, declarations, doctypes and processing instructions are not used
+    // by any importer, so the default flags are enough.
+    pugi::xml_parse_result parse_result = mDoc->load_buffer_inplace(&mData[0], mData.size(), pugi::parse_default);
     if (parse_result.status == pugi::status_ok) {
         return true;
     }
@@ -617,6 +661,521 @@ private:
     size_t mIndex;
 };
 
+///	@brief  A forward-only pull parser for large xml sections.
+///
+/// The DOM parser above keeps the whole file and its node tree in memory. For bulk geometry
+/// sections this is the dominant cost, so importers can read them with this parser instead:
+/// the stream is read in blocks of a fixed size and only the current tag, its attributes and
+/// the current text run are kept. Small sections can still be turned into a DOM via
+/// readSubtree().
+///
+/// Comments, processing instructions and the document type declaration are skipped.
+/// Empty elements (<a/>) report a StartElement followed by an EndElement.
+class XmlPullParser {
+public:
+    /// @brief The parser events.
+    enum class Event {
+        StartElement,   ///< A start tag was read, name and attributes are valid.
+        EndElement,     ///< An end tag was read, the name is valid.
+        Text,           ///< Character data or a CDATA section was read.
+        EndOfDocument,  ///< The end of the stream was reached.
+        Error           ///< The document is not well-formed, see getError().
+    };
+
+    using Attribute = std::pair<std::string, std::string>;
+
+    ///	@brief  The class constructor.
+    /// @param  stream      [in] The stream to read from, must stay valid while parsing.
+    /// @param  blockSize   [in] The number of bytes to read from the stream at once.
+    explicit XmlPullParser(IOStream *stream, size_t blockSize = 64 * 1024) :
+            mStream(stream),
+            mBuffer(std::max<size_t>(blockSize, 16)),
+            mPos(0),
+            mEnd(0),
+            mEof(nullptr == stream),
+            mLastEvent(Event::EndOfDocument),
+            mPendingEnd(false) {
+        // Skip an utf-8 byte order mark
+        if (ensure(3) && 0 == memcmp(&mBuffer[mPos], "\xEF\xBB\xBF", 3)) {
+            mPos += 3;
+        }
+    }
+
+    ///	@brief  The class destructor, default implementation.
+    ~XmlPullParser() = default;
+
+    ///	@brief  Will read the next event.
+    /// @return The event.
+    Event next() {
+        mLastEvent = readNext();
+        return mLastEvent;
+    }
+
+    ///	@brief  Will return the last event returned by next().
+    Event getEvent() const {
+        return mLastEvent;
+    }
+
+    ///	@brief  Will return the tag name of the last StartElement or EndElement.
+    const std::string &getName() const {
+        return mName;
+    }
+
+    ///	@brief  Will return the decoded character data of the last Text event.
+    const std::string &getText() const {
+        return mText;
+    }
+
+    ///	@brief  Will return the attributes of the last StartElement.
+    const std::vector<Attribute> &getAttributes() const {
+        return mAttributes;
+    }
+
+    ///	@brief  Will look up an attribute of the last StartElement.
+    /// @param  name    [in] The attribute name.
+    /// @return The decoded value or nullptr if there is no such attribute.
+    const char *getAttribute(const char *name) const {
+        for (const Attribute &attribute : mAttributes) {
+            if (attribute.first == name) {
+                return attribute.second.c_str();
+            }
+        }
+        return nullptr;
+    }
+
+    ///	@brief  Will return the number of open elements, the current one included.
+    size_t getDepth() const {
+        return mStack.size();
+    }
+
+    ///	@brief  Will return the description of the last error.
+    const std::string &getError() const {
+        return mError;
+    }
+
+    ///	@brief  Will read the element of the last StartElement with all its children into a DOM.
+    /// @param  parent  [in] The node to append the element to.
+    /// @return true, if the element was read, false in case of an error.
+    bool readSubtree(XmlNode parent) {
+        if (mLastEvent != Event::StartElement) {
+            return false;
+        }
+        std::vector<XmlNode> nodes;
+        nodes.push_back(appendElement(parent));
+        while (!nodes.empty()) {
+            switch (next()) {
+            case Event::StartElement:
+                nodes.push_back(appendElement(nodes.back()));
+                break;
+            case Event::EndElement:
+                nodes.pop_back();
+                break;
+            case Event::Text:
+                nodes.back().append_child(pugi::node_pcdata).set_value(mText.c_str());
+                break;
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ///	@brief  Will skip the element of the last StartElement with all its children.
+    /// @return true, if the element was skipped, false in case of an error.
+    bool skipSubtree() {
+        if (mLastEvent != Event::StartElement) {
+            return false;
+        }
+        for (size_t open = 1; open != 0;) {
+            switch (next()) {
+            case Event::StartElement:
+                ++open;
+                break;
+            case Event::EndElement:
+                --open;
+                break;
+            case Event::Text:
+                break;
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    Event readNext() {
+        if (mLastEvent == Event::Error) {
+            return Event::Error;
+        }
+        if (mPendingEnd) {
+            mPendingEnd = false;
+            mStack.pop_back();
+            return Event::EndElement;
+        }
+
+        for (;;) {
+            if (!ensure(1)) {
+                if (!mStack.empty()) {
+                    return fail("Unexpected end of file inside <" + mStack.back() + ">.");
+                }
+                return Event::EndOfDocument;
+            }
+
+            if (mBuffer[mPos] != '<') {
+                readText();
+                if (mStack.empty() || isWhitespaceOnly(mText)) {
+                    continue;
+                }
+                return Event::Text;
+            }
+
+            if (!ensure(2)) {
+                return fail("Unexpected end of file.");
+            }
+            const char c = mBuffer[mPos + 1];
+            if (c == '?') {
+                mPos += 2;
+                if (!skipUntil("?>")) {
+                    return fail("Unterminated processing instruction.");
+                }
+            } else if (c == '!') {
+                if (startsWith("<!--")) {
+                    mPos += 4;
+                    if (!skipUntil("-->")) {
+                        return fail("Unterminated comment.");
+                    }
+                } else if (startsWith("<![CDATA[")) {
+                    mPos += 9;
+                    mText.clear();
+                    if (!readUntil("]]>", mText)) {
+                        return fail("Unterminated CDATA section.");
+                    }
+                    normalizeNewlines(mText);
+                    return Event::Text;
+                } else if (!skipDeclaration()) {
+                    return fail("Unterminated declaration.");
+                }
+            } else if (c == '/') {
+                return readEndTag();
+            } else {
+                return readStartTag();
+            }
+        }
+    }
+
+    Event readStartTag() {
+        ++mPos;
+        mName.clear();
+        mAttributes.clear();
+        if (!readName(mName) || mName.empty()) {
+            return fail("Invalid start tag.");
+        }
+        for (;;) {
+            skipWhitespace();
+            if (!ensure(1)) {
+                return fail("Unexpected end of file in <" + mName + ">.");
+            }
+            const char c = mBuffer[mPos];
+            if (c == '>') {
+                ++mPos;
+                break;
+            }
+            if (c == '/') {
+                if (!ensure(2) || mBuffer[mPos + 1] != '>') {
+                    return fail("Invalid empty element <" + mName + ">.");
+                }
+                mPos += 2;
+                mPendingEnd = true;
+                break;
+            }
+
+            Attribute attribute;
+            if (!readName(attribute.first) || attribute.first.empty()) {
+                return fail("Invalid attribute in <" + mName + ">.");
+            }
+            skipWhitespace();
+            if (!ensure(1) || mBuffer[mPos] != '=') {
+                return fail("Missing value for attribute " + attribute.first + ".");
+            }
+            ++mPos;
+            skipWhitespace();
+            if (!ensure(1) || (mBuffer[mPos] != '"' && mBuffer[mPos] != '\'')) {
+                return fail("Missing quote for attribute " + attribute.first + ".");
+            }
+            const char quote[2] = { mBuffer[mPos], '\0' };
+            ++mPos;
+            if (!readUntil(quote, attribute.second)) {
+                return fail("Unterminated value for attribute " + attribute.first + ".");
+            }
+            normalizeAttribute(attribute.second);
+            decodeEntities(attribute.second);
+            mAttributes.push_back(std::move(attribute));
+        }
+        mStack.push_back(mName);
+        return Event::StartElement;
+    }
+
+    Event readEndTag() {
+        mPos += 2;
+        mName.clear();
+        if (!readName(mName)) {
+            return fail("Invalid end tag.");
+        }
+        skipWhitespace();
+        if (!ensure(1) || mBuffer[mPos] != '>') {
+            return fail("Invalid end tag </" + mName + ">.");
+        }
+        ++mPos;
+        if (mStack.empty() || mStack.back() != mName) {
+            return fail("Unexpected end tag </" + mName + ">.");
+        }
+        mStack.pop_back();
+        return Event::EndElement;
+    }
+
+    void readText() {
+        mText.clear();
+        while (ensure(1)) {
+            const char *begin = &mBuffer[mPos];
+            const char *end = static_cast<const char *>(memchr(begin, '<', mEnd - mPos));
+            if (nullptr != end) {
+                mText.append(begin, end);
+                mPos += end - begin;
+                break;
+            }
+            mText.append(begin, mEnd - mPos);
+            mPos = mEnd;
+        }
+        normalizeNewlines(mText);
+        decodeEntities(mText);
+    }
+
+    bool readName(std::string &name) {
+        while (ensure(1)) {
+            const char c = mBuffer[mPos];
+            if (IsSpaceOrNewLine(c) || c == '>' || c == '/' || c == '=' || c == '<') {
+                return true;
+            }
+            name.push_back(c);
+            ++mPos;
+        }
+        return false;
+    }
+
+    void skipWhitespace() {
+        while (ensure(1) && IsSpaceOrNewLine(mBuffer[mPos])) {
+            ++mPos;
+        }
+    }
+
+    bool startsWith(const char *token) {
+        const size_t len = strlen(token);
+        return ensure(len) && 0 == memcmp(&mBuffer[mPos], token, len);
+    }
+
+    bool readUntil(const char *delimiter, std::string &out) {
+        const size_t len = strlen(delimiter);
+        while (ensure(len)) {
+            if (mBuffer[mPos] == delimiter[0] && 0 == memcmp(&mBuffer[mPos], delimiter, len)) {
+                mPos += len;
+                return true;
+            }
+            out.push_back(mBuffer[mPos++]);
+        }
+        return false;
+    }
+
+    bool skipUntil(const char *delimiter) {
+        const size_t len = strlen(delimiter);
+        while (ensure(len)) {
+            if (mBuffer[mPos] == delimiter[0] && 0 == memcmp(&mBuffer[mPos], delimiter, len)) {
+                mPos += len;
+                return true;
+            }
+            ++mPos;
+        }
+        return false;
+    }
+
+    // Skips <!DOCTYPE ...> including an internal subset in brackets.
+    bool skipDeclaration() {
+        mPos += 2;
+        int nesting = 0;
+        char quote = '\0';
+        while (ensure(1)) {
+            const char c = mBuffer[mPos++];
+            if (quote != '\0') {
+                if (c == quote) {
+                    quote = '\0';
+                }
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '[') {
+                ++nesting;
+            } else if (c == ']') {
+                --nesting;
+            } else if (c == '>' && nesting <= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Makes sure at least count bytes are buffered, returns false at the end of the stream.
+    bool ensure(size_t count) {
+        if (mEnd - mPos >= count) {
+            return true;
+        }
+        if (mEof) {
+            return false;
+        }
+        if (mPos != 0) {
+            memmove(&mBuffer[0], &mBuffer[mPos], mEnd - mPos);
+            mEnd -= mPos;
+            mPos = 0;
+        }
+        while (mEnd < count && !mEof) {
+            const size_t read = mStream->Read(&mBuffer[mEnd], 1, mBuffer.size() - mEnd);
+            if (0 == read) {
+                mEof = true;
+            }
+            mEnd += read;
+        }
+        return mEnd >= count;
+    }
+
+    Event fail(const std::string &message) {
+        mError = message;
+        ASSIMP_LOG_DEBUG("Error while parse xml: ", message);
+        return Event::Error;
+    }
+
+    XmlNode appendElement(XmlNode parent) {
+        XmlNode node = parent.append_child(mName.c_str());
+        for (const Attribute &attribute : mAttributes) {
+            node.append_attribute(attribute.first.c_str()).set_value(attribute.second.c_str());
+        }
+        return node;
+    }
+
+    static bool isWhitespaceOnly(const std::string &text) {
+        for (const char c : text) {
+            if (!IsSpaceOrNewLine(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void normalizeNewlines(std::string &text) {
+        if (text.find('\r') == std::string::npos) {
+            return;
+        }
+        size_t out = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (text[i] == '\r') {
+                text[out++] = '\n';
+                if (i + 1 < text.size() && text[i + 1] == '\n') {
+                    ++i;
+                }
+            } else {
+                text[out++] = text[i];
+            }
+        }
+        text.resize(out);
+    }
+
+    static void normalizeAttribute(std::string &value) {
+        normalizeNewlines(value);
+        for (char &c : value) {
+            if (c == '\t' || c == '\n') {
+                c = ' ';
+            }
+        }
+    }
+
+    static void appendUtf8(std::string &out, unsigned long cp) {
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    // Replaces the predefined entities and character references, unknown ones are kept.
+    static void decodeEntities(std::string &text) {
+        size_t amp = text.find('&');
+        if (amp == std::string::npos) {
+            return;
+        }
+        std::string out(text, 0, amp);
+        while (amp != std::string::npos) {
+            const size_t semicolon = text.find(';', amp);
+            size_t next = amp + 1;
+            if (semicolon != std::string::npos) {
+                const std::string entity = text.substr(amp + 1, semicolon - amp - 1);
+                bool known = true;
+                if (entity == "lt") {
+                    out.push_back('<');
+                } else if (entity == "gt") {
+                    out.push_back('>');
+                } else if (entity == "amp") {
+                    out.push_back('&');
+                } else if (entity == "quot") {
+                    out.push_back('"');
+                } else if (entity == "apos") {
+                    out.push_back('\'');
+                } else if (entity.size() > 1 && entity[0] == '#') {
+                    const bool hex = entity[1] == 'x';
+                    char *end = nullptr;
+                    const char *digits = entity.c_str() + (hex ? 2 : 1);
+                    const unsigned long cp = strtoul(digits, &end, hex ? 16 : 10);
+                    known = end != digits && *end == '\0' && cp <= 0x10FFFF;
+                    if (known) {
+                        appendUtf8(out, cp);
+                    }
+                } else {
+                    known = false;
+                }
+                if (known) {
+                    next = semicolon + 1;
+                } else {
+                    out.push_back('&');
+                }
+            } else {
+                out.push_back('&');
+            }
+            amp = text.find('&', next);
+            out.append(text, next, (amp == std::string::npos ? text.size() : amp) - next);
+        }
+        text.swap(out);
+    }
+
+    IOStream *mStream;
+    std::vector<char> mBuffer;
+    size_t mPos;
+    size_t mEnd;
+    bool mEof;
+    Event mLastEvent;
+    bool mPendingEnd;
+    std::string mName;
+    std::string mText;
+    std::string mError;
+    std::vector<Attribute> mAttributes;
+    std::vector<std::string> mStack;
+};
+
 } // namespace Assimp
 
 #endif // !! INCLUDED_AI_IRRXML_WRAPPER
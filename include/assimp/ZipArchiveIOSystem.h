@@ -57,7 +57,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace Assimp {
 
-class ZipArchiveIOSystem : public IOSystem {
+class ASSIMP_API ZipArchiveIOSystem : public IOSystem {
 public:
     //! Open a Zip using the proffered IOSystem
     ZipArchiveIOSystem(IOSystem* pIOHandler, const char *pFilename, const char* pMode = "r");
@@ -80,6 +80,13 @@ public:
     //! Intended for use within Assimp library boundaries
     void getFileListExtension(std::vector<std::string>& rFileList, const std::string& extension) const;
 
+    //! Decompress the given files in parallel and keep them in memory until
+    //! they are opened, the first Open() of each file takes over its data.
+    //! The archive is only opened on the calling thread.
+    //! Open() may also be called concurrently, every stream inflates on its own
+    //! and the archive is opened by one thread at a time.
+    void prefetch(const std::vector<std::string>& rFileList);
+
     static bool isZipArchive(IOSystem* pIOHandler, const char *pFilename);
     static bool isZipArchive(IOSystem* pIOHandler, const std::string& rFilename);
 
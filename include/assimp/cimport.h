@@ -305,6 +305,17 @@ ASSIMP_API void aiAttachLogStream(
  */
 ASSIMP_API void aiEnableVerboseLogging(aiBool d);
 
+// --------------------------------------------------------------------------------
+/** Limit the number of threads the library uses for parallel loops.
+ *  Some importers, exporters and the zlib wrapper spread independent work over
+ *  all hardware threads. Applications with their own job system, or running
+ *  where threads are not available, can restrict this here.
+ *  @param count The maximum number of threads including the calling one.
+ *    1 runs all work on the calling thread, 0 (the default) uses all hardware
+ *    threads.
+ */
+ASSIMP_API void aiSetMaxWorkerThreads(unsigned int count);
+
 // --------------------------------------------------------------------------------
 /** Detach a custom log stream from the libraries' logging system.
  *
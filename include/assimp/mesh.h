@@ -616,6 +616,177 @@ enum aiMorphingMethod {
 #endif
 }; //! enum aiMorphingMethod
 
+// ---------------------------------------------------------------------------
+/** @brief A meshlet is a small cluster of triangles of a mesh.
+ *
+ * Meshlets are generated by the #aiProcessExtra_GenMeshlets step, see
+ * #aiMeshletTable for the layout of their vertex and triangle data.
+ */
+struct aiMeshlet {
+    /** Offset of the first vertex of the meshlet in aiMeshletTable::mVertices */
+    unsigned int mVertexOffset;
+
+    /** Offset of the first triangle index of the meshlet in aiMeshletTable::mTriangles */
+    unsigned int mTriangleOffset;
+
+    /** Number of vertices referenced by the meshlet */
+    unsigned int mNumVertices;
+
+    /** Number of triangles of the meshlet */
+    unsigned int mNumTriangles;
+
+    /** Center of the bounding sphere of the meshlet */
+    C_STRUCT aiVector3D mCenter;
+
+    /** Radius of the bounding sphere of the meshlet */
+    ai_real mRadius;
+
+    /** Apex of the normal cone of the meshlet */
+    C_STRUCT aiVector3D mConeApex;
+
+    /** Normalized axis of the normal cone, zero if the triangles face
+     *  too different directions for cone culling */
+    C_STRUCT aiVector3D mConeAxis;
+
+    /** Cutoff of the normal cone. The meshlet is back facing for every
+     *  camera position for which
+     *  dot(normalize(mConeApex - camera), mConeAxis) >= mConeCutoff holds.
+     *  1 if cone culling is not possible. */
+    ai_real mConeCutoff;
+
+#ifdef __cplusplus
+    aiMeshlet() AI_NO_EXCEPT
+            : mVertexOffset(0),
+              mTriangleOffset(0),
+              mNumVertices(0),
+              mNumTriangles(0),
+              mCenter(),
+              mRadius(0),
+              mConeApex(),
+              mConeAxis(),
+              mConeCutoff(1) {
+        // empty
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Partitioning of a triangle mesh into meshlets.
+ *
+ * Each meshlet references a range of mVertices, which maps meshlet-local
+ * vertex indices to indices into the vertex arrays of the mesh, and a range
+ * of mTriangles holding three meshlet-local vertex indices per triangle.
+ */
+struct aiMeshletTable {
+    /** Number of meshlets */
+    unsigned int mNumMeshlets;
+
+    /** The meshlets, mNumMeshlets in size */
+    C_STRUCT aiMeshlet *mMeshlets;
+
+    /** Size of the mVertices array */
+    unsigned int mNumVertices;
+
+    /** Indices into the vertex arrays of the mesh */
+    unsigned int *mVertices;
+
+    /** Size of the mTriangles array, three times the number of triangles */
+    unsigned int mNumTriangleIndices;
+
+    /** Meshlet-local vertex indices, three per triangle */
+    unsigned char *mTriangles;
+
+#ifdef __cplusplus
+    aiMeshletTable() AI_NO_EXCEPT
+            : mNumMeshlets(0),
+              mMeshlets(nullptr),
+              mNumVertices(0),
+              mVertices(nullptr),
+              mNumTriangleIndices(0),
+              mTriangles(nullptr) {
+        // empty
+    }
+
+    ~aiMeshletTable() {
+        delete[] mMeshlets;
+        delete[] mVertices;
+        delete[] mTriangles;
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Compact, GPU-ready copy of the vertex attributes of a mesh.
+ *
+ * Generated by the #aiProcessExtra_QuantizeVertices step, the float vertex
+ * arrays of the mesh are kept unchanged. All arrays hold mNumVertices
+ * elements, an array is nullptr if the attribute is not present.
+ */
+struct aiQuantizedVertices {
+    /** Number of vertices, equals aiMesh::mNumVertices */
+    unsigned int mNumVertices;
+
+    /** Hash of the float vertex attributes the data was generated from.
+     *  Exporters compare it against the current attributes to detect
+     *  data made stale by later changes to the mesh. */
+    unsigned int mSourceHash;
+
+    /** Positions relative to the bounding box of the mesh, four 16 bit
+     *  unsigned integers per vertex. The fourth component is padding.
+     *  The position is mPositionOffset + mPositionScale * (x, y, z). */
+    unsigned short *mPositions;
+
+    /** Minimum corner of the bounding box of the mesh */
+    C_STRUCT aiVector3D mPositionOffset;
+
+    /** Uniform scale to dequantize the positions */
+    ai_real mPositionScale;
+
+    /** Octahedron-encoded unit normals, two 16 bit signed normalized
+     *  integers per vertex */
+    short *mNormals;
+
+    /** Tangents, four 16 bit signed normalized integers per vertex: the
+     *  octahedron-encoded tangent, the sign of the bitangent
+     *  (cross(normal, tangent) * sign) and padding */
+    short *mTangents;
+
+    /** Texture coordinates as two IEEE 754 half precision floats per
+     *  vertex. Only present for channels with up to two components. */
+    unsigned short *mTextureCoords[AI_MAX_NUMBER_OF_TEXTURECOORDS];
+
+    /** Vertex colors as four 8 bit unsigned normalized integers (RGBA)
+     *  per vertex */
+    unsigned char *mColors[AI_MAX_NUMBER_OF_COLOR_SETS];
+
+#ifdef __cplusplus
+    aiQuantizedVertices() AI_NO_EXCEPT
+            : mNumVertices(0),
+              mSourceHash(0),
+              mPositions(nullptr),
+              mPositionOffset(),
+              mPositionScale(1),
+              mNormals(nullptr),
+              mTangents(nullptr),
+              mTextureCoords{nullptr},
+              mColors{nullptr} {
+        // empty
+    }
+
+    ~aiQuantizedVertices() {
+        delete[] mPositions;
+        delete[] mNormals;
+        delete[] mTangents;
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; a++) {
+            delete[] mTextureCoords[a];
+        }
+        for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; a++) {
+            delete[] mColors[a];
+        }
+    }
+#endif // __cplusplus
+};
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
  *
@@ -826,6 +997,18 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     * Meshlet partitioning of the mesh, generated by the
+     * #aiProcessExtra_GenMeshlets step. nullptr if not present.
+     */
+    C_STRUCT aiMeshletTable *mMeshlets;
+
+    /**
+     * Quantized copy of the vertex attributes, generated by the
+     * #aiProcessExtra_QuantizeVertices step. nullptr if not present.
+     */
+    C_STRUCT aiQuantizedVertices *mQuantizedVertices;
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,12 +1031,16 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mMeshlets(nullptr),
+              mQuantizedVertices(nullptr) {
         // empty
     }
 
     //! @brief The class destructor.
     ~aiMesh() {
+        delete mMeshlets;
+        delete mQuantizedVertices;
         delete[] mVertices;
         delete[] mNormals;
         delete[] mTangents;
@@ -897,6 +1084,19 @@ struct aiMesh {
         delete[] mFaces;
     }
 
+    //! @brief Check whether the mesh has been partitioned into meshlets.
+    bool HasMeshlets() const {
+        return mMeshlets != nullptr && mMeshlets->mNumMeshlets > 0;
+    }
+
+    //! @brief Check whether a quantized copy of the vertices matching the
+    //!        current vertex count is present. Whether the float attributes
+    //!        changed since it was generated is checked against
+    //!        aiQuantizedVertices::mSourceHash.
+    bool HasQuantizedVertices() const {
+        return mQuantizedVertices != nullptr && mQuantizedVertices->mNumVertices == mNumVertices;
+    }
+
     //! @brief Check whether the mesh contains positions. Provided no special
     //!        scene flags are set, this will always be true
     //! @return true, if positions are stored, false if not.
@@ -605,6 +605,65 @@ enum aiPostProcessSteps
     aiProcess_GenBoundingBoxes = 0x80000000
 };
 
+// -----------------------------------------------------------------------------------
+/** @enum  aiPostProcessExtraSteps
+ *  @brief Defines additional post processing steps.
+ *
+ *  All bits of #aiPostProcessSteps are in use, so further steps are enabled
+ *  by passing a bitwise combination of these flags in the
+ *  #AI_CONFIG_PP_EXTRA_STEPS property of the importer. They are executed
+ *  together with the steps selected by the regular post processing flags.
+ */
+enum aiPostProcessExtraSteps
+{
+    // -------------------------------------------------------------------------
+    /** <hr>Partitions all triangle meshes into meshlets.
+     *
+     * Each meshlet references at most #AI_CONFIG_PP_GML_MAX_VERTICES vertices
+     * and #AI_CONFIG_PP_GML_MAX_TRIANGLES triangles and carries a bounding
+     * sphere and a normal cone for culling. The result is stored in
+     * aiMesh::mMeshlets, the faces of the mesh are not modified. This is
+     * useful for mesh shader and GPU-driven rendering pipelines.
+     */
+    aiProcessExtra_GenMeshlets = 0x1,
+
+    // -------------------------------------------------------------------------
+    /** <hr>Generates a chain of simplified level-of-detail meshes.
+     *
+     * Each triangle mesh is simplified by quadric error edge collapses until the
+     * triangle ratios given by #AI_CONFIG_PP_LOD_RATIOS are reached. Open borders,
+     * attribute seams and bone influences are preserved. The LOD meshes are
+     * appended to aiScene::mMeshes, the index of LOD level n (starting at 1) of
+     * mesh i is stored as unsigned integer scene metadata named "LOD_<i>_<n>".
+     * Use #aiProcess_JoinIdenticalVertices as well, otherwise nothing can be
+     * collapsed.
+     */
+    aiProcessExtra_GenLODs = 0x2,
+
+    // -------------------------------------------------------------------------
+    /** <hr>Stores a compact copy of the vertex attributes in aiMesh::mQuantizedVertices.
+     *
+     * Positions are quantized to 16 bit relative to the bounding box, normals
+     * and tangents are octahedron-encoded, texture coordinates are converted to
+     * half floats and colors to 8 bit per channel. The float vertex data is kept.
+     * The glTF 2 exporter writes the quantized data using KHR_mesh_quantization.
+     * This step runs last, so the data matches the final vertex buffers.
+     */
+    aiProcessExtra_QuantizeVertices = 0x4,
+
+    // -------------------------------------------------------------------------
+    /** <hr>Removes redundant keys from node animation channels.
+     *
+     * Keys which can be reproduced by interpolating the remaining keys within
+     * #AI_CONFIG_PP_OA_POSITION_TOLERANCE, #AI_CONFIG_PP_OA_ROTATION_TOLERANCE
+     * and #AI_CONFIG_PP_OA_SCALING_TOLERANCE are removed, constant tracks are
+     * reduced to a single key. Channels which only hold the transformation
+     * of their node are removed. This greatly reduces the size of baked
+     * animations, e.g. from FBX files, which have a key for every frame.
+     */
+    aiProcessExtra_OptimizeAnimations = 0x8
+};
+
 
 // ---------------------------------------------------------------------------------------
 /** @def aiProcess_ConvertToLeftHanded
@@ -0,0 +1,295 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "BenchmarkHarness.h"
+
+#include <assimp/version.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <locale>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+namespace Benchmark {
+
+namespace {
+
+struct Entry {
+    std::string name;
+    Function func;
+};
+
+struct Result {
+    std::string name;
+    unsigned int iterations = 0;
+    double meanTime = 0.0; // seconds
+    double minTime = 0.0;
+    double maxTime = 0.0;
+    uint64_t bytes = 0;
+    uint64_t triangles = 0;
+    std::string skipped;
+    std::string error;
+
+    double BytesPerSecond() const { return meanTime > 0.0 ? bytes / meanTime : 0.0; }
+    double TrianglesPerSecond() const { return meanTime > 0.0 ? triangles / meanTime : 0.0; }
+};
+
+std::vector<Entry> &GetRegistry() {
+    static std::vector<Entry> registry;
+    return registry;
+}
+
+Options &GetMutableOptions() {
+    static Options options;
+    return options;
+}
+
+// ---------------------------------------------------------------------------
+bool ParseArguments(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? std::string() : arg.substr(eq + 1);
+        if (key == "--detail") {
+            options.detail = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (key == "--min-time") {
+            options.minTime = std::strtod(value.c_str(), nullptr);
+        } else if (key == "--min-iterations") {
+            options.minIterations = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (key == "--max-iterations") {
+            options.maxIterations = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (key == "--filter") {
+            options.filter = value;
+        } else if (key == "--json") {
+            options.jsonFile = value;
+        } else if (key == "--list") {
+            options.list = true;
+        } else {
+            return false;
+        }
+    }
+    options.detail = std::min(options.detail, 10u);
+    options.minIterations = std::max(options.minIterations, 1u);
+    options.maxIterations = std::max(options.maxIterations, options.minIterations);
+    return true;
+}
+
+void PrintUsage() {
+    std::cout << "Usage: assimp_benchmarks [options]\n"
+              << "  --detail=<n>          Sphere tessellation level, 20*4^n triangles (default 8)\n"
+              << "  --min-time=<s>        Minimum measured time per benchmark (default 1.0)\n"
+              << "  --min-iterations=<n>  Minimum iterations per benchmark (default 1)\n"
+              << "  --max-iterations=<n>  Maximum iterations per benchmark (default 1000)\n"
+              << "  --filter=<text>       Only run benchmarks containing <text> in their name\n"
+              << "  --json=<file>         Write the results as JSON to <file>\n"
+              << "  --list                List the benchmarks and exit\n";
+}
+
+// ---------------------------------------------------------------------------
+Result Run(const Entry &entry, const Options &options) {
+    Result result;
+    result.name = entry.name;
+
+    double total = 0.0;
+    while (result.iterations < options.minIterations ||
+            (total < options.minTime && result.iterations < options.maxIterations)) {
+        State state;
+        entry.func(state);
+        state.PauseTiming();
+        if (!state.GetSkipReason().empty()) {
+            result.skipped = state.GetSkipReason();
+            return result;
+        }
+        if (!state.GetError().empty()) {
+            result.error = state.GetError();
+            return result;
+        }
+
+        const double elapsed = state.GetElapsedSeconds();
+        result.minTime = result.iterations == 0 ? elapsed : std::min(result.minTime, elapsed);
+        result.maxTime = std::max(result.maxTime, elapsed);
+        result.bytes = state.GetBytesProcessed();
+        result.triangles = state.GetTrianglesProcessed();
+        total += elapsed;
+        ++result.iterations;
+    }
+    result.meanTime = total / result.iterations;
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+void PrintResult(const Result &result) {
+    char line[256];
+    if (!result.skipped.empty() || !result.error.empty()) {
+        std::snprintf(line, sizeof(line), "%-40s %s: %s", result.name.c_str(),
+                result.error.empty() ? "skipped" : "FAILED",
+                result.error.empty() ? result.skipped.c_str() : result.error.c_str());
+    } else {
+        std::snprintf(line, sizeof(line), "%-40s %10u %12.3f %12.3f %12.2f %12.2f", result.name.c_str(),
+                result.iterations, result.meanTime * 1e3, result.minTime * 1e3,
+                result.BytesPerSecond() / (1024.0 * 1024.0), result.TrianglesPerSecond() / 1e6);
+    }
+    std::cout << line << std::endl;
+}
+
+std::string EscapeJson(const std::string &in) {
+    std::string out;
+    for (const char c : in) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += ' ';
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+bool WriteJson(const std::string &file, const Options &options, const std::vector<Result> &results) {
+    std::ofstream out(file.c_str());
+    if (!out) {
+        return false;
+    }
+    out.imbue(std::locale::classic());
+    out.precision(9);
+
+    char date[64] = {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+        << "    \"assimp_version\": \"" << aiGetVersionMajor() << '.' << aiGetVersionMinor() << '.' << aiGetVersionPatch() << "\",\n"
+        << "    \"assimp_revision\": \"" << std::hex << aiGetVersionRevision() << std::dec << "\",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+        << "    \"detail\": " << options.detail << ",\n"
+        << "    \"time_unit\": \"ms\"\n"
+        << "  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        out << (i ? ",\n" : "\n") << "    {\n"
+            << "      \"name\": \"" << EscapeJson(r.name) << "\",\n";
+        if (!r.skipped.empty() || !r.error.empty()) {
+            out << "      \"" << (r.error.empty() ? "skipped" : "error") << "\": \""
+                << EscapeJson(r.error.empty() ? r.skipped : r.error) << "\"\n    }";
+            continue;
+        }
+        out << "      \"iterations\": " << r.iterations << ",\n"
+            << "      \"real_time\": " << r.meanTime * 1e3 << ",\n"
+            << "      \"min_time\": " << r.minTime * 1e3 << ",\n"
+            << "      \"max_time\": " << r.maxTime * 1e3 << ",\n"
+            << "      \"bytes\": " << r.bytes << ",\n"
+            << "      \"triangles\": " << r.triangles << ",\n"
+            << "      \"bytes_per_second\": " << r.BytesPerSecond() << ",\n"
+            << "      \"triangles_per_second\": " << r.TrianglesPerSecond() << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+void Register(const std::string &name, Function func) {
+    GetRegistry().push_back({ name, std::move(func) });
+}
+
+// ---------------------------------------------------------------------------
+const Options &GetOptions() {
+    return GetMutableOptions();
+}
+
+// ---------------------------------------------------------------------------
+int RunBenchmarks(int argc, char **argv) {
+    Options &options = GetMutableOptions();
+    if (!ParseArguments(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<const Entry *> selected;
+    for (const Entry &entry : GetRegistry()) {
+        if (options.filter.empty() || entry.name.find(options.filter) != std::string::npos) {
+            selected.push_back(&entry);
+        }
+    }
+    if (options.list) {
+        for (const Entry *entry : selected) {
+            std::cout << entry->name << std::endl;
+        }
+        return 0;
+    }
+
+    char header[256];
+    std::snprintf(header, sizeof(header), "%-40s %10s %12s %12s %12s %12s", "Benchmark",
+            "Iterations", "Mean [ms]", "Min [ms]", "MB/s", "MTris/s");
+    std::cout << header << std::endl;
+
+    bool failed = false;
+    std::vector<Result> results;
+    for (const Entry *entry : selected) {
+        Result result = Run(*entry, options);
+        failed |= !result.error.empty();
+        PrintResult(result);
+        results.push_back(std::move(result));
+    }
+
+    if (!options.jsonFile.empty() && !WriteJson(options.jsonFile, options, results)) {
+        std::cerr << "Failed to write " << options.jsonFile << std::endl;
+        return 1;
+    }
+    return failed ? 1 : 0;
+}
+
+} // namespace Benchmark
+} // namespace Assimp
@@ -0,0 +1,146 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file BenchmarkHarness.h
+ *  @brief Minimal harness to register, run and report benchmarks.
+ */
+#pragma once
+#ifndef AI_BENCHMARKHARNESS_H_INC
+#define AI_BENCHMARKHARNESS_H_INC
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace Assimp {
+namespace Benchmark {
+
+// ---------------------------------------------------------------------------
+/// @brief The options of a benchmark run, parsed from the command line.
+struct Options {
+    unsigned int detail = 8;        ///< Tessellation level of the generated sphere, 20*4^detail triangles.
+    double minTime = 1.0;           ///< Minimum accumulated measured time per benchmark, in seconds.
+    unsigned int minIterations = 1; ///< Minimum number of iterations per benchmark.
+    unsigned int maxIterations = 1000; ///< Maximum number of iterations per benchmark.
+    std::string filter;             ///< Only run benchmarks whose name contains this string.
+    std::string jsonFile;           ///< Write the results to this file as JSON, if not empty.
+    bool list = false;              ///< Only list the benchmarks.
+};
+
+// ---------------------------------------------------------------------------
+/// @brief The state of a single benchmark iteration.
+///
+/// Timing starts paused, so setup work is excluded. Benchmarks enclose the
+/// measured region by ResumeTiming() and PauseTiming() and report the
+/// amount of processed data per iteration.
+class State {
+public:
+    /// @brief Starts or continues measuring.
+    void ResumeTiming() {
+        mStart = std::chrono::steady_clock::now();
+        mRunning = true;
+    }
+
+    /// @brief Stops measuring, the time since ResumeTiming() is accumulated.
+    void PauseTiming() {
+        if (mRunning) {
+            mElapsed += std::chrono::steady_clock::now() - mStart;
+            mRunning = false;
+        }
+    }
+
+    /// @brief Sets the number of bytes processed per iteration, used for MB/s.
+    void SetBytesProcessed(uint64_t bytes) { mBytes = bytes; }
+
+    /// @brief Sets the number of triangles processed per iteration.
+    void SetTrianglesProcessed(uint64_t triangles) { mTriangles = triangles; }
+
+    /// @brief Skips the benchmark, e.g. if a format is not part of the build.
+    void Skip(const std::string &reason) { mSkipped = reason; }
+
+    /// @brief Marks the benchmark as failed.
+    void Fail(const std::string &reason) { mError = reason; }
+
+    double GetElapsedSeconds() const { return std::chrono::duration<double>(mElapsed).count(); }
+    uint64_t GetBytesProcessed() const { return mBytes; }
+    uint64_t GetTrianglesProcessed() const { return mTriangles; }
+    const std::string &GetSkipReason() const { return mSkipped; }
+    const std::string &GetError() const { return mError; }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+    std::chrono::steady_clock::duration mElapsed = std::chrono::steady_clock::duration::zero();
+    bool mRunning = false;
+    uint64_t mBytes = 0;
+    uint64_t mTriangles = 0;
+    std::string mSkipped;
+    std::string mError;
+};
+
+/// @brief The signature of a benchmark function, called once per iteration.
+using Function = std::function<void(State &)>;
+
+// ---------------------------------------------------------------------------
+/// @brief Adds a benchmark to the global list.
+/// @param name     Unique name, e.g. "Import/obj".
+/// @param func     The benchmark function.
+void Register(const std::string &name, Function func);
+
+// ---------------------------------------------------------------------------
+/// @brief Returns the options of the current run.
+const Options &GetOptions();
+
+// ---------------------------------------------------------------------------
+/// @brief Parses the command line, runs all matching benchmarks and reports
+///   the results.
+/// @return 0 on success, 1 if a benchmark failed or the arguments are invalid.
+int RunBenchmarks(int argc, char **argv);
+
+// the benchmark groups
+void RegisterImporterBenchmarks();
+void RegisterPostProcessingBenchmarks();
+void RegisterExporterBenchmarks();
+
+} // namespace Benchmark
+} // namespace Assimp
+
+#endif // AI_BENCHMARKHARNESS_H_INC
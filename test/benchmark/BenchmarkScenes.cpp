@@ -0,0 +1,155 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "BenchmarkScenes.h"
+#include "BenchmarkHarness.h"
+
+#include <assimp/StandardShapes.h>
+#include <assimp/material.h>
+#include <assimp/mesh.h>
+#include <assimp/scene.h>
+#ifndef ASSIMP_BUILD_NO_EXPORT
+#   include <assimp/Exporter.hpp>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace Assimp {
+namespace Benchmark {
+
+namespace {
+
+aiScene *CreateSphereScene(unsigned int detail) {
+    std::vector<aiVector3D> positions;
+    StandardShapes::MakeSphere(detail, positions);
+
+    auto *mesh = new aiMesh;
+    mesh->mName = "sphere";
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mNumVertices = static_cast<unsigned int>(positions.size());
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+    mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+    mesh->mNumUVComponents[0] = 2;
+    const ai_real pi = static_cast<ai_real>(AI_MATH_PI);
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        const aiVector3D &p = positions[i];
+        mesh->mVertices[i] = p;
+        mesh->mNormals[i] = aiVector3D(p).Normalize();
+        const aiVector3D &n = mesh->mNormals[i];
+        mesh->mTextureCoords[0][i] = aiVector3D(
+                static_cast<ai_real>(0.5) + std::atan2(n.z, n.x) / (2 * pi),
+                static_cast<ai_real>(0.5) + std::asin(std::max<ai_real>(-1, std::min<ai_real>(1, n.y))) / pi, 0);
+    }
+
+    mesh->mNumFaces = mesh->mNumVertices / 3;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+        aiFace &face = mesh->mFaces[f];
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[3];
+        for (unsigned int k = 0; k < 3; ++k) {
+            face.mIndices[k] = f * 3 + k;
+        }
+    }
+
+    auto *scene = new aiScene;
+    scene->mNumMeshes = 1;
+    scene->mMeshes = new aiMesh *[1];
+    scene->mMeshes[0] = mesh;
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[1];
+    scene->mMaterials[0] = new aiMaterial;
+    const aiString materialName("default");
+    scene->mMaterials[0]->AddProperty(&materialName, AI_MATKEY_NAME);
+
+    scene->mRootNode = new aiNode("root");
+    scene->mRootNode->mNumMeshes = 1;
+    scene->mRootNode->mMeshes = new unsigned int[1];
+    scene->mRootNode->mMeshes[0] = 0;
+    return scene;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+const aiScene *GetSphereScene() {
+    static std::unique_ptr<aiScene> scene(CreateSphereScene(GetOptions().detail));
+    return scene.get();
+}
+
+// ---------------------------------------------------------------------------
+const std::vector<char> &GetEncodedScene(const std::string &formatId) {
+    static std::string cachedFormat;
+    static std::vector<char> cachedData;
+    if (formatId == cachedFormat) {
+        return cachedData;
+    }
+    cachedFormat = formatId;
+    cachedData.clear();
+    cachedData.shrink_to_fit();
+#ifndef ASSIMP_BUILD_NO_EXPORT
+    Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(GetSphereScene(), formatId.c_str());
+    if (blob != nullptr) {
+        const char *data = static_cast<const char *>(blob->data);
+        cachedData.assign(data, data + blob->size);
+    }
+#endif
+    return cachedData;
+}
+
+// ---------------------------------------------------------------------------
+uint64_t CountTriangles(const aiScene *scene) {
+    uint64_t triangles = 0;
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            triangles += mesh->mFaces[f].mNumIndices == 3 ? 1 : 0;
+        }
+    }
+    return triangles;
+}
+
+} // namespace Benchmark
+} // namespace Assimp
@@ -0,0 +1,81 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file BenchmarkScenes.h
+ *  @brief Procedurally generated input data for the benchmarks.
+ */
+#pragma once
+#ifndef AI_BENCHMARKSCENES_H_INC
+#define AI_BENCHMARKSCENES_H_INC
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct aiScene;
+
+namespace Assimp {
+namespace Benchmark {
+
+// ---------------------------------------------------------------------------
+/// @brief Returns a scene with a single tessellated sphere.
+///
+/// The mesh is in verbose format and has 20*4^detail triangles with normals
+/// and texture coordinates, the detail is taken from the run options. The
+/// scene is generated on first use and shared by all benchmarks.
+const aiScene *GetSphereScene();
+
+// ---------------------------------------------------------------------------
+/// @brief Returns the sphere scene encoded in the given export format.
+///
+/// The last encoded format is cached.
+/// @param formatId The exporter id, e.g. "obj".
+/// @return The file data, empty if the exporter is not available.
+const std::vector<char> &GetEncodedScene(const std::string &formatId);
+
+// ---------------------------------------------------------------------------
+/// @brief Returns the number of triangles in a scene.
+uint64_t CountTriangles(const aiScene *scene);
+
+} // namespace Benchmark
+} // namespace Assimp
+
+#endif // AI_BENCHMARKSCENES_H_INC
@@ -0,0 +1,114 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "BenchmarkHarness.h"
+#include "BenchmarkScenes.h"
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+#   include <assimp/Exporter.hpp>
+#endif
+#include <assimp/scene.h>
+
+namespace Assimp {
+namespace Benchmark {
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+namespace {
+
+const char *const ExportFormats[] = {
+    "obj", "stl", "stlb", "ply", "plyb", "fbx", "fbxa", "gltf2", "glb2", "collada", "x", "assbin", "assxml"
+};
+
+void BenchmarkExport(State &state, const char *formatId) {
+    const aiScene *scene = GetSphereScene();
+
+    Exporter exporter;
+    state.ResumeTiming();
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, formatId);
+    state.PauseTiming();
+    if (blob == nullptr) {
+        state.Fail(exporter.GetErrorString());
+        return;
+    }
+
+    uint64_t bytes = 0;
+    for (const aiExportDataBlob *b = blob; b != nullptr; b = b->next) {
+        bytes += b->size;
+    }
+    state.SetBytesProcessed(bytes);
+    state.SetTrianglesProcessed(CountTriangles(scene));
+}
+
+bool HasExporter(const Exporter &exporter, const char *formatId) {
+    for (size_t i = 0; i < exporter.GetExportFormatCount(); ++i) {
+        if (std::string(exporter.GetExportFormatDescription(i)->id) == formatId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+void RegisterExporterBenchmarks() {
+    const Exporter exporter;
+    for (const char *formatId : ExportFormats) {
+        if (!HasExporter(exporter, formatId)) {
+            continue;
+        }
+        Register(std::string("Export/") + formatId, [formatId](State &state) {
+            BenchmarkExport(state, formatId);
+        });
+    }
+}
+
+#else
+
+void RegisterExporterBenchmarks() {
+    // empty
+}
+
+#endif // ASSIMP_BUILD_NO_EXPORT
+
+} // namespace Benchmark
+} // namespace Assimp
@@ -0,0 +1,103 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "BenchmarkHarness.h"
+#include "BenchmarkScenes.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+namespace Assimp {
+namespace Benchmark {
+
+namespace {
+
+struct ImportFormat {
+    const char *name;     // benchmark name
+    const char *exportId; // exporter used to generate the input
+    const char *hint;     // file extension passed to the importer
+};
+
+const ImportFormat ImportFormats[] = {
+    { "obj", "objnomtl", "obj" },
+    { "stl", "stl", "stl" },
+    { "stlb", "stlb", "stl" },
+    { "ply", "ply", "ply" },
+    { "plyb", "plyb", "ply" },
+    { "fbx", "fbx", "fbx" },
+    { "glb2", "glb2", "glb" },
+    { "collada", "collada", "dae" },
+    { "x", "x", "x" },
+    { "assbin", "assbin", "assbin" },
+};
+
+void BenchmarkImport(State &state, const ImportFormat &format) {
+    const std::vector<char> &data = GetEncodedScene(format.exportId);
+    if (data.empty()) {
+        state.Skip("no exporter to generate the input");
+        return;
+    }
+
+    Importer importer;
+    state.ResumeTiming();
+    const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), 0, format.hint);
+    state.PauseTiming();
+    if (scene == nullptr) {
+        state.Fail(importer.GetErrorString());
+        return;
+    }
+    state.SetBytesProcessed(data.size());
+    state.SetTrianglesProcessed(CountTriangles(scene));
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+void RegisterImporterBenchmarks() {
+    for (const ImportFormat &format : ImportFormats) {
+        Register(std::string("Import/") + format.name, [&format](State &state) {
+            BenchmarkImport(state, format);
+        });
+    }
+}
+
+} // namespace Benchmark
+} // namespace Assimp
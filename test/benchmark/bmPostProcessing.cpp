@@ -0,0 +1,117 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "BenchmarkHarness.h"
+#include "BenchmarkScenes.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+namespace Assimp {
+namespace Benchmark {
+
+namespace {
+
+struct PostProcessStep {
+    const char *name;
+    unsigned int setupFlags; // applied while loading the input, not measured
+    unsigned int flags;      // #aiPostProcessSteps to measure
+    unsigned int extraFlags; // #aiPostProcessExtraSteps to measure
+};
+
+const PostProcessStep PostProcessSteps[] = {
+    { "JoinIdenticalVertices", 0, aiProcess_JoinIdenticalVertices, 0 },
+    { "GenSmoothNormals", 0, aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals, 0 },
+    { "CalcTangentSpace", 0, aiProcess_CalcTangentSpace, 0 },
+    { "ImproveCacheLocality", aiProcess_JoinIdenticalVertices, aiProcess_ImproveCacheLocality, 0 },
+    { "SplitLargeMeshes", 0, aiProcess_SplitLargeMeshes, 0 },
+    { "FindDegenerates", 0, aiProcess_FindDegenerates, 0 },
+    { "FindInvalidData", 0, aiProcess_FindInvalidData, 0 },
+    { "FixInfacingNormals", 0, aiProcess_FixInfacingNormals, 0 },
+    { "GenBoundingBoxes", 0, aiProcess_GenBoundingBoxes, 0 },
+    { "ValidateDataStructure", 0, aiProcess_ValidateDataStructure, 0 },
+    { "GenMeshlets", aiProcess_JoinIdenticalVertices, 0, aiProcessExtra_GenMeshlets },
+    { "GenLODs", aiProcess_JoinIdenticalVertices, 0, aiProcessExtra_GenLODs },
+    { "QuantizeVertices", aiProcess_JoinIdenticalVertices, 0, aiProcessExtra_QuantizeVertices },
+    { "TargetRealtime_MaxQuality", 0, aiProcessPreset_TargetRealtime_MaxQuality, 0 },
+};
+
+void BenchmarkPostProcess(State &state, const PostProcessStep &step) {
+    // load a fresh copy of the scene, the steps work in-place
+    const std::vector<char> &data = GetEncodedScene("assbin");
+    if (data.empty()) {
+        state.Skip("no exporter to generate the input");
+        return;
+    }
+    Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), step.setupFlags, "assbin");
+    if (scene == nullptr) {
+        state.Fail(importer.GetErrorString());
+        return;
+    }
+    const uint64_t triangles = CountTriangles(scene);
+    importer.SetPropertyInteger(AI_CONFIG_PP_EXTRA_STEPS, static_cast<int>(step.extraFlags));
+
+    state.ResumeTiming();
+    scene = importer.ApplyPostProcessing(step.flags);
+    state.PauseTiming();
+    if (scene == nullptr) {
+        state.Fail(importer.GetErrorString());
+        return;
+    }
+    state.SetTrianglesProcessed(triangles);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+void RegisterPostProcessingBenchmarks() {
+    for (const PostProcessStep &step : PostProcessSteps) {
+        Register(std::string("PostProcess/") + step.name, [&step](State &state) {
+            BenchmarkPostProcess(state, step);
+        });
+    }
+}
+
+} // namespace Benchmark
+} // namespace Assimp
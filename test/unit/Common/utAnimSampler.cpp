@@ -0,0 +1,220 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include <assimp/AnimSampler.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+
+using namespace Assimp;
+
+class utAnimSampler : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // root -> arm -> hand, root -> prop
+        mScene.reset(new aiScene);
+        mScene->mRootNode = new aiNode("root");
+        aiNode *arm = new aiNode("arm");
+        arm->mTransformation = aiMatrix4x4(aiVector3D(1, 1, 1), aiQuaternion(), aiVector3D(0, 1, 0));
+        aiNode *prop = new aiNode("prop");
+        aiNode *children[2] = { arm, prop };
+        mScene->mRootNode->addChildren(2, children);
+        aiNode *hand = new aiNode("hand");
+        hand->mTransformation = aiMatrix4x4(aiVector3D(1, 1, 1), aiQuaternion(), aiVector3D(1, 0, 0));
+        arm->addChildren(1, &hand);
+
+        mAnim = new aiAnimation;
+        mAnim->mDuration = 10.0;
+        mAnim->mTicksPerSecond = 0.0;
+        mAnim->mNumChannels = 2;
+        mAnim->mChannels = new aiNodeAnim *[2];
+
+        aiNodeAnim *channel = mAnim->mChannels[0] = new aiNodeAnim;
+        channel->mNodeName.Set("arm");
+        channel->mNumPositionKeys = 2;
+        channel->mPositionKeys = new aiVectorKey[2]{ aiVectorKey(0.0, aiVector3D(0, 0, 0)), aiVectorKey(10.0, aiVector3D(10, 0, 0)) };
+        channel->mNumRotationKeys = 2;
+        channel->mRotationKeys = new aiQuatKey[2]{ aiQuatKey(0.0, aiQuaternion()),
+            aiQuatKey(10.0, aiQuaternion(aiVector3D(0, 0, 1), (ai_real)AI_MATH_HALF_PI)) };
+
+        // rotation keys only, position and scaling come from the node
+        channel = mAnim->mChannels[1] = new aiNodeAnim;
+        channel->mNodeName.Set("hand");
+        channel->mNumRotationKeys = 1;
+        channel->mRotationKeys = new aiQuatKey[1]{ aiQuatKey(0.0, aiQuaternion()) };
+
+        mScene->mNumAnimations = 1;
+        mScene->mAnimations = new aiAnimation *[1];
+        mScene->mAnimations[0] = mAnim;
+    }
+
+    static void ExpectNear(const aiVector3D &expected, const aiVector3D &actual) {
+        EXPECT_NEAR(expected.x, actual.x, 1e-4);
+        EXPECT_NEAR(expected.y, actual.y, 1e-4);
+        EXPECT_NEAR(expected.z, actual.z, 1e-4);
+    }
+
+    std::unique_ptr<aiScene> mScene;
+    aiAnimation *mAnim = nullptr;
+};
+
+TEST_F(utAnimSampler, interpolatesPositionsAndRotations) {
+    AnimSampler sampler(mAnim, mScene->mRootNode);
+    ASSERT_EQ(2u, sampler.GetNumChannels());
+
+    sampler.Sample(2.5);
+    ExpectNear(aiVector3D(2.5, 0, 0), sampler.GetPositions()[0]);
+    aiQuaternion expected;
+    aiQuaternion::Interpolate(expected, mAnim->mChannels[0]->mRotationKeys[0].mValue,
+            mAnim->mChannels[0]->mRotationKeys[1].mValue, (ai_real)0.25);
+    const aiQuaternion &rotation = sampler.GetRotations()[0];
+    EXPECT_NEAR(expected.w, rotation.w, 1e-5);
+    EXPECT_NEAR(expected.z, rotation.z, 1e-5);
+    ExpectNear(aiVector3D(1, 1, 1), sampler.GetScalings()[0]);
+}
+
+TEST_F(utAnimSampler, tracksWithoutKeysUseNodeTransform) {
+    AnimSampler sampler(mAnim, mScene->mRootNode);
+    sampler.Sample(5.0);
+    ExpectNear(aiVector3D(1, 0, 0), sampler.GetPositions()[1]);
+    ExpectNear(aiVector3D(1, 1, 1), sampler.GetScalings()[1]);
+
+    // without the hierarchy the defaults are the identity
+    AnimSampler unbound(mAnim);
+    unbound.Sample(5.0);
+    ExpectNear(aiVector3D(0, 0, 0), unbound.GetPositions()[1]);
+    EXPECT_EQ(-1, unbound.GetChannelNode(1));
+}
+
+TEST_F(utAnimSampler, clampsOrRepeatsOutsideKeyRange) {
+    AnimSampler sampler(mAnim);
+    sampler.Sample(-3.0);
+    ExpectNear(aiVector3D(0, 0, 0), sampler.GetPositions()[0]);
+    sampler.Sample(13.0);
+    ExpectNear(aiVector3D(10, 0, 0), sampler.GetPositions()[0]);
+
+    mAnim->mChannels[0]->mPostState = aiAnimBehaviour_REPEAT;
+    sampler.Sample(13.0);
+    ExpectNear(aiVector3D(3, 0, 0), sampler.GetPositions()[0]);
+
+    mAnim->mChannels[0]->mPreState = aiAnimBehaviour_LINEAR;
+    sampler.Sample(-2.0);
+    ExpectNear(aiVector3D(-2, 0, 0), sampler.GetPositions()[0]);
+}
+
+TEST_F(utAnimSampler, stepKeysHoldTheirValue) {
+    mAnim->mChannels[0]->mPositionKeys[0].mInterpolation = aiAnimInterpolation_Step;
+    AnimSampler sampler(mAnim);
+    sampler.Sample(9.0);
+    ExpectNear(aiVector3D(0, 0, 0), sampler.GetPositions()[0]);
+    sampler.Sample(10.0);
+    ExpectNear(aiVector3D(10, 0, 0), sampler.GetPositions()[0]);
+}
+
+TEST_F(utAnimSampler, cursorsMatchRandomAccess) {
+    // x = t * t sampled at integer times
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    delete[] channel->mPositionKeys;
+    channel->mNumPositionKeys = 101;
+    channel->mPositionKeys = new aiVectorKey[101];
+    for (unsigned int i = 0; i <= 100; ++i) {
+        channel->mPositionKeys[i] = aiVectorKey(i * 0.1, aiVector3D((ai_real)(i * i), 0, 0));
+    }
+    const auto expected = [](double t) {
+        const unsigned int i = std::min(static_cast<unsigned int>(t * 10.0), 99u);
+        const double f = t * 10.0 - i;
+        return (ai_real)(i * i + ((i + 1) * (i + 1) - i * i) * f);
+    };
+
+    // forward playback, large jumps and backward seeks
+    AnimSampler sampler(mAnim);
+    const double times[] = { 0.0, 0.013, 0.05, 0.11, 0.37, 0.38, 5.55, 9.99, 2.02, 0.0, 7.77, 7.7, 10.0, 1.0 };
+    for (const double t : times) {
+        sampler.Sample(t);
+        EXPECT_NEAR(expected(t), sampler.GetPositions()[0].x, 1e-2) << "at time " << t;
+    }
+    sampler.Reset();
+    for (double t = 0.0; t <= 10.0; t += 0.037) {
+        sampler.Sample(t);
+        EXPECT_NEAR(expected(t), sampler.GetPositions()[0].x, 1e-2) << "at time " << t;
+    }
+}
+
+TEST_F(utAnimSampler, composesGlobalTransforms) {
+    AnimSampler sampler(mAnim, mScene->mRootNode);
+    ASSERT_EQ(4u, sampler.GetNumNodes());
+    const int hand = sampler.FindNode("hand");
+    const int prop = sampler.FindNode("prop");
+    ASSERT_GE(hand, 0);
+    ASSERT_GE(prop, 0);
+    EXPECT_EQ(-1, sampler.FindNode("missing"));
+    EXPECT_EQ(sampler.FindNode("arm"), sampler.GetChannelNode(0));
+
+    sampler.Sample(10.0);
+    sampler.ComputeGlobalTransforms();
+
+    // the arm is moved to (10,0,0) and rotated by 90 degrees around z
+    aiVector3D scaling, position;
+    aiQuaternion rotation;
+    sampler.GetGlobalTransforms()[hand].Decompose(scaling, rotation, position);
+    ExpectNear(aiVector3D(10, 1, 0), position);
+    EXPECT_TRUE(sampler.GetGlobalTransforms()[prop].IsIdentity());
+}
+
+TEST_F(utAnimSampler, localTransformsMatchPose) {
+    AnimSampler sampler(mAnim, mScene->mRootNode);
+    sampler.Sample(5.0);
+    aiMatrix4x4 local[2];
+    sampler.GetLocalTransforms(local);
+    ExpectNear(aiVector3D(5, 0, 0), aiVector3D(local[0].a4, local[0].b4, local[0].c4));
+    ExpectNear(aiVector3D(1, 0, 0), aiVector3D(local[1].a4, local[1].b4, local[1].c4));
+}
+
+TEST_F(utAnimSampler, convertsSecondsToTicks) {
+    AnimSampler sampler(mAnim);
+    // 25 ticks per second are assumed
+    EXPECT_DOUBLE_EQ(5.0, sampler.GetTicks(0.2));
+    EXPECT_DOUBLE_EQ(2.5, sampler.GetTicks(0.5));
+    EXPECT_DOUBLE_EQ(10.0, sampler.GetTicks(0.5, false));
+    EXPECT_DOUBLE_EQ(0.0, sampler.GetTicks(-1.0, false));
+}
@@ -0,0 +1,92 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "Common/CompactVertex.h"
+
+#include <memory>
+
+using namespace Assimp;
+
+class utCompactVertex : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mMesh.reset(new aiMesh);
+        mMesh->mNumVertices = 4;
+        mMesh->mVertices = new aiVector3D[4];
+        mMesh->mNormals = new aiVector3D[4];
+        mMesh->mTextureCoords[0] = new aiVector3D[4];
+        mMesh->mNumUVComponents[0] = 2;
+        for (unsigned int i = 0; i < 4; ++i) {
+            mMesh->mVertices[i] = aiVector3D(1.f, 2.f, 3.f);
+            mMesh->mNormals[i] = aiVector3D(0.f, 0.f, 1.f);
+            mMesh->mTextureCoords[0][i] = aiVector3D(0.5f, 0.5f, static_cast<ai_real>(i));
+        }
+    }
+
+    std::unique_ptr<aiMesh> mMesh;
+};
+
+TEST_F(utCompactVertex, packsOnlyPresentChannelsTest) {
+    CompactVertexBuffer buffer(mMesh.get());
+    EXPECT_EQ(8u, buffer.GetStride());
+    EXPECT_EQ(4u, buffer.GetNumVertices());
+
+    const ai_real *v = buffer.Get(2);
+    EXPECT_EQ(ai_real(1.0), v[0]);
+    EXPECT_EQ(ai_real(1.0), v[5]);
+    EXPECT_EQ(ai_real(0.5), v[7]);
+}
+
+TEST_F(utCompactVertex, hashTableJoinsEqualVerticesTest) {
+    mMesh->mNormals[1] = aiVector3D(0.f, 1.f, 0.f);
+    mMesh->mVertices[3] = aiVector3D(1.f, 2.f, 4.f);
+    mMesh->mNormals[2].z += 1e-7f;
+
+    CompactVertexBuffer buffer(mMesh.get());
+    CompactVertexHashTable table(buffer, static_cast<ai_real>(1e-10));
+    EXPECT_EQ(0u, table.FindOrInsert(0));
+    EXPECT_EQ(1u, table.FindOrInsert(1));
+    EXPECT_EQ(0u, table.FindOrInsert(2));
+    EXPECT_EQ(3u, table.FindOrInsert(3));
+    EXPECT_EQ(3u, table.Size());
+}
@@ -0,0 +1,184 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "Common/CompressedIOStream.h"
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
+#include <assimp/XmlParser.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace Assimp;
+
+class utCompressedIOStream : public ::testing::Test {
+protected:
+    // counts the bytes pulled from the wrapped stream
+    class CountingIOStream : public IOStream {
+    public:
+        CountingIOStream(std::shared_ptr<IOStream> source) :
+                mSource(std::move(source)), mRead(0) {}
+        size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+            const size_t count = mSource->Read(pvBuffer, pSize, pCount);
+            mRead += count * pSize;
+            return count;
+        }
+        size_t Write(const void *, size_t, size_t) override { return 0; }
+        aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override { return mSource->Seek(pOffset, pOrigin); }
+        size_t Tell() const override { return mSource->Tell(); }
+        size_t FileSize() const override { return mSource->FileSize(); }
+        void Flush() override {}
+
+        std::shared_ptr<IOStream> mSource;
+        size_t mRead;
+    };
+
+    static std::shared_ptr<IOStream> open(const char *file) {
+        DefaultIOSystem io;
+        return std::shared_ptr<IOStream>(io.Open(file, "rb"));
+    }
+};
+
+TEST_F(utCompressedIOStream, readGZipTest) {
+    std::shared_ptr<IOStream> source = open(ASSIMP_TEST_MODELS_DIR "/BLEND/BlenderDefault_250_Compressed.blend");
+    ASSERT_NE(nullptr, source);
+
+    // the trailer only serves as a hint, the size is measured by inflating
+    CompressedIOStream stream(source, CompressedIOStream::Container::GZip);
+    EXPECT_EQ(396964u, stream.SizeHint());
+    EXPECT_EQ(396964u, stream.FileSize());
+
+    std::vector<char> data(stream.FileSize());
+    EXPECT_EQ(data.size(), stream.Read(data.data(), 1, data.size()));
+    EXPECT_EQ(0, ::memcmp(data.data(), "BLENDER", 7));
+    EXPECT_EQ(data.size(), stream.Tell());
+
+    char c;
+    EXPECT_EQ(0u, stream.Read(&c, 1, 1));
+}
+
+TEST_F(utCompressedIOStream, ignoreBogusTrailerTest) {
+    std::shared_ptr<IOStream> source = open(ASSIMP_TEST_MODELS_DIR "/BLEND/BlenderDefault_250_Compressed.blend");
+    ASSERT_NE(nullptr, source);
+    std::vector<uint8_t> file(source->FileSize());
+    ASSERT_EQ(file.size(), source->Read(file.data(), 1, file.size()));
+
+    // claim 4 GiB - 1 of decompressed data, the hint is capped
+    ::memset(&file[file.size() - 4], 0xff, 4);
+    {
+        CompressedIOStream stream(std::make_shared<MemoryIOStream>(file.data(), file.size()), CompressedIOStream::Container::GZip);
+        EXPECT_EQ(file.size() * 1032, stream.SizeHint());
+
+        // zlib checks the trailer once the inflate reaches it
+        EXPECT_THROW(stream.FileSize(), DeadlyImportError);
+    }
+
+    // claim 16 bytes, seeking beyond that must still work
+    ::memset(&file[file.size() - 4], 0, 4);
+    file[file.size() - 4] = 16;
+    {
+        CompressedIOStream stream(std::make_shared<MemoryIOStream>(file.data(), file.size()), CompressedIOStream::Container::GZip);
+        EXPECT_EQ(16u, stream.SizeHint());
+        EXPECT_EQ(aiReturn_SUCCESS, stream.Seek(1000, aiOrigin_SET));
+        EXPECT_EQ(1000u, stream.Tell());
+    }
+}
+
+TEST_F(utCompressedIOStream, detectContainerTest) {
+    std::shared_ptr<IOStream> source = open(ASSIMP_TEST_MODELS_DIR "/BLEND/TorusLightsCams_250_compressed.blend");
+    ASSERT_NE(nullptr, source);
+
+    CompressedIOStream stream(source);
+    char magic[8] = {};
+    EXPECT_EQ(1u, stream.Read(magic, 7, 1));
+    EXPECT_STREQ("BLENDER", magic);
+    EXPECT_EQ(568880u, stream.FileSize());
+    EXPECT_EQ(7u, stream.Tell());
+}
+
+TEST_F(utCompressedIOStream, seekRawTest) {
+    std::shared_ptr<IOStream> source = open(ASSIMP_TEST_MODELS_DIR "/XGL/BCN_Epileptic.zgl");
+    ASSERT_NE(nullptr, source);
+
+    // zgl files are raw deflate data behind two extra bytes
+    source->Seek(2, aiOrigin_SET);
+    CompressedIOStream stream(source, CompressedIOStream::Container::Raw);
+
+    // the size of raw data is only known after inflating it once
+    const size_t size = stream.FileSize();
+    ASSERT_EQ(1434761u, size);
+    ASSERT_GT(size, CompressedIOStream::CheckpointSpan);
+    EXPECT_EQ(0u, stream.Tell());
+
+    std::vector<char> data(size);
+    ASSERT_EQ(size, stream.Read(data.data(), 1, size));
+
+    // backwards past a checkpoint, forwards again and relative to the end
+    const size_t offsets[] = { 100, CompressedIOStream::CheckpointSpan + 17, 5000, CompressedIOStream::CheckpointSpan - 3, size - 64 };
+    for (size_t offset : offsets) {
+        char chunk[64];
+        ASSERT_EQ(aiReturn_SUCCESS, stream.Seek(offset, aiOrigin_SET));
+        EXPECT_EQ(offset, stream.Tell());
+        ASSERT_EQ(sizeof(chunk), stream.Read(chunk, 1, sizeof(chunk)));
+        EXPECT_EQ(0, ::memcmp(chunk, &data[offset], sizeof(chunk)));
+    }
+
+    EXPECT_EQ(aiReturn_SUCCESS, stream.Seek(10, aiOrigin_END));
+    EXPECT_EQ(size - 10, stream.Tell());
+    EXPECT_EQ(aiReturn_FAILURE, stream.Seek(size + 1, aiOrigin_SET));
+}
+
+TEST_F(utCompressedIOStream, parseRawXmlOnceTest) {
+    std::shared_ptr<IOStream> file = open(ASSIMP_TEST_MODELS_DIR "/XGL/BCN_Epileptic.zgl");
+    ASSERT_NE(nullptr, file);
+    auto source = std::make_shared<CountingIOStream>(file);
+    source->Seek(2, aiOrigin_SET);
+    CompressedIOStream stream(source, CompressedIOStream::Container::Raw);
+
+    // reading to the end never asks for the size, which would inflate everything twice
+    XmlParser parser;
+    ASSERT_TRUE(parser.parseUntilEnd(&stream));
+    EXPECT_NE(nullptr, parser.findNode("WORLD"));
+    EXPECT_EQ(1434761u, stream.Tell());
+    EXPECT_LE(source->mRead, file->FileSize());
+}
@@ -40,7 +40,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/LogStream.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace Assimp;
 class utLogger : public ::testing::Test {};
@@ -50,3 +60,104 @@ TEST_F(utLogger, aiGetPredefinedLogStream_leak_test) {
     aiLogStream stream2 = aiGetPredefinedLogStream(aiDefaultLogStream_STDOUT, nullptr);
     ASSERT_EQ(stream1.callback, stream2.callback);
 }
+
+namespace {
+
+class CollectingLogStream : public LogStream {
+public:
+    void write(const char *message) override {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mMessages.emplace_back(message);
+    }
+
+    std::mutex mMutex;
+    std::vector<std::string> mMessages;
+};
+
+} // namespace
+
+TEST_F(utLogger, isEnabledTest) {
+    NullLogger nullLogger;
+    EXPECT_FALSE(nullLogger.isEnabled(Logger::Err));
+
+    ASSERT_FALSE(DefaultLogger::isNullLogger());
+    Logger *logger = DefaultLogger::get();
+    const Logger::LogSeverity severity = logger->getLogSeverity();
+
+    logger->setLogSeverity(Logger::NORMAL);
+    EXPECT_TRUE(logger->isEnabled(Logger::Err));
+    EXPECT_FALSE(logger->isEnabled(Logger::Debugging, Logger::DEBUGGING));
+    logger->setLogSeverity(Logger::VERBOSE);
+    EXPECT_TRUE(logger->isEnabled(Logger::Debugging, Logger::DEBUGGING));
+    EXPECT_TRUE(logger->isEnabled(Logger::Debugging, Logger::VERBOSE));
+
+    logger->setLogSeverity(severity);
+}
+
+TEST_F(utLogger, asynchronousLoggingTest) {
+    static const unsigned int NumThreads = 4;
+    static const unsigned int NumMessages = 200;
+
+    ASSERT_FALSE(DefaultLogger::isNullLogger());
+    DefaultLogger *logger = static_cast<DefaultLogger *>(DefaultLogger::get());
+    CollectingLogStream *stream = new CollectingLogStream;
+    ASSERT_TRUE(logger->attachStream(stream, Logger::Warn));
+    ASSERT_TRUE(logger->setAsynchronous(true));
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < NumThreads; ++t) {
+        threads.emplace_back([t]() {
+            for (unsigned int i = 0; i < NumMessages; ++i) {
+                ASSIMP_LOG_WARN("asynchronous ", t, " ", i);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    // detaching writes the pending messages
+    EXPECT_TRUE(logger->detachStream(stream, Logger::Warn));
+    EXPECT_TRUE(logger->setAsynchronous(false));
+
+    // the messages of each thread are in order and tagged with the id of the thread
+    ASSERT_EQ(NumThreads * NumMessages, stream->mMessages.size());
+    std::vector<unsigned int> next(NumThreads, 0);
+    std::vector<unsigned int> ids(NumThreads, 0);
+    for (const std::string &message : stream->mMessages) {
+        unsigned int id = 0, t = 0, i = 0;
+        ASSERT_EQ(1, sscanf(message.c_str(), "Warn,  T%u:", &id));
+        const char *text = strstr(message.c_str(), "asynchronous ");
+        ASSERT_NE(nullptr, text);
+        ASSERT_EQ(2, sscanf(text, "asynchronous %u %u", &t, &i));
+        ASSERT_LT(t, NumThreads);
+        EXPECT_EQ(next[t]++, i);
+        if (ids[t] == 0) {
+            ids[t] = id;
+        }
+        EXPECT_EQ(ids[t], id);
+    }
+#ifndef _WIN32
+    EXPECT_EQ(NumThreads, std::set<unsigned int>(ids.begin(), ids.end()).size());
+#endif
+    delete stream;
+}
+
+TEST_F(utLogger, asynchronousErrorTest) {
+    ASSERT_FALSE(DefaultLogger::isNullLogger());
+    DefaultLogger *logger = static_cast<DefaultLogger *>(DefaultLogger::get());
+    CollectingLogStream *stream = new CollectingLogStream;
+    ASSERT_TRUE(logger->attachStream(stream, Logger::Warn | Logger::Err));
+    ASSERT_TRUE(logger->setAsynchronous(true));
+
+    // an error is written out with everything the thread logged before it
+    ASSIMP_LOG_WARN("before the error");
+    ASSIMP_LOG_ERROR("the error");
+    ASSERT_EQ(2u, stream->mMessages.size());
+    EXPECT_NE(std::string::npos, stream->mMessages[0].find("before the error"));
+    EXPECT_NE(std::string::npos, stream->mMessages[1].find("the error"));
+
+    EXPECT_TRUE(logger->detachStream(stream, Logger::Warn | Logger::Err));
+    EXPECT_TRUE(logger->setAsynchronous(false));
+    delete stream;
+}
@@ -0,0 +1,82 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "Common/ParallelFor.h"
+#include <assimp/cimport.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Assimp;
+
+class utParallelFor : public ::testing::Test {
+protected:
+    void TearDown() override {
+        aiSetMaxWorkerThreads(0);
+    }
+};
+
+TEST_F(utParallelFor, visitsEveryIndexOnceTest) {
+    std::vector<std::atomic<int>> visits(1000);
+    ParallelFor(visits.size(), [&](size_t i) { ++visits[i]; }, 7);
+    for (const std::atomic<int> &v : visits) {
+        EXPECT_EQ(1, v.load());
+    }
+}
+
+TEST_F(utParallelFor, singleThreadLimitTest) {
+    aiSetMaxWorkerThreads(1);
+    EXPECT_EQ(1u, GetNumWorkerThreads());
+
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<std::thread::id> ids(256);
+    ParallelFor(ids.size(), [&](size_t i) { ids[i] = std::this_thread::get_id(); });
+    for (const std::thread::id &id : ids) {
+        EXPECT_EQ(caller, id);
+    }
+
+    aiSetMaxWorkerThreads(0);
+    EXPECT_EQ(0u, GetMaxWorkerThreads());
+    EXPECT_GE(GetNumWorkerThreads(), 1u);
+}
@@ -0,0 +1,139 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "Common/TextStreamWriter.h"
+
+#include <cstdlib>
+#include <string>
+
+using namespace Assimp;
+
+namespace {
+
+// Collects everything written into a string
+class StringIOStream : public IOStream {
+public:
+    size_t Read(void *, size_t, size_t) override { return 0; }
+    size_t Write(const void *buffer, size_t size, size_t count) override {
+        mData.append(static_cast<const char *>(buffer), size * count);
+        ++mNumWrites;
+        return count;
+    }
+    aiReturn Seek(size_t, aiOrigin) override { return aiReturn_FAILURE; }
+    size_t Tell() const override { return mData.size(); }
+    size_t FileSize() const override { return mData.size(); }
+    void Flush() override {}
+
+    std::string mData;
+    size_t mNumWrites = 0;
+};
+
+} // namespace
+
+class utTextStreamWriter : public ::testing::Test {
+protected:
+    static std::string format(float value) {
+        char buffer[TextStreamWriter::MaxRealLength];
+        return std::string(buffer, TextStreamWriter::formatReal(buffer, value));
+    }
+    static std::string format(double value) {
+        char buffer[TextStreamWriter::MaxRealLength];
+        return std::string(buffer, TextStreamWriter::formatReal(buffer, value));
+    }
+};
+
+TEST_F(utTextStreamWriter, formatRealTest) {
+    EXPECT_EQ("0.1", format(0.1f));
+    EXPECT_EQ("0.1", format(0.1));
+    EXPECT_EQ("-2.5", format(-2.5f));
+    EXPECT_EQ("0", format(0.0f));
+    EXPECT_EQ("100", format(100.0f));
+
+    // the shortest text reads back to the same value
+    const float values[] = { 1.0f / 3.0f, 3.14159265f, 1e-7f, 123456.789f, -1e20f, 16777217.0f };
+    for (float value : values) {
+        EXPECT_EQ(value, static_cast<float>(std::strtod(format(value).c_str(), nullptr))) << format(value);
+    }
+    const double dvalue = 1.0 / 3.0;
+    EXPECT_EQ(dvalue, std::strtod(format(dvalue).c_str(), nullptr));
+}
+
+TEST_F(utTextStreamWriter, writeTest) {
+    StringIOStream stream;
+    TextStreamWriter writer(&stream);
+    writer << "v " << 1.5f << ' ' << -2 << ' ' << 3u << ' ' << size_t(42) << std::string(" end") << "\n";
+    EXPECT_EQ(0u, stream.mNumWrites);
+    EXPECT_EQ(18u, writer.size());
+
+    writer.flush();
+    EXPECT_EQ("v 1.5 -2 3 42 end\n", stream.mData);
+}
+
+TEST_F(utTextStreamWriter, discardTest) {
+    StringIOStream stream;
+    {
+        TextStreamWriter writer(&stream);
+        writer << "partial";
+    }
+    // without flush(), e.g. when the export threw, the buffered data is dropped
+    EXPECT_EQ(0u, stream.mNumWrites);
+    EXPECT_TRUE(stream.mData.empty());
+}
+
+TEST_F(utTextStreamWriter, chunkTest) {
+    StringIOStream stream;
+    std::string expected;
+    TextStreamWriter writer(&stream, 64);
+    for (int i = 0; i < 100; ++i) {
+        writer << i << ' ';
+        expected += std::to_string(i) + ' ';
+    }
+    const std::string large(200, 'x');
+    writer << large;
+    expected += large;
+    writer.flush();
+
+    EXPECT_EQ(expected, stream.mData);
+    EXPECT_EQ(expected.size(), writer.size());
+    EXPECT_GT(stream.mNumWrites, 1u);
+}
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/XmlParser.h>
 #include <assimp/DefaultIOStream.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
 
 using namespace Assimp;
 
@@ -84,3 +85,119 @@ TEST_F(utXmlParser, parse_xml_and_traverse_test) {
         EXPECT_FALSE(nodeName.empty());
     }
 }
+
+static MemoryIOStream *createStream(const char *xml) {
+    return new MemoryIOStream(reinterpret_cast<const uint8_t *>(xml), strlen(xml));
+}
+
+TEST_F(utXmlParser, pull_parser_events_test) {
+    const char *xml =
+            "<?xml version=\"1.0\"?>\r\n"
+            "<!DOCTYPE root [ <!ENTITY e \"x\"> ]>\n"
+            "<root a=\"1 &amp; 2\" b='&#x41;&#66;'>\n"
+            "  <!-- comment -->\n"
+            "  <item/>\r\n"
+            "  <text>a &lt; b\r\nc</text>\n"
+            "  <data><![CDATA[<raw>]]></data>\n"
+            "</root>\n";
+    std::unique_ptr<IOStream> stream(createStream(xml));
+    // A tiny block size makes every token cross a refill
+    XmlPullParser parser(stream.get(), 4);
+
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ("root", parser.getName());
+    EXPECT_EQ(1U, parser.getDepth());
+    ASSERT_EQ(2U, parser.getAttributes().size());
+    EXPECT_STREQ("1 & 2", parser.getAttribute("a"));
+    EXPECT_STREQ("AB", parser.getAttribute("b"));
+    EXPECT_EQ(nullptr, parser.getAttribute("c"));
+
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ("item", parser.getName());
+    EXPECT_EQ(2U, parser.getDepth());
+    EXPECT_EQ(XmlPullParser::Event::EndElement, parser.next());
+    EXPECT_EQ("item", parser.getName());
+    EXPECT_EQ(1U, parser.getDepth());
+
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ(XmlPullParser::Event::Text, parser.next());
+    EXPECT_EQ("a < b\nc", parser.getText());
+    EXPECT_EQ(XmlPullParser::Event::EndElement, parser.next());
+
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ(XmlPullParser::Event::Text, parser.next());
+    EXPECT_EQ("<raw>", parser.getText());
+    EXPECT_EQ(XmlPullParser::Event::EndElement, parser.next());
+
+    EXPECT_EQ(XmlPullParser::Event::EndElement, parser.next());
+    EXPECT_EQ("root", parser.getName());
+    EXPECT_EQ(XmlPullParser::Event::EndOfDocument, parser.next());
+}
+
+TEST_F(utXmlParser, pull_parser_subtree_test) {
+    const char *xml =
+            "<root>"
+            "<skip><a><b/></a>text</skip>"
+            "<keep id=\"k\"><child v=\"1\">value</child><child v=\"2\"/></keep>"
+            "</root>";
+    std::unique_ptr<IOStream> stream(createStream(xml));
+    XmlPullParser parser(stream.get(), 8);
+
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ("skip", parser.getName());
+    EXPECT_TRUE(parser.skipSubtree());
+
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ("keep", parser.getName());
+    pugi::xml_document doc;
+    EXPECT_TRUE(parser.readSubtree(doc));
+    XmlNode keep = doc.child("keep");
+    EXPECT_STREQ("k", keep.attribute("id").as_string());
+    XmlNode child = keep.first_child();
+    EXPECT_STREQ("1", child.attribute("v").as_string());
+    EXPECT_STREQ("value", child.text().as_string());
+    EXPECT_STREQ("2", child.next_sibling().attribute("v").as_string());
+
+    EXPECT_EQ(XmlPullParser::Event::EndElement, parser.next());
+    EXPECT_EQ("root", parser.getName());
+    EXPECT_EQ(XmlPullParser::Event::EndOfDocument, parser.next());
+}
+
+TEST_F(utXmlParser, pull_parser_error_test) {
+    std::unique_ptr<IOStream> stream(createStream("<root><a></b></root>"));
+    XmlPullParser parser(stream.get());
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ(XmlPullParser::Event::StartElement, parser.next());
+    EXPECT_EQ(XmlPullParser::Event::Error, parser.next());
+    EXPECT_FALSE(parser.getError().empty());
+    EXPECT_EQ(XmlPullParser::Event::Error, parser.next());
+
+    std::unique_ptr<IOStream> truncated(createStream("<root><a>"));
+    XmlPullParser truncatedParser(truncated.get());
+    EXPECT_EQ(XmlPullParser::Event::StartElement, truncatedParser.next());
+    EXPECT_EQ(XmlPullParser::Event::StartElement, truncatedParser.next());
+    EXPECT_EQ(XmlPullParser::Event::Error, truncatedParser.next());
+}
+
+TEST_F(utXmlParser, pull_parser_file_test) {
+    std::string filename = ASSIMP_TEST_MODELS_DIR "/X3D/ComputerKeyboard.x3d";
+    std::unique_ptr<IOStream> stream(mIoSystem.Open(filename.c_str(), "rb"));
+    ASSERT_NE(stream.get(), nullptr);
+    XmlPullParser parser(stream.get(), 256);
+    size_t numElements = 0;
+    XmlPullParser::Event event;
+    while ((event = parser.next()) != XmlPullParser::Event::EndOfDocument) {
+        ASSERT_NE(XmlPullParser::Event::Error, event) << parser.getError();
+        if (event == XmlPullParser::Event::StartElement) {
+            ++numElements;
+        }
+    }
+
+    XmlParser domParser;
+    std::unique_ptr<IOStream> domStream(mIoSystem.Open(filename.c_str(), "rb"));
+    ASSERT_TRUE(domParser.parse(domStream.get()));
+    XmlNode root = domParser.getRootNode();
+    XmlNodeIterator nodeIt(root, XmlNodeIterator::PreOrderMode);
+    EXPECT_EQ(nodeIt.size(), numElements);
+}
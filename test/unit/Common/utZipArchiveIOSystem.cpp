@@ -0,0 +1,119 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
+#include <assimp/ZipArchiveIOSystem.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Assimp;
+
+class utZipArchiveIOSystem : public ::testing::Test {
+protected:
+    // a memory io system which remembers the threads opening files, it is not thread-safe itself
+    class RecordingIOSystem : public MemoryIOSystem {
+    public:
+        RecordingIOSystem(const uint8_t *buff, size_t len) :
+                MemoryIOSystem(buff, len, nullptr) {}
+        IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+            mOpenedBy.push_back(std::this_thread::get_id());
+            return MemoryIOSystem::Open(pFile, pMode);
+        }
+
+        std::vector<std::thread::id> mOpenedBy;
+    };
+
+    static std::vector<uint8_t> readFile(const char *file) {
+        DefaultIOSystem io;
+        std::unique_ptr<IOStream> stream(io.Open(file, "rb"));
+        std::vector<uint8_t> data;
+        if (stream != nullptr) {
+            data.resize(stream->FileSize());
+            data.resize(stream->Read(data.data(), 1, data.size()));
+        }
+        return data;
+    }
+
+    static std::vector<uint8_t> readAll(IOSystem &io, const std::string &file) {
+        std::vector<uint8_t> data;
+        IOStream *stream = io.Open(file.c_str(), "rb");
+        if (stream != nullptr) {
+            data.resize(stream->FileSize());
+            data.resize(stream->Read(data.data(), 1, data.size()));
+            io.Close(stream);
+        }
+        return data;
+    }
+};
+
+TEST_F(utZipArchiveIOSystem, prefetchFromMemoryTest) {
+    const std::vector<uint8_t> archive = readFile(ASSIMP_TEST_MODELS_DIR "/3MF/box.3mf");
+    ASSERT_FALSE(archive.empty());
+
+    DefaultIOSystem defaultIO;
+    ZipArchiveIOSystem reference(&defaultIO, ASSIMP_TEST_MODELS_DIR "/3MF/box.3mf");
+    ASSERT_TRUE(reference.isOpen());
+
+    RecordingIOSystem memoryIO(archive.data(), archive.size());
+    ZipArchiveIOSystem zip(&memoryIO, AI_MEMORYIO_MAGIC_FILENAME);
+    ASSERT_TRUE(zip.isOpen());
+
+    std::vector<std::string> files;
+    zip.getFileList(files);
+    ASSERT_GE(files.size(), 3u);
+
+    // the worker threads must not enter the io system
+    zip.prefetch(files);
+    for (const std::thread::id &id : memoryIO.mOpenedBy) {
+        EXPECT_EQ(std::this_thread::get_id(), id);
+    }
+
+    for (const std::string &file : files) {
+        const std::vector<uint8_t> expected = readAll(reference, file);
+        ASSERT_FALSE(expected.empty()) << file;
+        EXPECT_EQ(expected, readAll(zip, file)) << file;
+    }
+}
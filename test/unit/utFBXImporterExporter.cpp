@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "AssetLib/FBX/FBXConverter.h"
 
 #include <assimp/commonMetaData.h>
 #include <assimp/material.h>
@@ -48,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/types.h>
 #include <assimp/Importer.hpp>
+#include <assimp/Exporter.hpp>
 
 using namespace Assimp;
 
@@ -461,3 +463,111 @@ TEST_F(utFBXImporterExporter, importSkeletonTest) {
     ASSERT_NE(nullptr, scene);
     ASSERT_TRUE(scene->mRootNode);
 }
+
+TEST_F(utFBXImporterExporter, importParallelAnimationsTest) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_LT(0u, scene->mNumAnimations);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyBool(AI_CONFIG_IMPORT_FBX_PARALLEL_ANIMATIONS, true);
+    const aiScene *parallelScene = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallelScene);
+
+    // the channels are merged back in node order, so the animations must be the same
+    ASSERT_EQ(scene->mNumAnimations, parallelScene->mNumAnimations);
+    for (unsigned int a = 0; a < scene->mNumAnimations; ++a) {
+        const aiAnimation *anim = scene->mAnimations[a];
+        const aiAnimation *parallelAnim = parallelScene->mAnimations[a];
+        EXPECT_EQ(anim->mDuration, parallelAnim->mDuration);
+        ASSERT_EQ(anim->mNumChannels, parallelAnim->mNumChannels);
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            const aiNodeAnim *channel = anim->mChannels[c];
+            const aiNodeAnim *parallelChannel = parallelAnim->mChannels[c];
+            EXPECT_EQ(channel->mNodeName, parallelChannel->mNodeName);
+            ASSERT_EQ(channel->mNumRotationKeys, parallelChannel->mNumRotationKeys);
+            for (unsigned int k = 0; k < channel->mNumRotationKeys; ++k) {
+                EXPECT_EQ(channel->mRotationKeys[k].mValue, parallelChannel->mRotationKeys[k].mValue);
+            }
+        }
+    }
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+TEST_F(utFBXImporterExporter, exportBinaryCompressedArrays) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Assimp::Exporter exporter;
+    ExportProperties uncompressedProps;
+    uncompressedProps.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_LEVEL, 0);
+    const aiExportDataBlob *uncompressed = exporter.ExportToBlob(scene, "fbx", 0, &uncompressedProps);
+    ASSERT_NE(nullptr, uncompressed);
+    const std::vector<char> plain(static_cast<const char *>(uncompressed->data),
+            static_cast<const char *>(uncompressed->data) + uncompressed->size);
+
+    ExportProperties compressedProps;
+    compressedProps.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_LEVEL, 9);
+    compressedProps.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD, 64);
+    const aiExportDataBlob *compressed = exporter.ExportToBlob(scene, "fbx", 0, &compressedProps);
+    ASSERT_NE(nullptr, compressed);
+    EXPECT_LT(compressed->size, plain.size());
+
+    Assimp::Importer plainImporter;
+    const aiScene *plainScene = plainImporter.ReadFileFromMemory(plain.data(), plain.size(), aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, plainScene);
+    Assimp::Importer compressedImporter;
+    const aiScene *compressedScene = compressedImporter.ReadFileFromMemory(compressed->data, compressed->size, aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, compressedScene);
+
+    ASSERT_EQ(plainScene->mNumMeshes, compressedScene->mNumMeshes);
+    for (unsigned int i = 0; i < plainScene->mNumMeshes; ++i) {
+        const aiMesh *a = plainScene->mMeshes[i];
+        const aiMesh *b = compressedScene->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+        }
+        ASSERT_EQ(a->HasTextureCoords(0), b->HasTextureCoords(0));
+        if (a->HasTextureCoords(0)) {
+            for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+                EXPECT_EQ(a->mTextureCoords[0][v], b->mTextureCoords[0][v]);
+            }
+        }
+    }
+}
+
+#endif // ASSIMP_BUILD_NO_EXPORT
+
+TEST_F(utFBXImporterExporter, eulerToQuaternionsMatchesRotationMatrix) {
+    using namespace Assimp::FBX;
+
+    // non-trivial angles in degrees, including some beyond +-180
+    const ai_real x[] = { 37.0, 170.0, 12.5, -95.0, 0.0, 300.0 };
+    const ai_real y[] = { -71.0, 45.0, 88.0, 15.0, 60.0, -200.0 };
+    const ai_real z[] = { 123.0, -10.0, 260.0, -45.0, 0.0, 33.0 };
+    const size_t count = sizeof(x) / sizeof(x[0]);
+
+    const Model::RotOrder orders[] = { Model::RotOrder_EulerXYZ, Model::RotOrder_EulerXZY, Model::RotOrder_EulerYZX,
+        Model::RotOrder_EulerYXZ, Model::RotOrder_EulerZXY, Model::RotOrder_EulerZYX };
+    for (const Model::RotOrder order : orders) {
+        aiQuatKey keys[count];
+        FBXConverter::EulerToQuaternions(x, y, z, count, order, keys);
+        for (size_t i = 0; i < count; ++i) {
+            aiMatrix4x4 expected;
+            FBXConverter::GetRotationMatrix(order, aiVector3D(x[i], y[i], z[i]), expected);
+
+            // compare rotation matrices, q and -q are the same rotation
+            const aiMatrix3x3 actual = keys[i].mValue.GetMatrix();
+            for (unsigned int r = 0; r < 3; ++r) {
+                for (unsigned int c = 0; c < 3; ++c) {
+                    EXPECT_NEAR(expected[r][c], actual[r][c], 1e-5) << "order " << order << ", sample " << i;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,199 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/GenLODsProcess.h"
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <vector>
+
+using namespace Assimp;
+
+class utGenLODs : public ::testing::Test {
+public:
+    static constexpr unsigned int GridSize = 20;
+
+    void SetUp() override {
+        // a grid in the xy plane, optionally with a bumpy z coordinate
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mName.Set("grid");
+        mMesh->mNumVertices = (GridSize + 1) * (GridSize + 1);
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mTextureCoords[0] = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mNumUVComponents[0] = 2;
+        for (unsigned int y = 0; y <= GridSize; ++y) {
+            for (unsigned int x = 0; x <= GridSize; ++x) {
+                mMesh->mVertices[y * (GridSize + 1) + x] = aiVector3D((ai_real)x, (ai_real)y, 0.0);
+                mMesh->mTextureCoords[0][y * (GridSize + 1) + x] = aiVector3D((ai_real)x / GridSize, (ai_real)y / GridSize, 0.0);
+            }
+        }
+        mMesh->mNumFaces = GridSize * GridSize * 2;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        for (unsigned int q = 0; q < GridSize * GridSize; ++q) {
+            const unsigned int v0 = (q / GridSize) * (GridSize + 1) + q % GridSize;
+            mMesh->mFaces[q * 2].mNumIndices = 3;
+            mMesh->mFaces[q * 2].mIndices = new unsigned int[3]{ v0, v0 + 1, v0 + GridSize + 2 };
+            mMesh->mFaces[q * 2 + 1].mNumIndices = 3;
+            mMesh->mFaces[q * 2 + 1].mIndices = new unsigned int[3]{ v0, v0 + GridSize + 2, v0 + GridSize + 1 };
+        }
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+    }
+
+    void TearDown() override {
+        delete mScene;
+    }
+
+    void MakeBumpy() {
+        for (unsigned int y = 0; y <= GridSize; ++y) {
+            for (unsigned int x = 0; x <= GridSize; ++x) {
+                // irregular heights, a regular pattern has ridges which collapse without error
+                mMesh->mVertices[y * (GridSize + 1) + x].z = (ai_real)((x * x * 3 + y * y * 7 + x * y) % 11) / 10;
+            }
+        }
+    }
+
+protected:
+    aiMesh *mMesh = nullptr;
+    aiScene *mScene = nullptr;
+};
+
+TEST_F(utGenLODs, planarGridIsSimplifiedPerRatio) {
+    GenLODsProcess process;
+    std::vector<aiMesh *> lods;
+    process.ProcessMesh(mMesh, lods);
+    ASSERT_FALSE(lods.empty());
+
+    unsigned int lastNumFaces = mMesh->mNumFaces;
+    for (const aiMesh *lod : lods) {
+        EXPECT_LT(lod->mNumFaces, lastNumFaces);
+        EXPECT_LE(lod->mNumVertices, mMesh->mNumVertices);
+        EXPECT_TRUE(lod->HasTextureCoords(0));
+        EXPECT_EQ(mMesh->mMaterialIndex, lod->mMaterialIndex);
+        for (unsigned int v = 0; v < lod->mNumVertices; ++v) {
+            EXPECT_EQ(0.0, lod->mVertices[v].z);
+        }
+        for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+            ASSERT_EQ(3u, lod->mFaces[f].mNumIndices);
+            for (unsigned int i = 0; i < 3; ++i) {
+                EXPECT_LT(lod->mFaces[f].mIndices[i], lod->mNumVertices);
+            }
+            // all remaining triangles still face +z
+            const aiVector3D &a = lod->mVertices[lod->mFaces[f].mIndices[0]];
+            const aiVector3D &b = lod->mVertices[lod->mFaces[f].mIndices[1]];
+            const aiVector3D &c = lod->mVertices[lod->mFaces[f].mIndices[2]];
+            EXPECT_GT(((b - a) ^ (c - a)).z, 0.0);
+        }
+        lastNumFaces = lod->mNumFaces;
+    }
+    EXPECT_LE(lods[0]->mNumFaces, mMesh->mNumFaces / 2);
+
+    for (aiMesh *lod : lods) {
+        delete lod;
+    }
+}
+
+TEST_F(utGenLODs, bumpyGridWithoutAllowedErrorIsNotSimplified) {
+    MakeBumpy();
+
+    Importer importer;
+    importer.SetPropertyFloat(AI_CONFIG_PP_LOD_MAX_ERROR, 1e-6f);
+    GenLODsProcess process;
+    process.SetupProperties(&importer);
+
+    std::vector<aiMesh *> lods;
+    process.ProcessMesh(mMesh, lods);
+    EXPECT_TRUE(lods.empty());
+}
+
+TEST_F(utGenLODs, lodMeshesAreAppendedToScene) {
+    GenLODsProcess process;
+    process.Execute(mScene);
+    ASSERT_GT(mScene->mNumMeshes, 1u);
+    EXPECT_EQ(mMesh, mScene->mMeshes[0]);
+    ASSERT_NE(nullptr, mScene->mMetaData);
+
+    uint32_t index = 0;
+    ASSERT_TRUE(mScene->mMetaData->Get("LOD_0_1", index));
+    ASSERT_LT(index, mScene->mNumMeshes);
+    EXPECT_STREQ("grid_LOD1", mScene->mMeshes[index]->mName.C_Str());
+}
+
+TEST_F(utGenLODs, sceneWithoutLODsGetsNoMetaData) {
+    MakeBumpy();
+
+    Importer importer;
+    importer.SetPropertyFloat(AI_CONFIG_PP_LOD_MAX_ERROR, 1e-6f);
+    GenLODsProcess process;
+    process.SetupProperties(&importer);
+    process.Execute(mScene);
+    EXPECT_EQ(1u, mScene->mNumMeshes);
+    EXPECT_EQ(nullptr, mScene->mMetaData);
+}
+
+TEST_F(utGenLODs, mismatchedBlendShapesAreDropped) {
+    mMesh->mNumAnimMeshes = 2;
+    mMesh->mAnimMeshes = new aiAnimMesh *[2];
+    for (unsigned int a = 0; a < 2; ++a) {
+        aiAnimMesh *anim = mMesh->mAnimMeshes[a] = new aiAnimMesh();
+        anim->mName.Set(a == 0 ? "matching" : "mismatched");
+        anim->mNumVertices = a == 0 ? mMesh->mNumVertices : mMesh->mNumVertices / 2;
+        anim->mVertices = new aiVector3D[anim->mNumVertices];
+        for (unsigned int v = 0; v < anim->mNumVertices; ++v) {
+            anim->mVertices[v] = mMesh->mVertices[v] + aiVector3D(0.0, 0.0, 1.0);
+        }
+    }
+
+    GenLODsProcess process;
+    std::vector<aiMesh *> lods;
+    process.ProcessMesh(mMesh, lods);
+    ASSERT_FALSE(lods.empty());
+    for (aiMesh *lod : lods) {
+        ASSERT_EQ(1u, lod->mNumAnimMeshes);
+        EXPECT_STREQ("matching", lod->mAnimMeshes[0]->mName.C_Str());
+        EXPECT_EQ(lod->mNumVertices, lod->mAnimMeshes[0]->mNumVertices);
+        delete lod;
+    }
+}
@@ -0,0 +1,164 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/GenMeshletsProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <vector>
+
+using namespace Assimp;
+
+class utGenMeshlets : public ::testing::Test {
+public:
+    static constexpr unsigned int GridSize = 20;
+
+    void SetUp() override {
+        // a planar grid facing +z
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = (GridSize + 1) * (GridSize + 1);
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        for (unsigned int y = 0; y <= GridSize; ++y) {
+            for (unsigned int x = 0; x <= GridSize; ++x) {
+                mMesh->mVertices[y * (GridSize + 1) + x] = aiVector3D((ai_real)x, (ai_real)y, 0.0);
+            }
+        }
+        mMesh->mNumFaces = GridSize * GridSize * 2;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        for (unsigned int q = 0; q < GridSize * GridSize; ++q) {
+            const unsigned int v0 = (q / GridSize) * (GridSize + 1) + q % GridSize;
+            mMesh->mFaces[q * 2].mNumIndices = 3;
+            mMesh->mFaces[q * 2].mIndices = new unsigned int[3]{ v0, v0 + 1, v0 + GridSize + 2 };
+            mMesh->mFaces[q * 2 + 1].mNumIndices = 3;
+            mMesh->mFaces[q * 2 + 1].mIndices = new unsigned int[3]{ v0, v0 + GridSize + 2, v0 + GridSize + 1 };
+        }
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+    }
+
+    void TearDown() override {
+        delete mScene;
+    }
+
+protected:
+    aiMesh *mMesh = nullptr;
+    aiScene *mScene = nullptr;
+};
+
+TEST_F(utGenMeshlets, meshletsCoverAllFacesTest) {
+    GenMeshletsProcess process;
+    process.Execute(mScene);
+    ASSERT_TRUE(mMesh->HasMeshlets());
+
+    const aiMeshletTable *table = mMesh->mMeshlets;
+    std::vector<unsigned int> faceCount(mMesh->mNumVertices, 0);
+    unsigned int numTriangles = 0;
+    for (unsigned int m = 0; m < table->mNumMeshlets; ++m) {
+        const aiMeshlet &meshlet = table->mMeshlets[m];
+        EXPECT_LE(meshlet.mNumVertices, (unsigned int)AI_GML_DEFAULT_MAX_VERTICES);
+        EXPECT_LE(meshlet.mNumTriangles, (unsigned int)AI_GML_DEFAULT_MAX_TRIANGLES);
+        numTriangles += meshlet.mNumTriangles;
+
+        for (unsigned int i = 0; i < meshlet.mNumVertices; ++i) {
+            const aiVector3D &p = mMesh->mVertices[table->mVertices[meshlet.mVertexOffset + i]];
+            EXPECT_LE((p - meshlet.mCenter).Length(), meshlet.mRadius + 1e-4);
+        }
+        for (unsigned int i = 0; i < meshlet.mNumTriangles * 3; ++i) {
+            EXPECT_LT(table->mTriangles[meshlet.mTriangleOffset + i], meshlet.mNumVertices);
+            ++faceCount[table->mVertices[meshlet.mVertexOffset + table->mTriangles[meshlet.mTriangleOffset + i]]];
+        }
+
+        // all triangles of the grid face the same direction
+        EXPECT_NEAR(1.0, meshlet.mConeAxis.z, 1e-5);
+        EXPECT_LT(meshlet.mConeCutoff, 1e-3);
+    }
+    EXPECT_EQ(mMesh->mNumFaces, numTriangles);
+
+    // every vertex is referenced as often as by the faces of the mesh
+    std::vector<unsigned int> expected(mMesh->mNumVertices, 0);
+    for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            ++expected[mMesh->mFaces[f].mIndices[i]];
+        }
+    }
+    EXPECT_EQ(expected, faceCount);
+}
+
+TEST_F(utGenMeshlets, respectsLimitsTest) {
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_GML_MAX_VERTICES, 16);
+    importer.SetPropertyInteger(AI_CONFIG_PP_GML_MAX_TRIANGLES, 8);
+
+    GenMeshletsProcess process;
+    process.SetupProperties(&importer);
+    process.Execute(mScene);
+    ASSERT_TRUE(mMesh->HasMeshlets());
+
+    const aiMeshletTable *table = mMesh->mMeshlets;
+    EXPECT_GE(table->mNumMeshlets, mMesh->mNumFaces / 8);
+    for (unsigned int m = 0; m < table->mNumMeshlets; ++m) {
+        EXPECT_LE(table->mMeshlets[m].mNumVertices, 16u);
+        EXPECT_LE(table->mMeshlets[m].mNumTriangles, 8u);
+    }
+}
+
+TEST_F(utGenMeshlets, enabledByExtraStepsTest) {
+    static const char *ObjModel =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "v 0 1 0\n"
+            "f 1 2 3 4\n";
+
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_EXTRA_STEPS, aiProcessExtra_GenMeshlets);
+    const aiScene *scene = importer.ReadFileFromMemory(ObjModel, strlen(ObjModel), aiProcess_Triangulate, "obj");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    ASSERT_TRUE(scene->mMeshes[0]->HasMeshlets());
+    EXPECT_EQ(1u, scene->mMeshes[0]->mMeshlets->mNumMeshlets);
+    EXPECT_EQ(2u, scene->mMeshes[0]->mMeshlets->mMeshlets[0].mNumTriangles);
+}
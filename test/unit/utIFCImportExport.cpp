@@ -40,9 +40,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "AssetLib/STEPParser/STEPFileReader.h"
 
 #include <assimp/postprocess.h>
 #include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+#include <fstream>
+#include <iterator>
 
 using namespace Assimp;
 
@@ -78,3 +83,129 @@ TEST_F(utIFCImportExport, importComplextypeAsColor) {
     const aiScene *scene = importer.ReadFileFromMemory(asset.c_str(), asset.size(), 0);
     EXPECT_EQ(nullptr, scene);
 }
+
+TEST_F(utIFCImportExport, importEntitiesSpanningLines) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    // break the entities at each parameter and use windows line endings
+    std::ifstream file(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", std::ios::binary);
+    ASSERT_TRUE(file.good());
+    const std::string original((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::string wrapped;
+    wrapped.reserve(original.size() * 2);
+    for (size_t i = 0; i < original.size(); ++i) {
+        if (original[i] == '\n') {
+            wrapped += "\r\n";
+        } else if (original[i] == ',' && i + 1 < original.size() && original[i + 1] == ' ') {
+            wrapped += ",\r\n";
+        } else {
+            wrapped += original[i];
+        }
+    }
+    ASSERT_GT(wrapped.size(), original.size());
+
+    Assimp::Importer wrappedImporter;
+    const aiScene *wrappedScene = wrappedImporter.ReadFileFromMemory(wrapped.data(), wrapped.size(), aiProcess_ValidateDataStructure, "ifc");
+    ASSERT_NE(nullptr, wrappedScene);
+
+    ASSERT_EQ(scene->mNumMeshes, wrappedScene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(scene->mMeshes[i]->mNumVertices, wrappedScene->mMeshes[i]->mNumVertices);
+        EXPECT_EQ(scene->mMeshes[i]->mNumFaces, wrappedScene->mMeshes[i]->mNumFaces);
+    }
+}
+
+static void compareNodes(const aiNode *expected, const aiNode *actual) {
+    EXPECT_STREQ(expected->mName.C_Str(), actual->mName.C_Str());
+    ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        EXPECT_EQ(expected->mMeshes[i], actual->mMeshes[i]);
+    }
+    ASSERT_EQ(expected->mNumChildren, actual->mNumChildren);
+    for (unsigned int i = 0; i < expected->mNumChildren; ++i) {
+        compareNodes(expected->mChildren[i], actual->mChildren[i]);
+    }
+}
+
+TEST_F(utIFCImportExport, importParallelProducts) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyBool(AI_CONFIG_IMPORT_IFC_PARALLEL_PRODUCTS, true);
+    const aiScene *parallelScene = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallelScene);
+
+    // the products are merged back in file order, so the scenes must be the same
+    ASSERT_EQ(scene->mNumMaterials, parallelScene->mNumMaterials);
+    ASSERT_EQ(scene->mNumMeshes, parallelScene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(scene->mMeshes[i]->mNumVertices, parallelScene->mMeshes[i]->mNumVertices);
+        EXPECT_EQ(scene->mMeshes[i]->mNumFaces, parallelScene->mMeshes[i]->mNumFaces);
+        EXPECT_EQ(scene->mMeshes[i]->mMaterialIndex, parallelScene->mMeshes[i]->mMaterialIndex);
+    }
+    compareNodes(scene->mRootNode, parallelScene->mRootNode);
+}
+
+TEST_F(utIFCImportExport, splitDataSectionOutsideOfStrings) {
+    const std::string data =
+            "#1= IFCLABEL('a');\n"
+            "#2= IFCTEXT('first;\n"
+            "#3= IFCLABEL(''x'');\n"
+            "last');\n"
+            "/* a comment;\n"
+            "#4= IFCLABEL('y'); */ #5= IFCLABEL('b');\n"
+            "#6= IFCLABEL('c');\n";
+    const char *begin = data.data();
+    const char *end = begin + data.size();
+
+    // with more chunks than bytes every record end is a candidate
+    const std::vector<const char *> bounds = STEP::SplitDataSection(begin, end, data.size());
+    const std::vector<const char *> expected = {
+        begin,
+        begin + data.find("#2="),
+        begin + data.find("/*"),
+        begin + data.find("#6="),
+        end
+    };
+    EXPECT_EQ(expected, bounds);
+
+    const std::vector<const char *> single = STEP::SplitDataSection(begin, end, 1);
+    EXPECT_EQ(2u, single.size());
+}
+
+TEST_F(utIFCImportExport, importStringsSpanningChunks) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    // add an unreferenced entity with a string which is larger than the rest of the file,
+    // so the data section is split within it. Each line of the string looks like the end
+    // of a record followed by a definition which would replace the storey before it.
+    std::ifstream file(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", std::ios::binary);
+    ASSERT_TRUE(file.good());
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const std::string::size_type storey = content.find('\n', content.find("#596= IFCBUILDINGSTOREY"));
+    ASSERT_NE(std::string::npos, storey);
+
+    std::string text = "#999999= IFCPROPERTYSINGLEVALUE('Note',$,IFCTEXT('start;\n";
+    while (text.size() < content.size() + (1 << 20)) {
+        text += "#596= IFCBUILDINGSTOREY(''0yBEy76WYo3DwzauJBQBOE'',#13,''Fake'',$,$,#593,$,''Fake'',.ELEMENT.,0.);\n";
+    }
+    text += "end'),$);\n";
+    content.insert(storey + 1, text);
+
+    Assimp::Importer paddedImporter;
+    const aiScene *paddedScene = paddedImporter.ReadFileFromMemory(content.data(), content.size(), aiProcess_ValidateDataStructure, "ifc");
+    ASSERT_NE(nullptr, paddedScene);
+
+    ASSERT_EQ(scene->mNumMeshes, paddedScene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(scene->mMeshes[i]->mNumVertices, paddedScene->mMeshes[i]->mNumVertices);
+        EXPECT_EQ(scene->mMeshes[i]->mNumFaces, paddedScene->mMeshes[i]->mNumFaces);
+    }
+    compareNodes(scene->mRootNode, paddedScene->mRootNode);
+}
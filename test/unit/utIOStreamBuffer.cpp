@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "UnitTestPCH.h"
 #include <assimp/IOStreamBuffer.h>
+#include <assimp/MemoryIOWrapper.h>
 #include "TestIOStream.h"
 #include "Tools/TestTools.h"
 #include "UnitTestFileGenerator.h"
@@ -145,6 +146,31 @@ TEST_F( IOStreamBufferTest, readlineTest ) {
     EXPECT_TRUE(myBuffer.close() );
 }
 
+TEST_F( IOStreamBufferTest, getNextLinesTest ) {
+    static const char text[] = "header\r\n1 2 3\r\n\r\n4 5 6\n7 8 9\nnext\nlast";
+    MemoryIOStream myStream(reinterpret_cast<const uint8_t *>(text), sizeof(text) - 1);
+
+    // a small cache makes the lines cross block boundaries
+    IOStreamBuffer<char> myBuffer(5);
+    EXPECT_TRUE(myBuffer.open(&myStream));
+
+    std::vector<char> line;
+    EXPECT_TRUE(myBuffer.getNextLine(line));
+    EXPECT_EQ(0, strncmp(line.data(), "header\n", 7));
+
+    std::vector<char> lines;
+    EXPECT_EQ(3u, myBuffer.getNextLines(lines, 3));
+    EXPECT_EQ("1 2 3\r\n\r\n4 5 6\n7 8 9\n", std::string(lines.begin(), lines.end()));
+
+    EXPECT_TRUE(myBuffer.getNextLine(line));
+    EXPECT_EQ(0, strncmp(line.data(), "next\n", 5));
+
+    // the stream ends before the requested number of lines
+    EXPECT_EQ(1u, myBuffer.getNextLines(lines, 3));
+    EXPECT_EQ("last\n", std::string(lines.begin(), lines.end()));
+    EXPECT_TRUE(myBuffer.close());
+}
+
 TEST_F( IOStreamBufferTest, accessBlockIndexTest ) {
 
 }
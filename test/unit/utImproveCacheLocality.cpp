@@ -40,3 +40,230 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+
+#include "PostProcessing/ImproveCacheLocality.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace Assimp;
+
+class utImproveCacheLocality : public ::testing::Test {
+protected:
+    static constexpr unsigned int GridSize = 32;
+
+    void SetUp() override {
+        mScene = new aiScene;
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh = new aiMesh;
+
+        // a grid of quads split into triangles, emitted in a cache-unfriendly order
+        const unsigned int numVerts = (GridSize + 1) * (GridSize + 1);
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = numVerts;
+        mMesh->mVertices = new aiVector3D[numVerts];
+        mMesh->mNormals = new aiVector3D[numVerts];
+        for (unsigned int y = 0; y <= GridSize; ++y) {
+            for (unsigned int x = 0; x <= GridSize; ++x) {
+                mMesh->mVertices[y * (GridSize + 1) + x] = aiVector3D((ai_real)x, (ai_real)y, 0.0);
+                mMesh->mNormals[y * (GridSize + 1) + x] = aiVector3D((ai_real)x, (ai_real)y, 1.0);
+            }
+        }
+
+        mMesh->mNumFaces = GridSize * GridSize * 2;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        unsigned int f = 0;
+        for (unsigned int i = 0; i < GridSize * GridSize; ++i) {
+            const unsigned int q = (i * 7919) % (GridSize * GridSize);
+            const unsigned int x = q % GridSize, y = q / GridSize;
+            const unsigned int v0 = y * (GridSize + 1) + x, v1 = v0 + 1, v2 = v0 + GridSize + 1, v3 = v2 + 1;
+            SetFace(mMesh->mFaces[f++], v0, v1, v3);
+            SetFace(mMesh->mFaces[f++], v0, v3, v2);
+        }
+        mInputTriangles = CollectTriangles();
+    }
+
+    void TearDown() override {
+        delete mScene;
+    }
+
+    static void SetFace(aiFace &face, unsigned int a, unsigned int b, unsigned int c) {
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[3]{ a, b, c };
+    }
+
+    // triangles as sorted position triples, independent of vertex and face order
+    std::vector<std::array<ai_real, 9>> CollectTriangles() const {
+        std::vector<std::array<ai_real, 9>> tris;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            std::array<ai_real, 9> t;
+            for (unsigned int i = 0; i < 3; ++i) {
+                const aiVector3D &v = mMesh->mVertices[mMesh->mFaces[f].mIndices[i]];
+                t[i * 3] = v.x;
+                t[i * 3 + 1] = v.y;
+                t[i * 3 + 2] = v.z;
+            }
+            tris.push_back(t);
+        }
+        std::sort(tris.begin(), tris.end());
+        return tris;
+    }
+
+    float ComputeACMR(unsigned int cacheSize) const {
+        std::vector<unsigned int> fifo;
+        unsigned int misses = 0;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < 3; ++i) {
+                const unsigned int idx = mMesh->mFaces[f].mIndices[i];
+                if (std::find(fifo.begin(), fifo.end(), idx) == fifo.end()) {
+                    ++misses;
+                    fifo.push_back(idx);
+                    if (fifo.size() > cacheSize) {
+                        fifo.erase(fifo.begin());
+                    }
+                }
+            }
+        }
+        return static_cast<float>(misses) / mMesh->mNumFaces;
+    }
+
+    void Run(int algorithm, float overdrawThreshold, bool vertexFetch) {
+        Importer importer;
+        importer.SetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM, algorithm);
+        importer.SetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, overdrawThreshold);
+        importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH, vertexFetch);
+
+        ImproveCacheLocalityProcess process;
+        process.SetupProperties(&importer);
+        process.Execute(mScene);
+    }
+
+    aiScene *mScene = nullptr;
+    aiMesh *mMesh = nullptr;
+    std::vector<std::array<ai_real, 9>> mInputTriangles;
+};
+
+TEST_F(utImproveCacheLocality, tipsifyImprovesACMRTest) {
+    const float acmrIn = ComputeACMR(PP_ICL_PTCACHE_SIZE);
+    Run(aiICLAlgorithm_Tipsify, 0.f, false);
+    EXPECT_LT(ComputeACMR(PP_ICL_PTCACHE_SIZE), acmrIn);
+    EXPECT_EQ(mInputTriangles, CollectTriangles());
+}
+
+TEST_F(utImproveCacheLocality, forsythImprovesACMRTest) {
+    const float acmrIn = ComputeACMR(PP_ICL_PTCACHE_SIZE);
+    Run(aiICLAlgorithm_Forsyth, 0.f, false);
+    EXPECT_LT(ComputeACMR(PP_ICL_PTCACHE_SIZE), acmrIn);
+    EXPECT_EQ(mInputTriangles, CollectTriangles());
+}
+
+TEST_F(utImproveCacheLocality, overdrawSortsClustersTest) {
+    // a closed box with half extents 0.5, 1 and 2, each side with its own vertices so the
+    // sides become separate clusters, the faces of all sides are interleaved
+    static const unsigned int SideSize = 8;
+    const ai_real halfExtents[3] = { 0.5, 1.0, 2.0 };
+    std::vector<aiVector3D> vertices;
+    std::vector<std::array<unsigned int, 3>> faces;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+        const unsigned int u = (axis + 1) % 3, v = (axis + 2) % 3;
+        for (int sign = -1; sign <= 1; sign += 2) {
+            const unsigned int base = static_cast<unsigned int>(vertices.size());
+            for (unsigned int j = 0; j <= SideSize; ++j) {
+                for (unsigned int i = 0; i <= SideSize; ++i) {
+                    ai_real p[3];
+                    p[axis] = sign * halfExtents[axis];
+                    p[u] = halfExtents[u] * (2 * ai_real(i) / SideSize - 1);
+                    p[v] = halfExtents[v] * (2 * ai_real(j) / SideSize - 1);
+                    vertices.emplace_back(p[0], p[1], p[2]);
+                }
+            }
+            for (unsigned int j = 0; j < SideSize; ++j) {
+                for (unsigned int i = 0; i < SideSize; ++i) {
+                    const unsigned int v0 = base + j * (SideSize + 1) + i, v1 = v0 + 1, v2 = v0 + SideSize + 1, v3 = v2 + 1;
+                    // wind the triangles so that their normals point outwards
+                    if (sign > 0) {
+                        faces.push_back({ v0, v1, v3 });
+                        faces.push_back({ v0, v3, v2 });
+                    } else {
+                        faces.push_back({ v0, v3, v1 });
+                        faces.push_back({ v0, v2, v3 });
+                    }
+                }
+            }
+        }
+    }
+
+    delete mMesh;
+    mScene->mMeshes[0] = mMesh = new aiMesh;
+    mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mMesh->mNumVertices = static_cast<unsigned int>(vertices.size());
+    mMesh->mVertices = new aiVector3D[vertices.size()];
+    std::copy(vertices.begin(), vertices.end(), mMesh->mVertices);
+    mMesh->mNumFaces = static_cast<unsigned int>(faces.size());
+    mMesh->mFaces = new aiFace[faces.size()];
+    for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+        const std::array<unsigned int, 3> &face = faces[(f * 7919) % faces.size()];
+        SetFace(mMesh->mFaces[f], face[0], face[1], face[2]);
+    }
+    mInputTriangles = CollectTriangles();
+
+    // the distance of the plane of each face from the box center
+    auto faceDistances = [this]() {
+        std::vector<ai_real> distances;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            const aiVector3D &p0 = mMesh->mVertices[mMesh->mFaces[f].mIndices[0]];
+            const aiVector3D &p1 = mMesh->mVertices[mMesh->mFaces[f].mIndices[1]];
+            const aiVector3D &p2 = mMesh->mVertices[mMesh->mFaces[f].mIndices[2]];
+            const aiVector3D normal = ((p1 - p0) ^ (p2 - p0)).Normalize();
+            distances.push_back(p0 * normal);
+        }
+        return distances;
+    };
+    auto isSortedFarthestFirst = [](const std::vector<ai_real> &distances) {
+        for (size_t f = 1; f < distances.size(); ++f) {
+            if (distances[f] > distances[f - 1] + 1e-3) {
+                return false;
+            }
+        }
+        return true;
+    };
+    ASSERT_FALSE(isSortedFarthestFirst(faceDistances()));
+
+    Run(aiICLAlgorithm_Forsyth, 1.05f, false);
+    EXPECT_EQ(mInputTriangles, CollectTriangles());
+
+    // the clusters are emitted by how far they face away from the center, the
+    // large sides first
+    const std::vector<ai_real> distances = faceDistances();
+    EXPECT_TRUE(isSortedFarthestFirst(distances));
+    EXPECT_NEAR(2.0, distances.front(), 1e-3);
+    EXPECT_NEAR(0.5, distances.back(), 1e-3);
+}
+
+TEST_F(utImproveCacheLocality, vertexFetchReordersVerticesTest) {
+    Run(aiICLAlgorithm_Tipsify, 0.f, true);
+    EXPECT_EQ(mInputTriangles, CollectTriangles());
+
+    // vertices are now numbered in the order they are first referenced
+    unsigned int next = 0;
+    for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int idx = mMesh->mFaces[f].mIndices[i];
+            EXPECT_LE(idx, next);
+            if (idx == next) {
+                ++next;
+            }
+        }
+    }
+
+    // the other channels followed the positions
+    for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+        EXPECT_EQ(mMesh->mVertices[v].x, mMesh->mNormals[v].x);
+        EXPECT_EQ(mMesh->mVertices[v].y, mMesh->mNormals[v].y);
+    }
+}
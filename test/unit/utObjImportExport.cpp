@@ -539,3 +539,33 @@ TEST_F(utObjImportExport, issue2355_mtl_texture_prefix) {
     // The MTL file is in `folder`, the image path should have been prefixed with the folder
     EXPECT_STREQ("folder/image.jpg", texturePath.C_Str());
 }
+
+TEST_F(utObjImportExport, export_shares_vertices_between_meshes) {
+    static const char *ObjModel =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 0 1 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "g a\n"
+            "f 1 2 3\n"
+            "g b\n"
+            "f 4 5 3\n";
+
+    Assimp::Importer importer;
+    const aiScene *const scene = importer.ReadFileFromMemory(ObjModel, strlen(ObjModel), aiProcess_ValidateDataStructure, "obj");
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(2U, scene->mNumMeshes);
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+    ::Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "objnomtl", aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, blob);
+
+    // the second mesh references the vertices of the first one
+    const std::string text(static_cast<const char *>(blob->data), blob->size);
+    EXPECT_NE(std::string::npos, text.find("# 4 vertex positions\n"));
+    EXPECT_NE(std::string::npos, text.find("f  1/ 2/ 3/\n"));
+    EXPECT_NE(std::string::npos, text.find("f  2/ 4/ 3/\n"));
+#endif // ASSIMP_BUILD_NO_EXPORT
+}
@@ -0,0 +1,239 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/OptimizeAnimationsProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <cmath>
+
+using namespace Assimp;
+
+class utOptimizeAnimations : public ::testing::Test {
+public:
+    void SetUp() override {
+        mScene = new aiScene();
+        mScene->mRootNode = new aiNode("root");
+        aiNode *children[2] = { new aiNode("a"), new aiNode("b") };
+        children[1]->mTransformation = aiMatrix4x4(aiVector3D(1, 1, 1), aiQuaternion(), aiVector3D(0, 2, 0));
+        mScene->mRootNode->addChildren(2, children);
+
+        mAnim = new aiAnimation();
+        mAnim->mDuration = 100.0;
+        mAnim->mNumChannels = 2;
+        mAnim->mChannels = new aiNodeAnim *[2];
+        for (unsigned int i = 0; i < 2; ++i) {
+            mAnim->mChannels[i] = new aiNodeAnim();
+            mAnim->mChannels[i]->mNodeName = children[i]->mName;
+        }
+        mScene->mNumAnimations = 1;
+        mScene->mAnimations = new aiAnimation *[1];
+        mScene->mAnimations[0] = mAnim;
+    }
+
+    void TearDown() override {
+        delete mScene;
+    }
+
+    static void SetPositions(aiNodeAnim *channel, unsigned int num, aiVector3D (*func)(double)) {
+        channel->mNumPositionKeys = num;
+        channel->mPositionKeys = new aiVectorKey[num];
+        for (unsigned int i = 0; i < num; ++i) {
+            channel->mPositionKeys[i] = aiVectorKey(i, func(i));
+        }
+    }
+
+    static void SetIdentity(aiNodeAnim *channel, const aiVector3D &position) {
+        channel->mNumPositionKeys = channel->mNumRotationKeys = channel->mNumScalingKeys = 10;
+        channel->mPositionKeys = new aiVectorKey[10];
+        channel->mRotationKeys = new aiQuatKey[10];
+        channel->mScalingKeys = new aiVectorKey[10];
+        for (unsigned int i = 0; i < 10; ++i) {
+            channel->mPositionKeys[i] = aiVectorKey(i, position);
+            channel->mRotationKeys[i] = aiQuatKey(i, aiQuaternion());
+            channel->mScalingKeys[i] = aiVectorKey(i, aiVector3D(1, 1, 1));
+        }
+    }
+
+    // evaluates a linearly interpolated position track
+    static aiVector3D Evaluate(const aiNodeAnim *channel, double time) {
+        const aiVectorKey *keys = channel->mPositionKeys;
+        unsigned int i = 0;
+        while (i + 2 < channel->mNumPositionKeys && keys[i + 1].mTime <= time) {
+            ++i;
+        }
+        const ai_real f = (ai_real)((time - keys[i].mTime) / (keys[i + 1].mTime - keys[i].mTime));
+        return keys[i].mValue + (keys[i + 1].mValue - keys[i].mValue) * f;
+    }
+
+protected:
+    aiScene *mScene = nullptr;
+    aiAnimation *mAnim = nullptr;
+};
+
+TEST_F(utOptimizeAnimations, linearTrackIsReducedToEndpoints) {
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    SetPositions(channel, 100, [](double t) { return aiVector3D((ai_real)t, (ai_real)(2 * t), 0); });
+
+    OptimizeAnimationsProcess process;
+    EXPECT_EQ(98u, process.ProcessChannel(channel));
+    ASSERT_EQ(2u, channel->mNumPositionKeys);
+    EXPECT_EQ(0.0, channel->mPositionKeys[0].mTime);
+    EXPECT_EQ(99.0, channel->mPositionKeys[1].mTime);
+}
+
+TEST_F(utOptimizeAnimations, slerpTrackIsReducedToEndpoints) {
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    const aiQuaternion from, to(aiVector3D(0, 0, 1), (ai_real)AI_MATH_HALF_PI);
+    channel->mNumRotationKeys = 50;
+    channel->mRotationKeys = new aiQuatKey[50];
+    for (unsigned int i = 0; i < 50; ++i) {
+        aiQuaternion q;
+        aiQuaternion::Interpolate(q, from, to, (ai_real)i / 49);
+        channel->mRotationKeys[i] = aiQuatKey(i, q);
+    }
+
+    OptimizeAnimationsProcess process;
+    process.ProcessChannel(channel);
+    EXPECT_EQ(2u, channel->mNumRotationKeys);
+}
+
+TEST_F(utOptimizeAnimations, curvedTrackStaysWithinTolerance) {
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    SetPositions(channel, 100, [](double t) { return aiVector3D((ai_real)std::sin(t * 0.02), 0, 0); });
+    aiVector3D original[100];
+    for (unsigned int i = 0; i < 100; ++i) {
+        original[i] = channel->mPositionKeys[i].mValue;
+    }
+
+    Importer importer;
+    importer.SetPropertyFloat(AI_CONFIG_PP_OA_POSITION_TOLERANCE, 0.001f);
+    OptimizeAnimationsProcess process;
+    process.SetupProperties(&importer);
+    process.ProcessChannel(channel);
+
+    EXPECT_LT(channel->mNumPositionKeys, 50u);
+    EXPECT_GT(channel->mNumPositionKeys, 2u);
+    for (unsigned int i = 0; i < 100; ++i) {
+        EXPECT_LE((Evaluate(channel, i) - original[i]).Length(), 0.001 + 1e-6) << "at key " << i;
+    }
+}
+
+TEST_F(utOptimizeAnimations, constantTrackIsReducedToOneKey) {
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    SetPositions(channel, 20, [](double) { return aiVector3D(3, 4, 5); });
+
+    OptimizeAnimationsProcess process;
+    EXPECT_EQ(19u, process.ProcessChannel(channel));
+    ASSERT_EQ(1u, channel->mNumPositionKeys);
+    EXPECT_EQ(aiVector3D(3, 4, 5), channel->mPositionKeys[0].mValue);
+}
+
+TEST_F(utOptimizeAnimations, stepTrackKeepsChanges) {
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    SetPositions(channel, 6, [](double t) { return aiVector3D(t < 3 ? 0.f : 1.f, 0, 0); });
+    for (unsigned int i = 0; i < 6; ++i) {
+        channel->mPositionKeys[i].mInterpolation = aiAnimInterpolation_Step;
+    }
+
+    OptimizeAnimationsProcess process;
+    process.ProcessChannel(channel);
+    ASSERT_EQ(3u, channel->mNumPositionKeys);
+    EXPECT_EQ(0.0, channel->mPositionKeys[0].mTime);
+    EXPECT_EQ(3.0, channel->mPositionKeys[1].mTime);
+    EXPECT_EQ(5.0, channel->mPositionKeys[2].mTime);
+}
+
+TEST_F(utOptimizeAnimations, cubicTrackIsNotModified) {
+    aiNodeAnim *channel = mAnim->mChannels[0];
+    SetPositions(channel, 10, [](double t) { return aiVector3D((ai_real)t, 0, 0); });
+    channel->mPositionKeys[4].mInterpolation = aiAnimInterpolation_Cubic_Spline;
+
+    OptimizeAnimationsProcess process;
+    EXPECT_EQ(0u, process.ProcessChannel(channel));
+    EXPECT_EQ(10u, channel->mNumPositionKeys);
+}
+
+TEST_F(utOptimizeAnimations, channelHoldingNodeTransformIsRemoved) {
+    SetPositions(mAnim->mChannels[0], 10, [](double t) { return aiVector3D((ai_real)t, 0, 0); });
+    SetIdentity(mAnim->mChannels[1], aiVector3D(0, 2, 0));
+
+    OptimizeAnimationsProcess process;
+    process.Execute(mScene);
+    ASSERT_EQ(1u, mAnim->mNumChannels);
+    EXPECT_STREQ("a", mAnim->mChannels[0]->mNodeName.C_Str());
+    EXPECT_EQ(2u, mAnim->mChannels[0]->mNumPositionKeys);
+}
+
+TEST_F(utOptimizeAnimations, channelDifferingFromNodeTransformIsKept) {
+    SetIdentity(mAnim->mChannels[0], aiVector3D(0, 0, 0));
+    SetIdentity(mAnim->mChannels[1], aiVector3D(0, 0, 0));
+
+    OptimizeAnimationsProcess process;
+    process.Execute(mScene);
+
+    // node a has an identity transform, node b is translated
+    ASSERT_EQ(1u, mAnim->mNumChannels);
+    const aiNodeAnim *channel = mAnim->mChannels[0];
+    EXPECT_STREQ("b", channel->mNodeName.C_Str());
+    EXPECT_EQ(1u, channel->mNumPositionKeys);
+    EXPECT_EQ(1u, channel->mNumRotationKeys);
+    EXPECT_EQ(1u, channel->mNumScalingKeys);
+}
+
+TEST_F(utOptimizeAnimations, lastChannelIsKept) {
+    SetIdentity(mAnim->mChannels[0], aiVector3D(0, 0, 0));
+    SetIdentity(mAnim->mChannels[1], aiVector3D(0, 2, 0));
+
+    OptimizeAnimationsProcess process;
+    process.Execute(mScene);
+    ASSERT_EQ(1u, mAnim->mNumChannels);
+    EXPECT_STREQ("b", mAnim->mChannels[0]->mNodeName.C_Str());
+}
+
+TEST_F(utOptimizeAnimations, isSelectedByExtraFlag) {
+    OptimizeAnimationsProcess process;
+    EXPECT_FALSE(process.IsActive(~0u));
+    EXPECT_TRUE(process.IsExtraActive(aiProcessExtra_OptimizeAnimations));
+    EXPECT_FALSE(process.IsExtraActive(aiProcessExtra_GenLODs));
+}
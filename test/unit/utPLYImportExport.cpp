@@ -43,9 +43,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractImportExportBase.h"
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <cstring>
+#include <thread>
+
 using namespace ::Assimp;
 
 class utPLYImportExport : public AbstractImportExportBase {
@@ -218,6 +222,46 @@ TEST_F(utPLYImportExport, parseErrorTest) {
     EXPECT_NE(nullptr, scene);
 }
 
+// Vertices with missing properties are reported in a single warning from the importing thread
+TEST_F(utPLYImportExport, reportIncompleteVerticesOnce) {
+    const char data[] = "ply\n"
+                        "format ascii 1.0\n"
+                        "element vertex 4\n"
+                        "property float x\n"
+                        "property float y\n"
+                        "property float z\n"
+                        "end_header\n"
+                        "0.0 0.0 0.0\n"
+                        "1.0 0.0\n"
+                        "0.0 1.0\n"
+                        "0.0 1.0 1.0\n";
+
+    struct LogObserver : Assimp::LogStream {
+        std::thread::id m_thread = std::this_thread::get_id();
+        unsigned int m_numWarnings = 0;
+        bool m_foreignThread = false;
+        void write(const char *message) override {
+            if (std::strstr(message, "Unable to parse property instance")) {
+                ++m_numWarnings;
+                m_foreignThread = m_foreignThread || std::this_thread::get_id() != m_thread;
+                EXPECT_NE(nullptr, std::strstr(message, " 2 vertices"));
+            }
+        }
+    };
+    LogObserver logObserver;
+
+    DefaultLogger::get()->attachStream(&logObserver);
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(data, sizeof(data) - 1, 0);
+    DefaultLogger::get()->detachStream(&logObserver);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    ASSERT_EQ(4u, scene->mMeshes[0]->mNumVertices);
+    EXPECT_EQ(aiVector3D(1, 0, 0), scene->mMeshes[0]->mVertices[1]);
+    EXPECT_EQ(1u, logObserver.m_numWarnings);
+    EXPECT_FALSE(logObserver.m_foreignThread);
+}
+
 // This file is invalid, we just want to ensure that the importer is not crashing
 TEST_F(utPLYImportExport, parseInvalid) {
     Assimp::Importer importer;
@@ -282,3 +326,75 @@ TEST_F(utPLYImportExport, parseInvalidDoubleCustomProperty) {
     const aiScene *scene = importer.ReadFileFromMemory(data, sizeof(data), 0);
     EXPECT_EQ(nullptr, scene);
 }
+
+namespace {
+    void appendBigEndian(std::string &data, const void *value, size_t size) {
+        const char *bytes = static_cast<const char *>(value);
+        for (size_t i = 0; i < size; ++i) {
+#ifdef AI_BUILD_BIG_ENDIAN
+            data.push_back(bytes[i]);
+#else
+            data.push_back(bytes[size - 1 - i]);
+#endif
+        }
+    }
+} // namespace
+
+// Binary vertex and face records are converted without building element instances
+TEST_F(utPLYImportExport, importBinaryBigEndianWithFaceTexCoords) {
+    std::string data = "ply\n"
+                       "format binary_big_endian 1.0\n"
+                       "element vertex 3\n"
+                       "property float x\n"
+                       "property short y\n"
+                       "property uchar red\n"
+                       "property float z\n"
+                       "element face 1\n"
+                       "property list uchar float texcoord\n"
+                       "property uchar flags\n"
+                       "property list uchar int vertex_indices\n"
+                       "end_header\n";
+    for (int i = 0; i < 3; ++i) {
+        const float x = 1.5f * i;
+        const int16_t y = static_cast<int16_t>(-i);
+        const uint8_t red = 255;
+        const float z = 2.0f;
+        appendBigEndian(data, &x, sizeof(x));
+        appendBigEndian(data, &y, sizeof(y));
+        data.push_back(static_cast<char>(red));
+        appendBigEndian(data, &z, sizeof(z));
+    }
+    data.push_back(6);
+    for (int i = 0; i < 6; ++i) {
+        const float uv = 0.25f * i;
+        appendBigEndian(data, &uv, sizeof(uv));
+    }
+    data.push_back(0);
+    data.push_back(3);
+    for (int i = 0; i < 3; ++i) {
+        const int32_t index = 2 - i;
+        appendBigEndian(data, &index, sizeof(index));
+    }
+
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(3u, mesh->mNumVertices);
+    EXPECT_FLOAT_EQ(3.0f, mesh->mVertices[2].x);
+    EXPECT_FLOAT_EQ(-2.0f, mesh->mVertices[2].y);
+    EXPECT_FLOAT_EQ(2.0f, mesh->mVertices[2].z);
+    ASSERT_TRUE(mesh->HasVertexColors(0));
+    EXPECT_FLOAT_EQ(1.0f, mesh->mColors[0][1].r);
+
+    ASSERT_EQ(1u, mesh->mNumFaces);
+    ASSERT_EQ(3u, mesh->mFaces[0].mNumIndices);
+    EXPECT_EQ(2u, mesh->mFaces[0].mIndices[0]);
+    EXPECT_EQ(0u, mesh->mFaces[0].mIndices[2]);
+
+    // the first corner references vertex 2
+    ASSERT_TRUE(mesh->HasTextureCoords(0));
+    EXPECT_FLOAT_EQ(0.0f, mesh->mTextureCoords[0][2].x);
+    EXPECT_FLOAT_EQ(0.25f, mesh->mTextureCoords[0][2].y);
+    EXPECT_FLOAT_EQ(1.0f, mesh->mTextureCoords[0][0].x);
+}
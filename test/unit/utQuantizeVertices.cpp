@@ -0,0 +1,162 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "Common/VertexQuantization.h"
+#include "PostProcessing/QuantizeVerticesProcess.h"
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Assimp;
+using namespace Assimp::Quantization;
+
+class utQuantizeVertices : public ::testing::Test {
+public:
+    static constexpr unsigned int NumVertices = 64;
+
+    void SetUp() override {
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_POINT;
+        mMesh->mNumVertices = NumVertices;
+        mMesh->mVertices = new aiVector3D[NumVertices];
+        mMesh->mNormals = new aiVector3D[NumVertices];
+        mMesh->mTangents = new aiVector3D[NumVertices];
+        mMesh->mBitangents = new aiVector3D[NumVertices];
+        mMesh->mTextureCoords[0] = new aiVector3D[NumVertices];
+        mMesh->mNumUVComponents[0] = 2;
+        mMesh->mColors[0] = new aiColor4D[NumVertices];
+        for (unsigned int i = 0; i < NumVertices; ++i) {
+            const ai_real a = (ai_real)i * 0.37f, b = (ai_real)i * 0.11f;
+            mMesh->mVertices[i] = aiVector3D(std::cos(a) * 10, std::sin(a) * 4 - 2, b);
+            mMesh->mNormals[i] = aiVector3D(std::cos(a) * std::cos(b), std::sin(a) * std::cos(b), std::sin(b) - 0.5f).NormalizeSafe();
+            mMesh->mTangents[i] = aiVector3D(-mMesh->mNormals[i].y, mMesh->mNormals[i].x, 0).NormalizeSafe();
+            mMesh->mBitangents[i] = (mMesh->mNormals[i] ^ mMesh->mTangents[i]) * (i % 2 ? (ai_real)-1 : (ai_real)1);
+            mMesh->mTextureCoords[0][i] = aiVector3D((ai_real)i / NumVertices, 1 - (ai_real)i / NumVertices, 0);
+            mMesh->mColors[0][i] = aiColor4D(i / (float)NumVertices, 0.5f, 1.f, 0.f);
+        }
+    }
+
+    void TearDown() override {
+        delete mMesh;
+    }
+
+protected:
+    aiMesh *mMesh = nullptr;
+};
+
+TEST_F(utQuantizeVertices, halfRoundTrip) {
+    EXPECT_EQ(0x3c00, EncodeHalf(1.f));
+    EXPECT_EQ(0xc000, EncodeHalf(-2.f));
+    EXPECT_EQ(0x7bff, EncodeHalf(65504.f));
+    EXPECT_EQ(0x7c00, EncodeHalf(1e6f));
+    EXPECT_EQ(0x0001, EncodeHalf(5.96046448e-8f));
+    EXPECT_EQ(0.5f, DecodeHalf(EncodeHalf(0.5f)));
+    EXPECT_EQ(5.96046448e-8f, DecodeHalf(0x0001));
+    for (float f = -4.f; f <= 4.f; f += 0.013f) {
+        EXPECT_NEAR(f, DecodeHalf(EncodeHalf(f)), std::max(std::fabs(f) / 1024.f, 1e-7f));
+    }
+}
+
+TEST_F(utQuantizeVertices, octahedronRoundTrip) {
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        float u, v;
+        EncodeOctahedron(mMesh->mNormals[i], u, v);
+        const aiVector3D n = DecodeOctahedron(DecodeSNorm(EncodeSNorm(u, 16), 16), DecodeSNorm(EncodeSNorm(v, 16), 16));
+        EXPECT_GT(n * mMesh->mNormals[i], 0.99999);
+    }
+}
+
+TEST_F(utQuantizeVertices, meshRoundTrip) {
+    QuantizeVerticesProcess process;
+    ASSERT_TRUE(process.ProcessMesh(mMesh));
+    ASSERT_TRUE(mMesh->HasQuantizedVertices());
+    const aiQuantizedVertices *q = mMesh->mQuantizedVertices;
+    ASSERT_NE(nullptr, q->mPositions);
+    ASSERT_NE(nullptr, q->mNormals);
+    ASSERT_NE(nullptr, q->mTangents);
+    ASSERT_NE(nullptr, q->mTextureCoords[0]);
+    ASSERT_NE(nullptr, q->mColors[0]);
+    EXPECT_EQ(nullptr, q->mTextureCoords[1]);
+
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        const aiVector3D p = q->mPositionOffset + aiVector3D(q->mPositions[i * 4], q->mPositions[i * 4 + 1], q->mPositions[i * 4 + 2]) * q->mPositionScale;
+        EXPECT_LE((p - mMesh->mVertices[i]).Length(), q->mPositionScale);
+
+        const aiVector3D t = DecodeOctahedron(DecodeSNorm(q->mTangents[i * 4], 16), DecodeSNorm(q->mTangents[i * 4 + 1], 16));
+        EXPECT_GT(t * mMesh->mTangents[i], 0.9999);
+        EXPECT_EQ(i % 2 ? -32767 : 32767, q->mTangents[i * 4 + 2]);
+
+        EXPECT_NEAR(mMesh->mTextureCoords[0][i].x, DecodeHalf(q->mTextureCoords[0][i * 2]), 1e-3);
+        EXPECT_NEAR(mMesh->mTextureCoords[0][i].y, DecodeHalf(q->mTextureCoords[0][i * 2 + 1]), 1e-3);
+
+        EXPECT_EQ(128, q->mColors[0][i * 4 + 1]);
+        EXPECT_EQ(255, q->mColors[0][i * 4 + 2]);
+        EXPECT_EQ(0, q->mColors[0][i * 4 + 3]);
+    }
+
+    // stale data is detected after the vertex count changed
+    ++mMesh->mNumVertices;
+    EXPECT_FALSE(mMesh->HasQuantizedVertices());
+    --mMesh->mNumVertices;
+}
+
+TEST_F(utQuantizeVertices, staleDataIsDetected) {
+    QuantizeVerticesProcess process;
+    ASSERT_TRUE(process.ProcessMesh(mMesh));
+    EXPECT_TRUE(HasCurrentQuantizedVertices(*mMesh));
+
+    // changes which keep the vertex count
+    const aiVector3D position = mMesh->mVertices[7];
+    mMesh->mVertices[7].x += 1;
+    EXPECT_TRUE(mMesh->HasQuantizedVertices());
+    EXPECT_FALSE(HasCurrentQuantizedVertices(*mMesh));
+    mMesh->mVertices[7] = position;
+    EXPECT_TRUE(HasCurrentQuantizedVertices(*mMesh));
+
+    mMesh->mTextureCoords[0][3].y = 1 - mMesh->mTextureCoords[0][3].y;
+    EXPECT_FALSE(HasCurrentQuantizedVertices(*mMesh));
+
+    // quantizing again brings the data up to date
+    ASSERT_TRUE(process.ProcessMesh(mMesh));
+    EXPECT_TRUE(HasCurrentQuantizedVertices(*mMesh));
+}
@@ -217,6 +217,38 @@ TEST_F(utglTF2ImportExport, importglTF2AndExport_KHR_materials_clearcoat) {
     VerifyClearCoatScene(scene);
 }
 
+TEST_F(utglTF2ImportExport, importglTF2AndExport_KHR_mesh_quantization) {
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_EXTRA_STEPS, aiProcessExtra_QuantizeVertices);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_TRUE(scene->mMeshes[0]->HasQuantizedVertices());
+
+    Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "gltf2");
+    ASSERT_NE(nullptr, blob);
+    const std::string json(static_cast<const char *>(blob->data), blob->size);
+
+    rapidjson::Document doc;
+    doc.Parse(json.c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    ASSERT_TRUE(doc.HasMember("extensionsRequired"));
+    bool required = false;
+    for (const auto &ext : doc["extensionsRequired"].GetArray()) {
+        required |= std::string("KHR_mesh_quantization") == ext.GetString();
+    }
+    EXPECT_TRUE(required);
+
+    // positions are stored as unsigned shorts, normals as normalized bytes
+    const rapidjson::Value &attributes = doc["meshes"][0]["primitives"][0]["attributes"];
+    const rapidjson::Value &position = doc["accessors"][attributes["POSITION"].GetUint()];
+    EXPECT_EQ(5123, position["componentType"].GetInt());
+    EXPECT_EQ(8, doc["bufferViews"][position["bufferView"].GetUint()]["byteStride"].GetInt());
+    const rapidjson::Value &normal = doc["accessors"][attributes["NORMAL"].GetUint()];
+    EXPECT_EQ(5120, normal["componentType"].GetInt());
+    EXPECT_TRUE(normal["normalized"].GetBool());
+}
+
 TEST_F(utglTF2ImportExport, importglTF2AndExport_KHR_materials_pbrSpecularGlossiness) {
     Assimp::Importer importer;
     Assimp::Exporter exporter;
@@ -0,0 +1,569 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  Bench.cpp
+ *  @brief Implementation of the 'assimp bench' utility
+ */
+
+#include "Main.h"
+#include "../code/Common/Importer.h"
+#include "../code/Common/BaseProcess.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/ProgressHandler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <locale>
+#include <new>
+#include <typeinfo>
+#include <vector>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+#if defined(__GNUG__)
+#   include <cxxabi.h>
+#endif
+
+// ------------------------------------------------------------------------------
+// Allocation counting. Replacing the global operators covers the library, too,
+// as long as the platform resolves operator new program-wide (e.g. ELF).
+static std::atomic<uint64_t> gNumAllocations(0);
+static std::atomic<uint64_t> gAllocatedBytes(0);
+
+void *operator new(std::size_t size) {
+    ++gNumAllocations;
+    gAllocatedBytes += size;
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+const char *AICMD_MSG_BENCH_HELP =
+        "assimp bench <model> [-n<count>] [--format=<h>] [--json=<file>] [common parameters]\n"
+        "\t Imports the model repeatedly and reports the time, allocations and\n"
+        "\t vertex/face counts per phase and post-processing step.\n"
+        "\t -n<count>, --iterations=<count> Number of runs, default is 5.\n"
+        "\t --format=<h> Also export the scene to the given format, in memory.\n"
+        "\t --json=<file> Write the results to <file> as JSON.\n"
+        "\t[See the assimp_cmd docs for a full list of all common parameters]  \n";
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// ------------------------------------------------------------------------------
+/// A point in time along with the allocation counters.
+struct Mark {
+    Clock::time_point time;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+
+    static Mark Now() {
+        Mark m;
+        m.time = Clock::now();
+        m.allocations = gNumAllocations.load();
+        m.bytes = gAllocatedBytes.load();
+        return m;
+    }
+};
+
+// ------------------------------------------------------------------------------
+/// The vertex and face counts of a scene.
+struct SceneCounts {
+    uint64_t vertices = 0;
+    uint64_t faces = 0;
+
+    static SceneCounts Of(const aiScene *scene) {
+        SceneCounts c;
+        for (unsigned int i = 0; scene && i < scene->mNumMeshes; ++i) {
+            c.vertices += scene->mMeshes[i]->mNumVertices;
+            c.faces += scene->mMeshes[i]->mNumFaces;
+        }
+        return c;
+    }
+};
+
+// ------------------------------------------------------------------------------
+/// IOStream wrapper measuring the time spent in file access.
+class TimingIOStream : public IOStream {
+public:
+    TimingIOStream(IOStream *stream, Clock::duration &elapsed) :
+            mStream(stream), mElapsed(elapsed) {}
+
+    ~TimingIOStream() override {
+        const Clock::time_point start = Clock::now();
+        delete mStream;
+        mElapsed += Clock::now() - start;
+    }
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        const Clock::time_point start = Clock::now();
+        const size_t ret = mStream->Read(pvBuffer, pSize, pCount);
+        mElapsed += Clock::now() - start;
+        return ret;
+    }
+
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override {
+        const Clock::time_point start = Clock::now();
+        const size_t ret = mStream->Write(pvBuffer, pSize, pCount);
+        mElapsed += Clock::now() - start;
+        return ret;
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        const Clock::time_point start = Clock::now();
+        const aiReturn ret = mStream->Seek(pOffset, pOrigin);
+        mElapsed += Clock::now() - start;
+        return ret;
+    }
+
+    size_t Tell() const override {
+        return mStream->Tell();
+    }
+
+    size_t FileSize() const override {
+        return mStream->FileSize();
+    }
+
+    void Flush() override {
+        mStream->Flush();
+    }
+
+private:
+    IOStream *mStream;
+    Clock::duration &mElapsed;
+};
+
+// ------------------------------------------------------------------------------
+/// IOSystem measuring the time spent in opening and reading files.
+class TimingIOSystem : public DefaultIOSystem {
+public:
+    explicit TimingIOSystem(Clock::duration &elapsed) :
+            mElapsed(elapsed) {}
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        const Clock::time_point start = Clock::now();
+        IOStream *stream = DefaultIOSystem::Open(pFile, pMode);
+        mElapsed += Clock::now() - start;
+        return stream ? new TimingIOStream(stream, mElapsed) : nullptr;
+    }
+
+    void Close(IOStream *pFile) override {
+        delete pFile;
+    }
+
+private:
+    Clock::duration &mElapsed;
+};
+
+// ------------------------------------------------------------------------------
+/// Progress handler recording the phase boundaries of a single import.
+class BenchProgressHandler : public ProgressHandler {
+public:
+    explicit BenchProgressHandler(const Importer &importer) :
+            mImporter(importer) {}
+
+    bool Update(float) override {
+        return true;
+    }
+
+    void UpdateFileRead(int, int) override {
+        if (mFileReadCalls++ == 0) {
+            mImportBegin = Mark::Now();
+        } else {
+            mImportEnd = Mark::Now();
+            mImportCounts = SceneCounts::Of(mImporter.GetScene());
+        }
+    }
+
+    void UpdatePostProcess(int currentStep, int numberOfSteps) override {
+        mSteps.resize(static_cast<size_t>(numberOfSteps) + 1);
+        mSteps[currentStep].first = Mark::Now();
+        mSteps[currentStep].second = SceneCounts::Of(mImporter.GetScene());
+    }
+
+    unsigned int mFileReadCalls = 0;
+    Mark mImportBegin, mImportEnd;
+    SceneCounts mImportCounts;
+    std::vector<std::pair<Mark, SceneCounts>> mSteps; // one entry per step boundary
+
+private:
+    const Importer &mImporter;
+};
+
+// ------------------------------------------------------------------------------
+/// Accumulated measurements of a phase over all iterations.
+struct Phase {
+    std::string name;
+    unsigned int runs = 0;
+    double total = 0.0; // seconds
+    double min = std::numeric_limits<double>::max();
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+
+    double Mean() const { return runs ? total / runs : 0.0; }
+};
+
+/// A row of the vertex/face delta table.
+struct StepCounts {
+    std::string name;
+    SceneCounts before, after;
+};
+
+class PhaseTable {
+public:
+    void Add(const std::string &name, double seconds, uint64_t allocations, uint64_t bytes) {
+        Phase *phase = nullptr;
+        for (Phase &p : mPhases) {
+            if (p.name == name) {
+                phase = &p;
+                break;
+            }
+        }
+        if (phase == nullptr) {
+            mPhases.emplace_back();
+            phase = &mPhases.back();
+            phase->name = name;
+        }
+        ++phase->runs;
+        phase->total += seconds;
+        phase->min = std::min(phase->min, seconds);
+        phase->allocations += allocations;
+        phase->bytes += bytes;
+    }
+
+    void Add(const std::string &name, const Mark &begin, const Mark &end, double subtract = 0.0) {
+        const double seconds = std::chrono::duration<double>(end.time - begin.time).count() - subtract;
+        Add(name, std::max(seconds, 0.0), end.allocations - begin.allocations, end.bytes - begin.bytes);
+    }
+
+    const std::vector<Phase> &Get() const {
+        return mPhases;
+    }
+
+private:
+    std::vector<Phase> mPhases;
+};
+
+// ------------------------------------------------------------------------------
+std::string GetStepName(const BaseProcess *step) {
+    std::string name = typeid(*step).name();
+#if defined(__GNUG__)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif
+    for (const char *prefix : { "class ", "struct ", "Assimp::" }) {
+        const size_t len = strlen(prefix);
+        if (name.compare(0, len, prefix) == 0) {
+            name.erase(0, len);
+        }
+    }
+    return name;
+}
+
+// ------------------------------------------------------------------------------
+uint64_t GetPeakResidentSetSize() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+        return static_cast<uint64_t>(pmc.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#   if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#   else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#   endif
+#endif
+}
+
+// ------------------------------------------------------------------------------
+/// Imports (and exports) the model once, adds the phase timings to the table.
+bool RunOnce(const ImportData &import, const std::string &in, const char *exportId,
+        PhaseTable &phases, std::vector<StepCounts> &steps) {
+    Clock::duration ioTime = Clock::duration::zero();
+
+    Importer importer;
+    importer.SetIOHandler(new TimingIOSystem(ioTime));
+    BenchProgressHandler handler(importer);
+    importer.SetProgressHandler(&handler);
+
+    const Mark start = Mark::Now();
+    const aiScene *scene = importer.ReadFile(in, import.ppFlags);
+    const Mark end = Mark::Now();
+    importer.SetProgressHandler(nullptr);
+    if (scene == nullptr || handler.mFileReadCalls < 2) {
+        printf("assimp bench: failed to load file: %s\n", importer.GetErrorString());
+        return false;
+    }
+
+    const double io = std::chrono::duration<double>(ioTime).count();
+    phases.Add("format detection", start, handler.mImportBegin);
+    phases.Add("io", io, 0, 0);
+    phases.Add("parse/convert", handler.mImportBegin, handler.mImportEnd, io);
+
+    // the handler is notified before each registered step and once at the end
+    steps.clear();
+    const std::vector<BaseProcess *> &registered = importer.Pimpl()->mPostProcessingSteps;
+    if (handler.mSteps.size() == registered.size() + 1) {
+        phases.Add("preprocess", handler.mImportEnd, handler.mSteps.front().first);
+        const unsigned int extraFlags = importer.GetPropertyInteger(AI_CONFIG_PP_EXTRA_STEPS, 0);
+        for (size_t i = 0; i < registered.size(); ++i) {
+            if (!registered[i]->IsActive(import.ppFlags) && !registered[i]->IsExtraActive(extraFlags)) {
+                continue;
+            }
+            const std::string name = GetStepName(registered[i]);
+            phases.Add(name, handler.mSteps[i].first, handler.mSteps[i + 1].first);
+            steps.push_back({ name, handler.mSteps[i].second, handler.mSteps[i + 1].second });
+        }
+    } else {
+        phases.Add("preprocess", handler.mImportEnd, end);
+    }
+    phases.Add("import total", start, end);
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+    if (exportId != nullptr) {
+        Exporter exporter;
+        const Mark exportStart = Mark::Now();
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene, exportId);
+        const Mark exportEnd = Mark::Now();
+        if (blob == nullptr) {
+            printf("assimp bench: failed to export: %s\n", exporter.GetErrorString());
+            return false;
+        }
+        phases.Add(std::string("export (") + exportId + ")", exportStart, exportEnd);
+    }
+#else
+    (void)exportId;
+#endif
+
+    // the import counts form the first row of the delta table
+    steps.insert(steps.begin(), { "import", SceneCounts(), handler.mImportCounts });
+    return true;
+}
+
+// ------------------------------------------------------------------------------
+std::string EscapeJson(const std::string &in) {
+    std::string out;
+    for (const char c : in) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += (static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------------------
+bool WriteJson(const std::string &file, const std::string &in, const ImportData &import,
+        unsigned int iterations, const PhaseTable &phases, const std::vector<StepCounts> &steps,
+        uint64_t peakRss) {
+    std::ofstream out(file.c_str());
+    if (!out) {
+        return false;
+    }
+    out.imbue(std::locale::classic());
+    out.precision(9);
+    out << "{\n  \"file\": \"" << EscapeJson(in) << "\",\n"
+        << "  \"flags\": " << import.ppFlags << ",\n"
+        << "  \"iterations\": " << iterations << ",\n"
+        << "  \"peak_rss_bytes\": " << peakRss << ",\n"
+        << "  \"phases\": [";
+    for (size_t i = 0; i < phases.Get().size(); ++i) {
+        const Phase &p = phases.Get()[i];
+        out << (i ? ",\n" : "\n")
+            << "    { \"name\": \"" << EscapeJson(p.name) << "\", \"mean_ms\": " << p.Mean() * 1e3
+            << ", \"min_ms\": " << p.min * 1e3 << ", \"allocations\": " << p.allocations / p.runs
+            << ", \"allocated_bytes\": " << p.bytes / p.runs << " }";
+    }
+    out << "\n  ],\n  \"steps\": [";
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const StepCounts &s = steps[i];
+        out << (i ? ",\n" : "\n")
+            << "    { \"name\": \"" << EscapeJson(s.name) << "\", \"vertices\": " << s.after.vertices
+            << ", \"faces\": " << s.after.faces
+            << ", \"delta_vertices\": " << static_cast<int64_t>(s.after.vertices - s.before.vertices)
+            << ", \"delta_faces\": " << static_cast<int64_t>(s.after.faces - s.before.faces) << " }";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------------
+int Assimp_Bench(const char *const *params, unsigned int num) {
+    if (num < 1) {
+        printf("assimp bench: Invalid number of arguments. See \'assimp bench --help\'\n");
+        return AssimpCmdError::InvalidNumberOfArguments;
+    }
+
+    // --help
+    if (!strcmp(params[0], "-h") || !strcmp(params[0], "--help") || !strcmp(params[0], "-?")) {
+        printf("%s", AICMD_MSG_BENCH_HELP);
+        return AssimpCmdError::Success;
+    }
+
+    const std::string in = std::string(params[0]);
+
+    // get import flags
+    ImportData import;
+    ProcessStandardArguments(import, params + 1, num - 1);
+
+    // process other flags
+    unsigned int iterations = 5;
+    std::string format, json;
+    for (unsigned int i = 1; i < num; ++i) {
+        if (!strncmp(params[i], "-n", 2)) {
+            iterations = static_cast<unsigned int>(strtoul(params[i] + 2, nullptr, 10));
+        } else if (!strncmp(params[i], "--iterations=", 13)) {
+            iterations = static_cast<unsigned int>(strtoul(params[i] + 13, nullptr, 10));
+        } else if (!strncmp(params[i], "--format=", 9)) {
+            format = std::string(params[i] + 9);
+        } else if (!strncmp(params[i], "--json=", 7)) {
+            json = std::string(params[i] + 7);
+        }
+    }
+    iterations = std::max(iterations, 1u);
+
+    if (!globalImporter->ValidateFlags(import.ppFlags)) {
+        printf("assimp bench: unsupported post-processing flags\n");
+        return AssimpCmdError::InvalidNumberOfArguments;
+    }
+#ifdef ASSIMP_BUILD_NO_EXPORT
+    if (!format.empty()) {
+        printf("assimp bench: export is not available in this build\n");
+        return AssimpCmdError::UnknownFileFormat;
+    }
+#endif
+
+    if (import.log) {
+        SetLogStreams(import);
+    }
+
+    PhaseTable phases;
+    std::vector<StepCounts> steps;
+    for (unsigned int i = 0; i < iterations; ++i) {
+        if (!RunOnce(import, in, format.empty() ? nullptr : format.c_str(), phases, steps)) {
+            if (import.log) {
+                FreeLogStreams();
+            }
+            return AssimpCmdError::FailedToLoadInputFile;
+        }
+    }
+    const uint64_t peakRss = GetPeakResidentSetSize();
+
+    if (import.log) {
+        FreeLogStreams();
+    }
+
+    printf("assimp bench: %s, %u iteration(s), flags 0x%x\n\n", in.c_str(), iterations, import.ppFlags);
+    printf("%-36s %12s %12s %14s %14s\n", "Phase", "Mean [ms]", "Min [ms]", "Allocations", "Alloc [KiB]");
+    PrintHorBar();
+    for (const Phase &p : phases.Get()) {
+        printf("%-36s %12.3f %12.3f %14llu %14llu\n", p.name.c_str(), p.Mean() * 1e3, p.min * 1e3,
+                static_cast<unsigned long long>(p.allocations / p.runs),
+                static_cast<unsigned long long>(p.bytes / p.runs / 1024));
+    }
+    printf("\nPeak resident set size: %.2f MiB\n\n", peakRss / (1024.0 * 1024.0));
+
+    printf("%-36s %12s %12s %12s %12s\n", "Step", "Vertices", "Faces", "dVertices", "dFaces");
+    PrintHorBar();
+    for (const StepCounts &s : steps) {
+        printf("%-36s %12llu %12llu %+12lld %+12lld\n", s.name.c_str(),
+                static_cast<unsigned long long>(s.after.vertices), static_cast<unsigned long long>(s.after.faces),
+                static_cast<long long>(s.after.vertices - s.before.vertices),
+                static_cast<long long>(s.after.faces - s.before.faces));
+    }
+
+    if (!json.empty()) {
+        if (!WriteJson(json, in, import, iterations, phases, steps, peakRss)) {
+            printf("assimp bench: failed to write %s\n", json.c_str());
+            return AssimpCmdError::FailedToOpenOutputFile;
+        }
+        printf("\nassimp bench: wrote %s\n", json.c_str());
+    }
+    return AssimpCmdError::Success;
+}
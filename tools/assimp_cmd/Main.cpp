@@ -85,6 +85,7 @@ constexpr char AICMD_MSG_HELP[] =
 " \textract    - Extract embedded texture images\n"
 " \tdump       - Convert models to a binary or textual dump (ASSBIN/ASSXML)\n"
 " \tcmpdump    - Compare dumps created using \'assimp dump <file> -s ...\'\n"
+" \tbench      - Measure the time and memory spent in each import phase\n"
 " \tversion    - Display Assimp version\n"
 "\n Use \'assimp <verb> --help\' for detailed help on a command.\n"
 ;
@@ -242,6 +243,12 @@ int main (int argc, char* argv[]) {
 		return Assimp_TestBatchLoad (&argv[2],argc-2);
 	}
 
+	// assimp bench
+	// Measure import, post-processing and export phases
+	if (! strcmp(argv[1], "bench")) {
+		return Assimp_Bench (&argv[2],argc-2);
+	}
+
 	printf("Unrecognized command. Use \'assimp help\' for a detailed command list\n");
 	return AssimpCmdError::UnrecognizedCommand;
 }
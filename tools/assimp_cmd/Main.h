@@ -140,6 +140,19 @@ int ProcessStandardArguments(ImportData& fill,
 	const char* const* params,
 	unsigned int num);
 
+// ------------------------------------------------------------------------------
+/** Attach the log streams requested by the import configuration
+ *  @param imp Import configuration to be used */
+void SetLogStreams(const ImportData& imp);
+
+// ------------------------------------------------------------------------------
+/** Detach all log streams */
+void FreeLogStreams();
+
+// ------------------------------------------------------------------------------
+/** Print a horizontal separator line */
+void PrintHorBar();
+
 // ------------------------------------------------------------------------------
 /** Import a specific model file
  *  @param imp Import configuration to be used
@@ -260,5 +273,14 @@ int Assimp_TestBatchLoad (
 	const char* const* params,
 	unsigned int num);
 
+// ------------------------------------------------------------------------------
+/** @brief assimp bench utility
+ *  @param params Command line parameters to 'assimp bench'
+ *  @param Number of params
+ *  @return An #AssimpCmdError value. */
+int Assimp_Bench (
+	const char* const* params,
+	unsigned int num);
+
 
 #endif // !! AICMD_MAIN_INCLUDED